@@ -0,0 +1,326 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_CASCADED_UNION_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_CASCADED_UNION_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/detail/assign_values.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
+#include <boost/geometry/algorithms/detail/hilbert_index.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/is_empty.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/strategies/default_strategy.hpp>
+#include <boost/geometry/strategies/parallel.hpp>
+#include <boost/geometry/strategies/relate/cartesian.hpp>
+#include <boost/geometry/strategies/relate/geographic.hpp>
+#include <boost/geometry/strategies/relate/spherical.hpp>
+#include <boost/geometry/util/parallel.hpp>
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/type_traits.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace cascaded_union
+{
+
+
+template <typename Polygon, typename MultiPolygon>
+inline void append(Polygon const& polygon, MultiPolygon& multi, polygon_tag)
+{
+    range::resize(multi, boost::size(multi) + 1);
+    geometry::convert(polygon, range::back(multi));
+}
+
+template <typename MultiPolygon1, typename MultiPolygon2>
+inline void append(MultiPolygon1 const& multi1, MultiPolygon2& multi2, multi_polygon_tag)
+{
+    for (auto it = boost::begin(multi1); it != boost::end(multi1); ++it)
+    {
+        append(*it, multi2, polygon_tag());
+    }
+}
+
+template <typename Geometry, typename MultiPolygon>
+inline void append(Geometry const& geometry, MultiPolygon& multi)
+{
+    append(geometry, multi, typename tag<Geometry>::type());
+}
+
+
+template <typename MultiPolygon, typename Box>
+struct node
+{
+    MultiPolygon geometry;
+    Box box;
+};
+
+// Merges two input geometries or two nodes. If their envelopes are disjoint
+// the polygons are only gathered, otherwise their union is calculated.
+template <typename Geometry, typename Box, typename Node, typename Strategy>
+inline void merge(Geometry const& geometry1, Box const& box1,
+                  Geometry const& geometry2, Box const& box2,
+                  Node& result, Strategy const& strategy)
+{
+    if (detail::disjoint::disjoint_box_box(box1, box2, strategy))
+    {
+        cascaded_union::append(geometry1, result.geometry);
+        cascaded_union::append(geometry2, result.geometry);
+    }
+    else
+    {
+        geometry::union_(geometry1, geometry2, result.geometry, strategy);
+    }
+
+    result.box = box1;
+    geometry::expand(result.box, box2, strategy);
+}
+
+template <typename Node, typename Strategy>
+inline void merge(Node& node1, Node& node2, Node& result, Strategy const& strategy)
+{
+    if (detail::disjoint::disjoint_box_box(node1.box, node2.box, strategy))
+    {
+        result.geometry = std::move(node1.geometry);
+        for (auto it = boost::begin(node2.geometry); it != boost::end(node2.geometry); ++it)
+        {
+            range::push_back(result.geometry, std::move(*it));
+        }
+    }
+    else
+    {
+        geometry::union_(node1.geometry, node2.geometry, result.geometry, strategy);
+    }
+
+    result.box = node1.box;
+    geometry::expand(result.box, node2.box, strategy);
+
+    // Release the memory as soon as possible
+    node1.geometry = decltype(node1.geometry)();
+    node2.geometry = decltype(node2.geometry)();
+}
+
+
+// Calls f(i, strategy) for each pair of the level of the reduction tree.
+// Only the single merge at the top of the tree is passed the strategy as it
+// is, the rest is passed the sequential strategy since the pairs are
+// already merged in parallel.
+template <typename Strategy, typename Function>
+inline void for_each_pair(std::size_t pairs, Strategy const& strategy, Function const& f)
+{
+    if (pairs == 1)
+    {
+        f(0, strategy);
+        return;
+    }
+
+    std::size_t const threads = strategies::detail::threads(strategy);
+    geometry::detail::parallel::for_each_index(pairs, threads, [&](std::size_t i)
+    {
+        f(i, strategies::detail::sequential(strategy));
+    });
+}
+
+
+template <typename Range, typename MultiPolygon, typename Strategy>
+inline void apply(Range const& range, MultiPolygon& out, Strategy const& strategy)
+{
+    using iterator_t = typename boost::range_iterator<Range const>::type;
+    using box_t = model::box<typename geometry::point_type<MultiPolygon>::type>;
+    using node_t = node<MultiPolygon, box_t>;
+
+    struct entry
+    {
+        iterator_t it;
+        box_t box;
+        std::uint64_t key;
+    };
+
+    auto const& seq_strategy = strategies::detail::sequential(strategy);
+
+    std::vector<entry> entries;
+    entries.reserve(boost::size(range));
+    box_t extent;
+    geometry::assign_inverse(extent);
+    for (auto it = boost::begin(range); it != boost::end(range); ++it)
+    {
+        if (! geometry::is_empty(*it))
+        {
+            entry e;
+            e.it = it;
+            geometry::envelope(*it, e.box, seq_strategy);
+            geometry::expand(extent, e.box, seq_strategy);
+            entries.push_back(std::move(e));
+        }
+    }
+
+    range::clear(out);
+    if (entries.empty())
+    {
+        return;
+    }
+
+    // Neighbours along the Hilbert curve are merged first
+    for (entry & e : entries)
+    {
+        e.key = detail::hilbert::box_index(e.box, extent);
+    }
+    std::stable_sort(entries.begin(), entries.end(), [](entry const& l, entry const& r)
+    {
+        return l.key < r.key;
+    });
+
+    // Bottom level, pairs of input geometries
+    std::vector<node_t> level((entries.size() + 1) / 2);
+    for_each_pair(entries.size() / 2, strategy, [&](std::size_t i, auto const& s)
+    {
+        entry const& e1 = entries[2 * i];
+        entry const& e2 = entries[2 * i + 1];
+        cascaded_union::merge(*e1.it, e1.box, *e2.it, e2.box, level[i], s);
+    });
+    if (entries.size() % 2 != 0)
+    {
+        cascaded_union::append(*entries.back().it, level.back().geometry);
+        level.back().box = entries.back().box;
+    }
+
+    // Upper levels, pairs of nodes
+    while (level.size() > 1)
+    {
+        std::vector<node_t> next((level.size() + 1) / 2);
+        for_each_pair(level.size() / 2, strategy, [&](std::size_t i, auto const& s)
+        {
+            cascaded_union::merge(level[2 * i], level[2 * i + 1], next[i], s);
+        });
+        if (level.size() % 2 != 0)
+        {
+            next.back() = std::move(level.back());
+        }
+        level = std::move(next);
+    }
+
+    out = std::move(level.front().geometry);
+}
+
+
+}} // namespace detail::cascaded_union
+#endif // DOXYGEN_NO_DETAIL
+
+
+namespace resolve_strategy
+{
+
+template <typename Strategy>
+struct cascaded_union
+{
+    template <typename Range, typename MultiPolygon>
+    static void apply(Range const& range, MultiPolygon & out, Strategy const& strategy)
+    {
+        detail::cascaded_union::apply(range, out, strategy);
+    }
+};
+
+template <>
+struct cascaded_union<default_strategy>
+{
+    template <typename Range, typename MultiPolygon>
+    static void apply(Range const& range, MultiPolygon & out, default_strategy)
+    {
+        using strategy_type = typename strategies::relate::services::default_strategy
+            <
+                MultiPolygon, MultiPolygon
+            >::type;
+
+        detail::cascaded_union::apply(range, out, strategy_type());
+    }
+};
+
+} // namespace resolve_strategy
+
+
+/*!
+\brief Calculates the union of all polygons or multi_polygons of a range
+\ingroup union
+\details The geometries are sorted along the Hilbert curve and merged
+    pairwise, so neighbours are merged first and the geometries merged
+    at each level of the reduction tree are of similar size. If the
+    envelopes of the merged geometries are disjoint their polygons are
+    gathered and the union is not calculated. If strategies::parallel
+    is passed the merges of each level are executed in parallel.
+\tparam Range range of polygons or multi_polygons
+\tparam MultiPolygon \tparam_geometry
+\tparam Strategy \tparam_strategy{Union_}
+\param range the range of geometries
+\param out the union of the geometries
+\param strategy \param_strategy{union_}
+
+\qbk{distinguish,with strategy}
+*/
+template <typename Range, typename MultiPolygon, typename Strategy>
+inline void cascaded_union(Range const& range, MultiPolygon & out, Strategy const& strategy)
+{
+    using geometry_type = typename boost::range_value<Range>::type;
+    BOOST_GEOMETRY_STATIC_ASSERT((util::is_polygon<geometry_type>::value
+                               || util::is_multi_polygon<geometry_type>::value),
+        "The range has to contain polygons or multi_polygons.",
+        geometry_type);
+    BOOST_GEOMETRY_STATIC_ASSERT((util::is_multi_polygon<MultiPolygon>::value),
+        "The output has to be a multi_polygon.",
+        MultiPolygon);
+
+    resolve_strategy::cascaded_union
+        <
+            Strategy
+        >::apply(range, out, strategy);
+}
+
+
+/*!
+\brief Calculates the union of all polygons or multi_polygons of a range
+\ingroup union
+\details See the version with strategy.
+\tparam Range range of polygons or multi_polygons
+\tparam MultiPolygon \tparam_geometry
+\param range the range of geometries
+\param out the union of the geometries
+*/
+template <typename Range, typename MultiPolygon>
+inline void cascaded_union(Range const& range, MultiPolygon & out)
+{
+    geometry::cascaded_union(range, out, default_strategy());
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_CASCADED_UNION_HPP
@@ -16,7 +16,10 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <set>
+#include <utility>
+#include <vector>
 
 #include <boost/core/ignore_unused.hpp>
 #include <boost/range/begin.hpp>
@@ -33,6 +36,7 @@
 #include <boost/geometry/algorithms/envelope.hpp>
 
 #include <boost/geometry/strategies/buffer.hpp>
+#include <boost/geometry/strategies/parallel.hpp>
 
 #include <boost/geometry/geometries/ring.hpp>
 
@@ -40,6 +44,7 @@
 #include <boost/geometry/algorithms/detail/buffer/buffer_policies.hpp>
 #include <boost/geometry/algorithms/detail/overlay/cluster_info.hpp>
 #include <boost/geometry/algorithms/detail/buffer/get_piece_turns.hpp>
+#include <boost/geometry/algorithms/detail/buffer/parallel_visit.hpp>
 #include <boost/geometry/algorithms/detail/buffer/piece_border.hpp>
 #include <boost/geometry/algorithms/detail/buffer/turn_in_piece_visitor.hpp>
 #include <boost/geometry/algorithms/detail/buffer/turn_in_original_visitor.hpp>
@@ -59,6 +64,7 @@
 #include <boost/geometry/algorithms/detail/sections/section_box_policies.hpp>
 
 #include <boost/geometry/views/detail/closed_clockwise_view.hpp>
+#include <boost/geometry/util/parallel.hpp>
 #include <boost/geometry/util/range.hpp>
 
 
@@ -366,22 +372,51 @@ struct buffered_piece_collection
     // Check if a turn is inside any of the originals
     inline void check_turn_in_original()
     {
-        turn_in_original_visitor
+        typedef turn_in_original_visitor
             <
                 turn_vector_type,
                 Strategy
-            > visitor(m_turns, m_strategy);
+            > visitor_type;
+        visitor_type visitor(m_turns, m_strategy);
 
-        geometry::partition
-            <
-                box_type,
-                include_turn_policy,
-                detail::partition::include_all_policy
-            >::apply(m_turns, original_rings, visitor,
-                     turn_get_box<Strategy>(m_strategy),
-                     turn_in_original_overlaps_box<Strategy>(m_strategy),
-                     original_get_box<Strategy>(m_strategy),
-                     original_overlaps_box<Strategy>(m_strategy));
+        std::size_t const threads = strategies::detail::threads(m_strategy);
+        if (threads > 1)
+        {
+            typedef collect_pairs_visitor
+                <
+                    visitor_type, buffer_turn_info_type, original_ring
+                > collect_visitor;
+            typename collect_visitor::pairs_type pairs;
+            collect_visitor collect(visitor, pairs);
+
+            geometry::partition
+                <
+                    box_type,
+                    include_turn_policy,
+                    detail::partition::include_all_policy
+                >::apply(m_turns, original_rings, collect,
+                         turn_get_box<Strategy>(m_strategy),
+                         turn_in_original_overlaps_box<Strategy>(m_strategy),
+                         original_get_box<Strategy>(m_strategy),
+                         original_overlaps_box<Strategy>(m_strategy));
+
+            turn_visits<original_ring> visits;
+            visits.assign(pairs, m_turns.size());
+            visit_turns_in_parallel(m_turns, visits, visitor, threads);
+        }
+        else
+        {
+            geometry::partition
+                <
+                    box_type,
+                    include_turn_policy,
+                    detail::partition::include_all_policy
+                >::apply(m_turns, original_rings, visitor,
+                         turn_get_box<Strategy>(m_strategy),
+                         turn_in_original_overlaps_box<Strategy>(m_strategy),
+                         original_get_box<Strategy>(m_strategy),
+                         original_overlaps_box<Strategy>(m_strategy));
+        }
 
         bool const deflate = m_distance_strategy.negative();
 
@@ -465,46 +500,133 @@ struct buffered_piece_collection
     {
         update_piece_administration();
 
+        std::size_t const threads = strategies::detail::threads(m_strategy);
+
         {
             // Calculate the turns
-            piece_turn_visitor
+            typedef piece_turn_visitor
                 <
                     piece_vector_type,
                     buffered_ring_collection<buffered_ring<Ring> >,
                     turn_vector_type,
                     Strategy,
                     RobustPolicy
-                > visitor(m_pieces, offsetted_rings, m_turns,
-                          m_strategy, m_robust_policy);
+                > visitor_type;
 
             detail::sectionalize::enlarge_sections(monotonic_sections, m_strategy);
 
-            geometry::partition
-                <
-                    robust_box_type
-                >::apply(monotonic_sections, visitor,
-                         detail::section::get_section_box<Strategy>(m_strategy),
-                         detail::section::overlaps_section_box<Strategy>(m_strategy));
+            if (threads > 1)
+            {
+                get_piece_turns_parallel<visitor_type>(threads);
+            }
+            else
+            {
+                visitor_type visitor(m_pieces, offsetted_rings, m_turns,
+                                     m_strategy, m_robust_policy);
+
+                geometry::partition
+                    <
+                        robust_box_type
+                    >::apply(monotonic_sections, visitor,
+                             detail::section::get_section_box<Strategy>(m_strategy),
+                             detail::section::overlaps_section_box<Strategy>(m_strategy));
+            }
         }
 
         update_turn_administration();
 
         {
             // Check if turns are inside pieces
-            turn_in_piece_visitor
+            typedef turn_in_piece_visitor
                 <
                     typename geometry::cs_tag<point_type>::type,
                     turn_vector_type, piece_vector_type, DistanceStrategy, Strategy
-                > visitor(m_turns, m_pieces, m_distance_strategy, m_strategy);
+                > visitor_type;
+            visitor_type visitor(m_turns, m_pieces, m_distance_strategy, m_strategy);
+
+            if (threads > 1)
+            {
+                typedef collect_pairs_visitor
+                    <
+                        visitor_type, buffer_turn_info_type, piece
+                    > collect_visitor;
+                typename collect_visitor::pairs_type pairs;
+                collect_visitor collect(visitor, pairs);
+
+                geometry::partition
+                    <
+                        box_type
+                    >::apply(m_turns, m_pieces, collect,
+                             turn_get_box<Strategy>(m_strategy),
+                             turn_overlaps_box<Strategy>(m_strategy),
+                             piece_get_box<Strategy>(m_strategy),
+                             piece_overlaps_box<Strategy>(m_strategy));
+
+                turn_visits<piece> visits;
+                visits.assign(pairs, m_turns.size());
+                visit_turns_in_parallel(m_turns, visits, visitor, threads);
+            }
+            else
+            {
+                geometry::partition
+                    <
+                        box_type
+                    >::apply(m_turns, m_pieces, visitor,
+                             turn_get_box<Strategy>(m_strategy),
+                             turn_overlaps_box<Strategy>(m_strategy),
+                             piece_get_box<Strategy>(m_strategy),
+                             piece_overlaps_box<Strategy>(m_strategy));
+            }
+        }
+    }
+
+    // The pairs of sections are collected in the order in which they are
+    // visited by partition. Then the turns are calculated for consecutive
+    // chunks of pairs in parallel and appended in the order of chunks,
+    // so they are the same and in the same order as in the sequential version.
+    template <typename Visitor>
+    inline void get_piece_turns_parallel(std::size_t threads)
+    {
+        typedef typename boost::range_value<robust_sections_type>::type section_type;
+        typedef collect_pairs_visitor
+            <
+                Visitor, section_type, section_type
+            > collect_visitor;
+
+        typename collect_visitor::pairs_type pairs;
+        {
+            Visitor visitor(m_pieces, offsetted_rings, m_turns,
+                            m_strategy, m_robust_policy);
+            collect_visitor collect(visitor, pairs);
 
             geometry::partition
                 <
-                    box_type
-                >::apply(m_turns, m_pieces, visitor,
-                         turn_get_box<Strategy>(m_strategy),
-                         turn_overlaps_box<Strategy>(m_strategy),
-                         piece_get_box<Strategy>(m_strategy),
-                         piece_overlaps_box<Strategy>(m_strategy));
+                    robust_box_type
+                >::apply(monotonic_sections, collect,
+                         detail::section::get_section_box<Strategy>(m_strategy),
+                         detail::section::overlaps_section_box<Strategy>(m_strategy));
+        }
+
+        // More chunks than threads to balance the load
+        std::size_t const chunks = (std::min)(pairs.size(), threads * 8);
+        std::vector<turn_vector_type> chunk_turns(chunks);
+
+        geometry::detail::parallel::for_each_index(chunks, threads, [&](std::size_t c)
+        {
+            Visitor visitor(m_pieces, offsetted_rings, chunk_turns[c],
+                            m_strategy, m_robust_policy);
+
+            std::size_t const first = pairs.size() * c / chunks;
+            std::size_t const last = pairs.size() * (c + 1) / chunks;
+            for (std::size_t i = first ; i < last ; ++i)
+            {
+                visitor.apply(*pairs[i].first, *pairs[i].second);
+            }
+        });
+
+        for (turn_vector_type & chunk : chunk_turns)
+        {
+            std::move(chunk.begin(), chunk.end(), std::back_inserter(m_turns));
         }
     }
 
@@ -292,27 +292,36 @@ public:
         , m_robust_policy(robust_policy)
     {}
 
+    // Returns false if there are no turns to calculate for the sections
     template <typename Section>
-    inline bool apply(Section const& section1, Section const& section2,
-                    bool first = true)
+    inline bool is_candidate(Section const& section1, Section const& section2) const
     {
-        boost::ignore_unused(first);
-
         typedef typename boost::range_value<Pieces const>::type piece_type;
         piece_type const& piece1 = m_pieces[section1.ring_id.source_index];
         piece_type const& piece2 = m_pieces[section2.ring_id.source_index];
 
-        if ( piece1.index == piece2.index
-          || is_adjacent(piece1, piece2)
-          || is_on_same_convex_ring(piece1, piece2)
-          || detail::disjoint::disjoint_box_box(section1.bounding_box,
-                                                section2.bounding_box,
-                                                m_strategy) )
+        return ! ( piece1.index == piece2.index
+                || is_adjacent(piece1, piece2)
+                || is_on_same_convex_ring(piece1, piece2)
+                || detail::disjoint::disjoint_box_box(section1.bounding_box,
+                                                      section2.bounding_box,
+                                                      m_strategy) );
+    }
+
+    template <typename Section>
+    inline bool apply(Section const& section1, Section const& section2,
+                    bool first = true)
+    {
+        boost::ignore_unused(first);
+
+        if (! is_candidate(section1, section2))
         {
             return true;
         }
 
-        calculate_turns(piece1, piece2, section1, section2);
+        calculate_turns(m_pieces[section1.ring_id.source_index],
+                        m_pieces[section2.ring_id.source_index],
+                        section1, section2);
 
         return true;
     }
@@ -127,6 +127,29 @@ struct buffer_all
                 Input
             >::type strategies;
 
+        apply(geometry_in, geometry_out, distance_strategy, side_strategy,
+              join_strategy, end_strategy, point_strategy, strategies);
+    }
+
+    template
+    <
+        typename Output,
+        typename DistanceStrategy,
+        typename SideStrategy,
+        typename JoinStrategy,
+        typename EndStrategy,
+        typename PointStrategy,
+        typename Strategies
+    >
+    static inline void apply(Input const& geometry_in,
+                             Output& geometry_out,
+                             DistanceStrategy const& distance_strategy,
+                             SideStrategy const& side_strategy,
+                             JoinStrategy const& join_strategy,
+                             EndStrategy const& end_strategy,
+                             PointStrategy const& point_strategy,
+                             Strategies const& strategies)
+    {
         dispatch::buffer_all
             <
                 Input, Output
@@ -164,6 +187,35 @@ struct buffer_all<Input, dynamic_geometry_tag>
                          join_strategy, end_strategy, point_strategy);
         }, geometry_in);
     }
+
+    template
+    <
+        typename Output,
+        typename DistanceStrategy,
+        typename SideStrategy,
+        typename JoinStrategy,
+        typename EndStrategy,
+        typename PointStrategy,
+        typename Strategies
+    >
+    static inline void apply(Input const& geometry_in,
+                             Output& geometry_out,
+                             DistanceStrategy const& distance_strategy,
+                             SideStrategy const& side_strategy,
+                             JoinStrategy const& join_strategy,
+                             EndStrategy const& end_strategy,
+                             PointStrategy const& point_strategy,
+                             Strategies const& strategies)
+    {
+        traits::visit<Input>::apply([&](auto const& g)
+        {
+            buffer_all
+                <
+                    util::remove_cref_t<decltype(g)>
+                >::apply(g, geometry_out, distance_strategy, side_strategy,
+                         join_strategy, end_strategy, point_strategy, strategies);
+        }, geometry_in);
+    }
 };
 
 } // namespace resolve_dynamic
@@ -273,6 +325,65 @@ inline void buffer(GeometryIn const& geometry_in,
                  join_strategy, end_strategy, point_strategy);
 }
 
+/*!
+\brief \brief_calc{buffer}
+\ingroup buffer
+\details \details_calc{buffer, \det_buffer}. The umbrella strategy may be
+    wrapped in strategies::parallel to calculate the turns between the pieces
+    and to check whether they are inside pieces and originals in parallel.
+    The output is the same as the output of the sequential calculation.
+\tparam GeometryIn \tparam_geometry
+\tparam GeometryOut \tparam_geometry{GeometryOut}
+\tparam DistanceStrategy A strategy defining distance (or radius)
+\tparam SideStrategy A strategy defining creation along sides
+\tparam JoinStrategy A strategy defining creation around convex corners
+\tparam EndStrategy A strategy defining creation at linestring ends
+\tparam PointStrategy A strategy defining creation around points
+\tparam Strategies An umbrella strategy, e.g. strategies::buffer::cartesian<>
+\param geometry_in \param_geometry
+\param geometry_out output geometry, e.g. multi polygon,
+       will contain a buffered version of the input geometry
+\param distance_strategy The distance strategy to be used
+\param side_strategy The side strategy to be used
+\param join_strategy The join strategy to be used
+\param end_strategy The end strategy to be used
+\param point_strategy The point strategy to be used
+\param strategies The umbrella strategy to be used
+
+\qbk{distinguish,with strategies and umbrella strategy}
+ */
+template
+<
+    typename GeometryIn,
+    typename GeometryOut,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy,
+    typename Strategies
+>
+inline void buffer(GeometryIn const& geometry_in,
+                   GeometryOut& geometry_out,
+                   DistanceStrategy const& distance_strategy,
+                   SideStrategy const& side_strategy,
+                   JoinStrategy const& join_strategy,
+                   EndStrategy const& end_strategy,
+                   PointStrategy const& point_strategy,
+                   Strategies const& strategies)
+{
+    concepts::check<GeometryIn const>();
+    concepts::check<GeometryOut>();
+
+    geometry::clear(geometry_out);
+
+    resolve_dynamic::buffer_all
+        <
+            GeometryIn, GeometryOut
+        >::apply(geometry_in, geometry_out, distance_strategy, side_strategy,
+                 join_strategy, end_strategy, point_strategy, strategies);
+}
+
 
 }} // namespace boost::geometry
 
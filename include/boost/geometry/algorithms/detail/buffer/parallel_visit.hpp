@@ -0,0 +1,159 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_PARALLEL_VISIT_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_PARALLEL_VISIT_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/util/parallel.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace buffer
+{
+
+
+// Collects the pairs of items for which the visitor has to be called,
+// in the order in which partition visits them
+template <typename Visitor, typename Item1, typename Item2>
+struct collect_pairs_visitor
+{
+    typedef std::vector<std::pair<Item1 const*, Item2 const*> > pairs_type;
+
+    collect_pairs_visitor(Visitor const& visitor, pairs_type& pairs)
+        : m_visitor(visitor)
+        , m_pairs(pairs)
+    {}
+
+    inline bool apply(Item1 const& item1, Item2 const& item2, bool = true)
+    {
+        if (m_visitor.is_candidate(item1, item2))
+        {
+            m_pairs.push_back(std::make_pair(&item1, &item2));
+        }
+        return true;
+    }
+
+    Visitor const& m_visitor;
+    pairs_type& m_pairs;
+};
+
+// The pairs of turns and items visited by partition, grouped by turn
+template <typename Item>
+struct turn_visits
+{
+    // The pairs grouped by turn, the global position of each pair is kept
+    std::vector<std::pair<std::size_t, Item const*> > entries;
+    // Offsets of the groups in entries, one more than the number of turns
+    std::vector<std::size_t> offsets;
+
+    // Collected pairs (turn, item), the turns are given by their turn_index
+    template <typename Turn>
+    inline void assign(std::vector<std::pair<Turn const*, Item const*> > const& pairs,
+                       std::size_t turn_count)
+    {
+        offsets.assign(turn_count + 1, 0);
+        for (auto const& pair : pairs)
+        {
+            ++offsets[pair.first->turn_index + 1];
+        }
+        for (std::size_t i = 1 ; i < offsets.size() ; ++i)
+        {
+            offsets[i] += offsets[i - 1];
+        }
+
+        std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+        entries.resize(pairs.size());
+        for (std::size_t i = 0 ; i < pairs.size() ; ++i)
+        {
+            std::size_t const t = pairs[i].first->turn_index;
+            entries[next[t]++] = std::make_pair(i, pairs[i].second);
+        }
+    }
+};
+
+// Calls the visitor for the pairs of turns and items, with the same results
+// as calling it sequentially in the order in which the pairs were visited.
+// Visitors may only modify the turn they are called for, so the pairs of
+// different turns are processed in parallel and the ones of the same turn
+// in their original order. If a visitor returns false partition stops,
+// so the turns marked as not traversable by the pairs visited later are
+// restored. The only modification of such visitors has to be the marking.
+template <typename Turns, typename Item, typename Visitor>
+inline void visit_turns_in_parallel(Turns& turns, turn_visits<Item> const& visits,
+                                    Visitor const& visitor, std::size_t threads)
+{
+    std::size_t const npos = std::size_t(-1);
+    std::size_t const turn_count = boost::size(turns);
+    if (turn_count == 0)
+    {
+        return;
+    }
+
+    std::size_t const chunks = (std::min)(turn_count, threads * 8);
+
+    // The position of the pair which stopped the visits or marked the turn
+    std::vector<std::size_t> stopped(turn_count, npos);
+    std::vector<std::size_t> marked(turn_count, npos);
+
+    geometry::detail::parallel::for_each_index(chunks, threads, [&](std::size_t c)
+    {
+        Visitor chunk_visitor = visitor;
+        std::size_t const first = turn_count * c / chunks;
+        std::size_t const last = turn_count * (c + 1) / chunks;
+        for (std::size_t t = first ; t < last ; ++t)
+        {
+            auto const& turn = turns[t];
+            for (std::size_t e = visits.offsets[t] ; e < visits.offsets[t + 1] ; ++e)
+            {
+                bool const traversable = turn.is_turn_traversable;
+                if (! chunk_visitor.apply(turn, *visits.entries[e].second))
+                {
+                    stopped[t] = visits.entries[e].first;
+                    break;
+                }
+                if (traversable && ! turn.is_turn_traversable)
+                {
+                    marked[t] = visits.entries[e].first;
+                }
+            }
+        }
+    });
+
+    std::size_t const stop = *std::min_element(stopped.begin(), stopped.end());
+    if (stop != npos)
+    {
+        for (std::size_t t = 0 ; t < turn_count ; ++t)
+        {
+            if (marked[t] != npos && marked[t] > stop)
+            {
+                turns[t].is_turn_traversable = true;
+            }
+        }
+    }
+}
+
+
+}} // namespace detail::buffer
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_PARALLEL_VISIT_HPP
@@ -234,6 +234,17 @@ public:
         , m_strategy(strategy)
     {}
 
+    // Returns false if apply() does nothing for the turn and the original,
+    // also if it's called later, after other originals were visited
+    template <typename Turn, typename Original>
+    inline bool is_candidate(Turn const& turn, Original const& original) const
+    {
+        return ! boost::empty(original.m_ring)
+            && turn.is_turn_traversable
+            && ! turn.within_original
+            && ! geometry::disjoint(turn.point, original.m_box, m_strategy);
+    }
+
     template <typename Turn, typename Original>
     inline bool apply(Turn const& turn, Original const& original)
     {
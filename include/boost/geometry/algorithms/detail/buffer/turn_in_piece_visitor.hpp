@@ -105,6 +105,34 @@ public:
         , m_umbrella_strategy(umbrella_strategy)
     {}
 
+    // Returns false if apply() does nothing for the turn and the piece,
+    // also if it's called later, after other pieces were visited
+    template <typename Turn, typename Piece>
+    inline bool is_candidate(Turn const& turn, Piece const& piece) const
+    {
+        if (! turn.is_turn_traversable)
+        {
+            // Already handled
+            return false;
+        }
+
+        if (piece.type == strategy::buffer::buffered_flat_end
+            || piece.type == strategy::buffer::buffered_concave)
+        {
+            // Turns cannot be located within flat-end or concave pieces
+            return false;
+        }
+
+        if (skip(turn.operations[0], piece) || skip(turn.operations[1], piece))
+        {
+            return false;
+        }
+
+        // Easy check: if turn is not in the (expanded) envelope
+        return geometry::covered_by(turn.point, piece.m_piece_border.m_envelope,
+                                    m_umbrella_strategy);
+    }
+
     template <typename Turn, typename Piece>
     inline bool apply(Turn const& turn, Piece const& piece)
     {
@@ -23,9 +23,12 @@
 #include <algorithm>
 #include <vector>
 
+#include <boost/geometry/algorithms/detail/convert_point_to_point.hpp>
 #include <boost/geometry/algorithms/detail/for_each_range.hpp>
+#include <boost/geometry/core/access.hpp>
 #include <boost/geometry/core/assert.hpp>
 #include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
 #include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/core/point_type.hpp>
 #include <boost/geometry/core/point_order.hpp>
@@ -33,8 +36,11 @@
 #include <boost/geometry/strategies/convex_hull/cartesian.hpp>
 #include <boost/geometry/strategies/convex_hull/geographic.hpp>
 #include <boost/geometry/strategies/convex_hull/spherical.hpp>
+#include <boost/geometry/strategies/parallel.hpp>
 
+#include <boost/geometry/util/parallel.hpp>
 #include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
 
 
 namespace boost { namespace geometry
@@ -108,17 +114,111 @@ inline void get_extremes(InputProxy const& in_proxy,
 }
 
 
-template <typename InputProxy, typename Point, typename Container, typename SideStrategy>
+// Akl-Toussaint heuristic. The extreme points in the directions x + y and
+// x - y are found. A point having one of them in each of its four open
+// quadrants is in the interior of their convex hull so it can't be a point
+// of the hull. Such points are the points in the interior of the rectangle
+// inscribed in the octagon of the extreme points. The test consists only of
+// comparisons of coordinates so it is exact and cheap. Only in cartesian CS.
+template <typename Point, typename CSTag = typename cs_tag<Point>::type>
+class interior_filter
+{
+public:
+    template <typename InputProxy>
+    explicit interior_filter(InputProxy const&)
+    {}
+
+    template <typename P>
+    inline bool operator()(P const&) const
+    {
+        return false;
+    }
+};
+
+template <typename Point>
+class interior_filter<Point, cartesian_tag>
+{
+    typedef typename coordinate_type<Point>::type coor_t;
+    typedef typename select_most_precise<coor_t, double>::type calc_t;
+
+public:
+    template <typename InputProxy>
+    explicit interior_filter(InputProxy const& in_proxy)
+        : m_empty(true)
+    {
+        // Lower left, lower right, upper right and upper left
+        Point corners[4];
+        calc_t values[4] = { 0, 0, 0, 0 };
+        bool first = true;
+
+        in_proxy.for_each_range([&](auto const& range)
+        {
+            for (auto it = boost::begin(range); it != boost::end(range); ++it)
+            {
+                calc_t const x = geometry::get<0>(*it);
+                calc_t const y = geometry::get<1>(*it);
+                calc_t const current[4] = { -x - y, x - y, x + y, y - x };
+                for (int i = 0 ; i < 4 ; i++)
+                {
+                    if (first || current[i] > values[i])
+                    {
+                        geometry::detail::conversion::convert_point_to_point(*it, corners[i]);
+                        values[i] = current[i];
+                    }
+                }
+                first = false;
+            }
+        });
+
+        if (first)
+        {
+            return;
+        }
+
+        m_min_x = (std::max)(get<0>(corners[0]), get<0>(corners[3]));
+        m_max_x = (std::min)(get<0>(corners[1]), get<0>(corners[2]));
+        m_min_y = (std::max)(get<1>(corners[0]), get<1>(corners[1]));
+        m_max_y = (std::min)(get<1>(corners[2]), get<1>(corners[3]));
+        m_empty = ! (m_min_x < m_max_x && m_min_y < m_max_y);
+    }
+
+    template <typename P>
+    inline bool operator()(P const& point) const
+    {
+        coor_t const x = geometry::get<0>(point);
+        coor_t const y = geometry::get<1>(point);
+        return ! m_empty
+            && m_min_x < x && x < m_max_x
+            && m_min_y < y && y < m_max_y;
+    }
+
+private:
+    bool m_empty;
+    coor_t m_min_x, m_max_x, m_min_y, m_max_y;
+};
+
+
+template
+<
+    typename InputProxy, typename Point, typename Container,
+    typename SideStrategy, typename Filter
+>
 inline void assign_ranges(InputProxy const& in_proxy,
                           Point const& most_left, Point const& most_right,
                           Container& lower_points, Container& upper_points,
-                          SideStrategy const& side)
+                          SideStrategy const& side, Filter const& is_interior)
 {
     in_proxy.for_each_range([&](auto const& range)
     {
         // Put points in one of the two output sequences
         for (auto it = boost::begin(range); it != boost::end(range); ++it)
         {
+            // the points in the interior are never part of hull
+            if (is_interior(*it))
+            {
+                continue;
+            }
+
             // check if it is lying most_left or most_right from the line
 
             int dir = side.apply(most_left, most_right, *it);
@@ -203,22 +303,39 @@ private:
 
         // Bounding left/right points
         // Second pass, now that extremes are found, assign all points
-        // in either lower, either upper
+        // in either lower, either upper, except the points in the interior
         detail::convex_hull::assign_ranges(in_proxy, most_left, most_right,
                               lower_points, upper_points,
-                              side_strategy);
-
-        // Sort both collections, first on x(, then on y)
-        std::sort(boost::begin(lower_points), boost::end(lower_points), less);
-        std::sort(boost::begin(upper_points), boost::end(upper_points), less);
-
-        // And decide which point should be in the final hull
-        build_half_hull<-1>(lower_points, state.m_lower_hull,
-                            most_left, most_right,
-                            side_strategy);
-        build_half_hull<1>(upper_points, state.m_upper_hull,
-                           most_left, most_right,
-                           side_strategy);
+                              side_strategy,
+                              interior_filter<point_type>(in_proxy));
+
+        // The halves are processed in parallel, each of them sorted with
+        // the half of threads. The result is the same.
+        std::size_t const threads = strategies::detail::threads(strategy);
+        std::size_t const half_threads = (std::max)(threads / 2, std::size_t(1));
+
+        geometry::detail::parallel::fork_join([&]()
+        {
+            // Sort both collections, first on x(, then on y)
+            geometry::detail::parallel::sort(boost::begin(lower_points),
+                                             boost::end(lower_points),
+                                             less, half_threads);
+
+            // And decide which point should be in the final hull
+            build_half_hull<-1>(lower_points, state.m_lower_hull,
+                                most_left, most_right,
+                                side_strategy);
+        },
+        [&]()
+        {
+            geometry::detail::parallel::sort(boost::begin(upper_points),
+                                             boost::end(upper_points),
+                                             less, half_threads);
+
+            build_half_hull<1>(upper_points, state.m_upper_hull,
+                               most_left, most_right,
+                               side_strategy);
+        }, threads > 1);
     }
 
     template <int Factor, typename SideStrategy>
@@ -0,0 +1,209 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_HILBERT_INDEX_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_HILBERT_INDEX_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace hilbert
+{
+
+
+// Order of the curve, the grid has 2^order x 2^order cells
+static const unsigned int default_order = 16;
+
+
+// The highest order for which the index of a cell in Dimension dimensions
+// fits in 64 bits
+template <std::size_t Dimension>
+struct max_order
+    : std::integral_constant
+        <
+            unsigned int,
+            (64 / Dimension >= 32 ? 32 : 64 / Dimension > 0 ? 64 / Dimension : 1)
+        >
+{};
+
+
+// Returns the position of the cell x along the Hilbert curve filling the grid
+// of 2^order cells in each of Dimension dimensions, Dimension * order must
+// not be greater than 64. The coordinates are transformed with the algorithm
+// of J. Skilling, "Programming the Hilbert curve", AIP Conference
+// Proceedings 707, 2004, and their bits are interleaved.
+template <std::size_t Dimension>
+inline std::uint64_t index(std::uint32_t (&x)[Dimension],
+                           unsigned int order = default_order)
+{
+    std::uint32_t const m = std::uint32_t(1) << (order - 1);
+
+    // Inverse undo
+    for (std::uint32_t q = m ; q > 1 ; q >>= 1)
+    {
+        std::uint32_t const p = q - 1;
+        for (std::size_t i = 0 ; i < Dimension ; ++i)
+        {
+            if (x[i] & q)
+            {
+                x[0] ^= p;
+            }
+            else
+            {
+                std::uint32_t const t = (x[0] ^ x[i]) & p;
+                x[0] ^= t;
+                x[i] ^= t;
+            }
+        }
+    }
+
+    // Gray encode
+    for (std::size_t i = 1 ; i < Dimension ; ++i)
+    {
+        x[i] ^= x[i - 1];
+    }
+    std::uint32_t t = 0;
+    for (std::uint32_t q = m ; q > 1 ; q >>= 1)
+    {
+        if (x[Dimension - 1] & q)
+        {
+            t ^= q - 1;
+        }
+    }
+    for (std::size_t i = 0 ; i < Dimension ; ++i)
+    {
+        x[i] ^= t;
+    }
+
+    // Interleave the bits, the most significant first
+    std::uint64_t result = 0;
+    for (unsigned int b = order ; b > 0 ; --b)
+    {
+        for (std::size_t i = 0 ; i < Dimension ; ++i)
+        {
+            result = (result << 1) | ((x[i] >> (b - 1)) & 1u);
+        }
+    }
+    return result;
+}
+
+// Returns the position of the cell (x, y) along the Hilbert curve filling
+// the grid of 2^order x 2^order cells
+inline std::uint64_t index(std::uint32_t x, std::uint32_t y,
+                           unsigned int order = default_order)
+{
+    std::uint32_t cell[2] = { x, y };
+    return index(cell, order);
+}
+
+
+// Returns the cell in [0, 2^order) containing the value in [min, max]
+inline std::uint32_t cell(double value, double min, double max,
+                          unsigned int order = default_order)
+{
+    std::uint64_t const count = std::uint64_t(1) << order;
+    double const cells = double(count);
+    double const c = max > min ? (value - min) / (max - min) * cells : 0.0;
+    return c <= 0.0 ? 0
+         : c >= cells ? std::uint32_t(count - 1)
+         : std::uint32_t(c);
+}
+
+
+template <std::size_t I, std::size_t Dimension>
+struct point_cells
+{
+    template <typename Point, typename Extent>
+    static inline void apply(Point const& point, Extent const& extent,
+                             std::uint32_t (&x)[Dimension], unsigned int order)
+    {
+        x[I] = cell(double(geometry::get<I>(point)),
+                    double(geometry::get<min_corner, I>(extent)),
+                    double(geometry::get<max_corner, I>(extent)),
+                    order);
+        point_cells<I + 1, Dimension>::apply(point, extent, x, order);
+    }
+};
+
+template <std::size_t Dimension>
+struct point_cells<Dimension, Dimension>
+{
+    template <typename Point, typename Extent>
+    static inline void apply(Point const& , Extent const& ,
+                             std::uint32_t (&)[Dimension], unsigned int )
+    {}
+};
+
+template <std::size_t I, std::size_t Dimension>
+struct box_cells
+{
+    template <typename Box, typename Extent>
+    static inline void apply(Box const& box, Extent const& extent,
+                             std::uint32_t (&x)[Dimension], unsigned int order)
+    {
+        double const center = (double(geometry::get<min_corner, I>(box))
+                             + double(geometry::get<max_corner, I>(box))) / 2.0;
+        x[I] = cell(center,
+                    double(geometry::get<min_corner, I>(extent)),
+                    double(geometry::get<max_corner, I>(extent)),
+                    order);
+        box_cells<I + 1, Dimension>::apply(box, extent, x, order);
+    }
+};
+
+template <std::size_t Dimension>
+struct box_cells<Dimension, Dimension>
+{
+    template <typename Box, typename Extent>
+    static inline void apply(Box const& , Extent const& ,
+                             std::uint32_t (&)[Dimension], unsigned int )
+    {}
+};
+
+
+// Returns the position along the Hilbert curve of the point within the extent
+template <typename Point, typename Extent>
+inline std::uint64_t point_index(Point const& point, Extent const& extent,
+                                 unsigned int order = default_order)
+{
+    static const std::size_t dimension = geometry::dimension<Point>::value;
+    std::uint32_t x[dimension];
+    point_cells<0, dimension>::apply(point, extent, x, order);
+    return index(x, order);
+}
+
+
+// Returns the position along the Hilbert curve of the center of the box
+// within the extent
+template <typename Box, typename Extent>
+inline std::uint64_t box_index(Box const& box, Extent const& extent,
+                               unsigned int order = default_order)
+{
+    static const std::size_t dimension = geometry::dimension<Box>::value;
+    std::uint32_t x[dimension];
+    box_cells<0, dimension>::apply(box, extent, x, order);
+    return index(x, order);
+}
+
+
+}} // namespace detail::hilbert
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_HILBERT_INDEX_HPP
@@ -0,0 +1,72 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Licensed under the Boost Software License version 1.0.
+// http://www.boost.org/users/license.html
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_CONCURRENT_VISITOR_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_CONCURRENT_VISITOR_HPP
+
+#include <boost/geometry/policies/is_valid/default_policy.hpp>
+#include <boost/geometry/policies/is_valid/failing_reason_policy.hpp>
+#include <boost/geometry/policies/is_valid/failure_type_policy.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace is_valid
+{
+
+
+// The visitor which can be used by a thread checking a part of a geometry
+// concurrently with other threads. It has to accept the same failures as
+// VisitPolicy. The part failing first is checked again with the original
+// visitor so the result passed to the user is the same as in the sequential
+// version. type is void if the parts can only be checked sequentially.
+template <typename VisitPolicy>
+struct concurrent_visitor
+{
+    typedef void type;
+};
+
+template <bool AllowDuplicates, bool AllowSpikes>
+struct concurrent_visitor
+    <
+        is_valid_default_policy<AllowDuplicates, AllowSpikes>
+    >
+{
+    typedef is_valid_default_policy<AllowDuplicates, AllowSpikes> type;
+};
+
+template <bool AllowDuplicates, bool AllowSpikes>
+struct concurrent_visitor
+    <
+        failure_type_policy<AllowDuplicates, AllowSpikes>
+    >
+{
+    typedef failure_type_policy<AllowDuplicates, AllowSpikes> type;
+};
+
+// The messages are written to the stream shared by all copies of the policy
+// so only the failure type is tracked concurrently.
+template <bool AllowDuplicates, bool AllowSpikes>
+struct concurrent_visitor
+    <
+        failing_reason_policy<AllowDuplicates, AllowSpikes>
+    >
+{
+    typedef failure_type_policy<AllowDuplicates, AllowSpikes> type;
+};
+
+
+}} // namespace detail::is_valid
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_CONCURRENT_VISITOR_HPP
@@ -12,11 +12,15 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_MULTIPOLYGON_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_MULTIPOLYGON_HPP
 
+#include <cstddef>
 #include <deque>
+#include <set>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <boost/core/ignore_unused.hpp>
-#include <boost/iterator/filter_iterator.hpp>
+#include <boost/iterator/indirect_iterator.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
 #include <boost/range/size.hpp>
@@ -28,6 +32,7 @@
 #include <boost/geometry/core/tags.hpp>
 
 #include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/parallel.hpp>
 #include <boost/geometry/util/range.hpp>
 
 #include <boost/geometry/geometries/box.hpp>
@@ -37,6 +42,7 @@
 
 #include <boost/geometry/algorithms/detail/partition.hpp>
 
+#include <boost/geometry/algorithms/detail/is_valid/concurrent_visitor.hpp>
 #include <boost/geometry/algorithms/detail/is_valid/has_valid_self_turns.hpp>
 #include <boost/geometry/algorithms/detail/is_valid/is_acceptable_turn.hpp>
 #include <boost/geometry/algorithms/detail/is_valid/polygon.hpp>
@@ -47,6 +53,7 @@
 #include <boost/geometry/algorithms/dispatch/is_valid.hpp>
 
 #include <boost/geometry/strategies/intersection.hpp>
+#include <boost/geometry/strategies/parallel.hpp>
 
 
 namespace boost { namespace geometry
@@ -75,6 +82,24 @@ private:
 
 
 
+    template <typename Item>
+    struct item_pairs_visitor
+    {
+        explicit item_pairs_visitor(std::vector<std::pair<Item const*, Item const*> >& pairs)
+            : m_pairs(pairs)
+        {}
+
+        inline bool apply(Item const& item1, Item const& item2)
+        {
+            m_pairs.push_back(std::make_pair(&item1, &item2));
+            return true;
+        }
+
+        std::vector<std::pair<Item const*, Item const*> >& m_pairs;
+    };
+
+
+
     template
     <
         typename PolygonIterator,
@@ -118,17 +143,56 @@ private:
             }
         }
 
-        // call partition to check if polygons are disjoint from each other
-        typename base::template item_visitor_type<Strategy> item_visitor(strategy);
+        std::size_t const threads = strategies::detail::threads(strategy);
+        bool items_overlap = false;
 
-        geometry::partition
-            <
-                geometry::model::box<typename point_type<MultiPolygon>::type>
-            >::apply(polygon_iterators, item_visitor,
-                     typename base::template expand_box<Strategy>(strategy),
-                     typename base::template overlaps_box<Strategy>(strategy));
+        if (threads > 1)
+        {
+            // collect the pairs of polygons visited by partition and check
+            // them in parallel, the order doesn't matter for the result
+            std::vector<std::pair<item_type const*, item_type const*> > pairs;
+            item_pairs_visitor<item_type> pairs_visitor(pairs);
+
+            geometry::partition
+                <
+                    box_type
+                >::apply(polygon_iterators, pairs_visitor,
+                         typename base::template expand_box<Strategy>(strategy),
+                         typename base::template overlaps_box<Strategy>(strategy));
+
+            auto const& sequential_strategy = strategies::detail::sequential(strategy);
+            typedef typename std::decay
+                <
+                    decltype(sequential_strategy)
+                >::type sequential_strategy_type;
+
+            items_overlap = geometry::detail::parallel::find_first_false(
+                pairs.size(), threads, [&](std::size_t i)
+            {
+                typename base::template item_visitor_type
+                    <
+                        sequential_strategy_type
+                    > item_visitor(sequential_strategy);
+                item_visitor.apply(*pairs[i].first, *pairs[i].second);
+                return ! item_visitor.items_overlap;
+            }) < pairs.size();
+        }
+        else
+        {
+            // call partition to check if polygons are disjoint from each other
+            typename base::template item_visitor_type<Strategy> item_visitor(strategy);
 
-        if (item_visitor.items_overlap)
+            geometry::partition
+                <
+                    box_type
+                >::apply(polygon_iterators, item_visitor,
+                         typename base::template expand_box<Strategy>(strategy),
+                         typename base::template overlaps_box<Strategy>(strategy));
+
+            items_overlap = item_visitor.items_overlap;
+        }
+
+        if (items_overlap)
         {
             return visitor.template apply<failure_intersecting_interiors>();
         }
@@ -140,22 +204,133 @@ private:
 
 
 
-    class has_multi_index
+    // Calls check(i, visitor, strategy) for the polygons with indexes
+    // in [0, count) until the first one fails
+    template <typename VisitPolicy, typename Strategy, typename Check>
+    static inline bool check_per_polygon(std::size_t count,
+                                         VisitPolicy& visitor,
+                                         Strategy const& strategy,
+                                         Check const& check,
+                                         std::false_type /*concurrent*/)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (! check(i, visitor, strategy))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // The polygons are checked in parallel with the concurrent visitors and
+    // the polygon failing first is checked again with the visitor of the
+    // caller so the result is the same as in the sequential version.
+    template <typename VisitPolicy, typename Strategy, typename Check>
+    static inline bool check_per_polygon(std::size_t count,
+                                         VisitPolicy& visitor,
+                                         Strategy const& strategy,
+                                         Check const& check,
+                                         std::true_type /*concurrent*/)
+    {
+        std::size_t const threads = strategies::detail::threads(strategy);
+        if (threads <= 1)
+        {
+            return check_per_polygon(count, visitor, strategy, check,
+                                     std::false_type());
+        }
+
+        auto const& sequential_strategy = strategies::detail::sequential(strategy);
+
+        std::size_t const first_invalid = geometry::detail::parallel::find_first_false(
+            count, threads, [&](std::size_t i)
+        {
+            typename concurrent_visitor<VisitPolicy>::type local_visitor;
+            return check(i, local_visitor, sequential_strategy);
+        });
+
+        return first_invalid == count
+            || check(first_invalid, visitor, sequential_strategy);
+    }
+
+    template <typename VisitPolicy, typename Strategy, typename Check>
+    static inline bool check_per_polygon(std::size_t count,
+                                         VisitPolicy& visitor,
+                                         Strategy const& strategy,
+                                         Check const& check)
+    {
+        return check_per_polygon(count, visitor, strategy, check,
+            std::integral_constant
+                <
+                    bool,
+                    ! std::is_void
+                        <
+                            typename concurrent_visitor<VisitPolicy>::type
+                        >::value
+                >());
+    }
+
+
+
+    // The turns of each polygon with itself, in the order of all turns
+    template <typename Turns>
+    class turns_per_polygon
     {
+        typedef typename boost::range_value<Turns>::type turn_type;
+        typedef std::vector<turn_type const*> turn_pointers;
+
     public:
-        has_multi_index(signed_size_type multi_index)
-            : m_multi_index(multi_index)
-        {}
+        typedef boost::indirect_iterator
+            <
+                typename turn_pointers::const_iterator
+            > iterator;
 
-        template <typename Turn>
-        inline bool operator()(Turn const& turn) const
+        turns_per_polygon(Turns const& turns, std::size_t count)
+            : m_offsets(count + 1, 0)
         {
-            return turn.operations[0].seg_id.multi_index == m_multi_index
-                && turn.operations[1].seg_id.multi_index == m_multi_index;
+            for (turn_type const& turn : turns)
+            {
+                if (is_polygon_turn(turn))
+                {
+                    ++m_offsets[turn.operations[0].seg_id.multi_index + 1];
+                }
+            }
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                m_offsets[i + 1] += m_offsets[i];
+            }
+
+            m_turns.resize(m_offsets.back());
+            std::vector<std::size_t> positions(m_offsets.begin(), m_offsets.end() - 1);
+            for (turn_type const& turn : turns)
+            {
+                if (is_polygon_turn(turn))
+                {
+                    m_turns[positions[turn.operations[0].seg_id.multi_index]++] = &turn;
+                }
+            }
+        }
+
+        iterator begin(std::size_t multi_index) const
+        {
+            return iterator(m_turns.begin() + m_offsets[multi_index]);
+        }
+
+        iterator end(std::size_t multi_index) const
+        {
+            return iterator(m_turns.begin() + m_offsets[multi_index + 1]);
         }
 
     private:
-        signed_size_type const m_multi_index;
+        static inline bool is_polygon_turn(turn_type const& turn)
+        {
+            return turn.operations[0].seg_id.multi_index
+                == turn.operations[1].seg_id.multi_index;
+        }
+
+        std::vector<std::size_t> m_offsets;
+        turn_pointers m_turns;
     };
 
 
@@ -165,47 +340,22 @@ private:
     {
         template
         <
-            typename PolygonIterator,
-            typename TurnIterator,
+            typename TurnsPerPolygon,
             typename VisitPolicy,
             typename Strategy
         >
-        static inline bool apply(PolygonIterator polygons_first,
-                                 PolygonIterator polygons_beyond,
-                                 TurnIterator turns_first,
-                                 TurnIterator turns_beyond,
+        static inline bool apply(MultiPolygon const& multipolygon,
+                                 TurnsPerPolygon const& turns,
                                  VisitPolicy& visitor,
                                  Strategy const& strategy)
         {
-            signed_size_type multi_index = 0;
-            for (PolygonIterator it = polygons_first; it != polygons_beyond;
-                 ++it, ++multi_index)
-            {
-                has_multi_index index_predicate(multi_index);
-
-                typedef boost::filter_iterator
-                    <
-                        has_multi_index, TurnIterator
-                    > filtered_turn_iterator;
-
-                filtered_turn_iterator filtered_turns_first(index_predicate,
-                                                            turns_first,
-                                                            turns_beyond);
-
-                filtered_turn_iterator filtered_turns_beyond(index_predicate,
-                                                             turns_beyond,
-                                                             turns_beyond);
-
-                if (! Predicate::apply(*it,
-                                       filtered_turns_first,
-                                       filtered_turns_beyond,
-                                       visitor,
-                                       strategy))
+            return check_per_polygon(boost::size(multipolygon), visitor, strategy,
+                [&](std::size_t i, auto& v, auto const& s)
                 {
-                    return false;
-                }
-            }
-            return true;
+                    return Predicate::apply(range::at(multipolygon, i),
+                                            turns.begin(i), turns.end(i),
+                                            v, s);
+                });
         }
     };
 
@@ -213,67 +363,41 @@ private:
 
     template
     <
-        typename PolygonIterator,
-        typename TurnIterator,
+        typename TurnsPerPolygon,
         typename VisitPolicy,
         typename Strategy
     >
-    static inline bool have_holes_inside(PolygonIterator polygons_first,
-                                         PolygonIterator polygons_beyond,
-                                         TurnIterator turns_first,
-                                         TurnIterator turns_beyond,
+    static inline bool have_holes_inside(MultiPolygon const& multipolygon,
+                                         TurnsPerPolygon const& turns,
                                          VisitPolicy& visitor,
                                          Strategy const& strategy)
     {
         return has_property_per_polygon
             <
                 typename base::has_holes_inside
-            >::apply(polygons_first, polygons_beyond,
-                     turns_first, turns_beyond, visitor, strategy);
+            >::apply(multipolygon, turns, visitor, strategy);
     }
 
 
 
     template
     <
-        typename PolygonIterator,
-        typename TurnIterator,
+        typename TurnsPerPolygon,
         typename VisitPolicy,
         typename Strategy
     >
-    static inline bool have_connected_interior(PolygonIterator polygons_first,
-                                               PolygonIterator polygons_beyond,
-                                               TurnIterator turns_first,
-                                               TurnIterator turns_beyond,
+    static inline bool have_connected_interior(MultiPolygon const& multipolygon,
+                                               TurnsPerPolygon const& turns,
                                                VisitPolicy& visitor,
                                                Strategy const& strategy)
     {
         return has_property_per_polygon
             <
                 typename base::has_connected_interior
-            >::apply(polygons_first, polygons_beyond,
-                     turns_first, turns_beyond, visitor, strategy);
+            >::apply(multipolygon, turns, visitor, strategy);
     }
 
 
-    template <typename VisitPolicy, typename Strategy>
-    struct is_invalid_polygon
-    {
-        is_invalid_polygon(VisitPolicy& policy, Strategy const& strategy)
-            : m_policy(policy)
-            , m_strategy(strategy)
-        {}
-
-        template <typename Polygon>
-        inline bool operator()(Polygon const& polygon) const
-        {
-            return ! base::apply(polygon, m_policy, m_strategy);
-        }
-
-        VisitPolicy& m_policy;
-        Strategy const& m_strategy;
-    };
-
 public:
     template <typename VisitPolicy, typename Strategy>
     static inline bool apply(MultiPolygon const& multipolygon,
@@ -291,8 +415,11 @@ public:
         // check validity of all polygons ring
         debug_phase::apply(1);
 
-        if (std::any_of(boost::begin(multipolygon), boost::end(multipolygon),
-                        is_invalid_polygon<VisitPolicy, Strategy>(visitor, strategy)))
+        if (! check_per_polygon(boost::size(multipolygon), visitor, strategy,
+                [&](std::size_t i, auto& v, auto const& s)
+                {
+                    return base::apply(range::at(multipolygon, i), v, s);
+                }))
         {
             return false;
         }
@@ -321,12 +448,10 @@ public:
         // exterior and not one inside the other
         debug_phase::apply(3);
 
-        if (! have_holes_inside(boost::begin(multipolygon),
-                                boost::end(multipolygon),
-                                turns.begin(),
-                                turns.end(),
-                                visitor,
-                                strategy))
+        turns_per_polygon<std::deque<typename has_valid_turns::turn_type> > const
+            polygon_turns(turns, boost::size(multipolygon));
+
+        if (! have_holes_inside(multipolygon, polygon_turns, visitor, strategy))
         {
             return false;
         }
@@ -335,12 +460,7 @@ public:
         // check that each polygon's interior is connected
         debug_phase::apply(4);
 
-        if (! have_connected_interior(boost::begin(multipolygon),
-                                      boost::end(multipolygon),
-                                      turns.begin(),
-                                      turns.end(),
-                                      visitor,
-                                      strategy))
+        if (! have_connected_interior(multipolygon, polygon_turns, visitor, strategy))
         {
             return false;
         }
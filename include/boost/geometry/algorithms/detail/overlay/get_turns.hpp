@@ -16,8 +16,12 @@
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_GET_TURNS_HPP
 
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <map>
+#include <utility>
+#include <vector>
 
 #include <boost/array.hpp>
 #include <boost/concept_check.hpp>
@@ -58,8 +62,10 @@
 
 #include <boost/geometry/strategies/intersection_strategies.hpp>
 #include <boost/geometry/strategies/intersection_result.hpp>
+#include <boost/geometry/strategies/parallel.hpp>
 
 #include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/parallel.hpp>
 #include <boost/geometry/util/type_traits.hpp>
 
 #include <boost/geometry/views/detail/closed_clockwise_view.hpp>
@@ -533,10 +539,27 @@ public:
         sections_type sec1, sec2;
         typedef std::integer_sequence<std::size_t, 0, 1> dimensions;
 
-        geometry::sectionalize<Reverse1, dimensions>(geometry1, robust_policy,
-                                                     sec1, strategy, 0);
-        geometry::sectionalize<Reverse2, dimensions>(geometry2, robust_policy,
-                                                     sec2, strategy, 1);
+        std::size_t const threads = InterruptPolicy::enabled
+                                  ? 1 : strategies::detail::threads(strategy);
+
+        geometry::detail::parallel::fork_join([&]()
+        {
+            geometry::sectionalize<Reverse1, dimensions>(geometry1, robust_policy,
+                                                         sec1, strategy, 0);
+        }, [&]()
+        {
+            geometry::sectionalize<Reverse2, dimensions>(geometry2, robust_policy,
+                                                         sec2, strategy, 1);
+        }, threads > 1);
+
+        if (threads > 1)
+        {
+            apply_parallel<box_type>(source_id1, geometry1, sec1,
+                                     source_id2, geometry2, sec2,
+                                     strategy, robust_policy,
+                                     turns, interrupt_policy, threads);
+            return;
+        }
 
         // ... and then partition them, intersecting overlapping sections in visitor method
         section_visitor
@@ -556,6 +579,96 @@ public:
                      detail::section::get_section_box<Strategy>(strategy),
                      detail::section::overlaps_section_box<Strategy>(strategy));
     }
+
+private:
+    // The pairs of overlapping sections are collected in the order in which
+    // they are visited by partition. Then the turns are calculated for
+    // consecutive chunks of pairs in parallel and the results are appended
+    // in the order of chunks. So the turns are the same and in the same order
+    // as in the sequential version.
+    template
+    <
+        typename Box,
+        typename Sections1, typename Sections2,
+        typename Strategy, typename RobustPolicy,
+        typename Turns, typename InterruptPolicy
+    >
+    static inline void apply_parallel(
+            int source_id1, Geometry1 const& geometry1, Sections1 const& sec1,
+            int source_id2, Geometry2 const& geometry2, Sections2 const& sec2,
+            Strategy const& strategy,
+            RobustPolicy const& robust_policy,
+            Turns& turns,
+            InterruptPolicy& interrupt_policy,
+            std::size_t threads)
+    {
+        typedef typename boost::range_value<Sections1>::type section_type;
+
+        std::vector<std::pair<section_type const*, section_type const*> > pairs;
+        section_pairs_visitor<section_type, Strategy> visitor(pairs, strategy);
+
+        geometry::partition
+            <
+                Box
+            >::apply(sec1, sec2, visitor,
+                     detail::section::get_section_box<Strategy>(strategy),
+                     detail::section::overlaps_section_box<Strategy>(strategy));
+
+        // More chunks than threads to balance the load
+        std::size_t const chunks = (std::min)(pairs.size(), threads * 8);
+        std::vector<Turns> chunk_turns(chunks);
+
+        geometry::detail::parallel::for_each_index(chunks, threads, [&](std::size_t c)
+        {
+            std::size_t const first = pairs.size() * c / chunks;
+            std::size_t const last = pairs.size() * (c + 1) / chunks;
+            for (std::size_t i = first ; i < last ; ++i)
+            {
+                get_turns_in_sections
+                    <
+                        Geometry1,
+                        Geometry2,
+                        Reverse1, Reverse2,
+                        section_type, section_type,
+                        TurnPolicy
+                    >::apply(source_id1, geometry1, *pairs[i].first,
+                             source_id2, geometry2, *pairs[i].second,
+                             false, false,
+                             strategy,
+                             robust_policy,
+                             chunk_turns[c], interrupt_policy);
+            }
+        });
+
+        for (Turns & chunk : chunk_turns)
+        {
+            std::move(boost::begin(chunk), boost::end(chunk), std::back_inserter(turns));
+        }
+    }
+
+    template <typename Section, typename Strategy>
+    struct section_pairs_visitor
+    {
+        std::vector<std::pair<Section const*, Section const*> >& m_pairs;
+        Strategy const& m_strategy;
+
+        section_pairs_visitor(std::vector<std::pair<Section const*, Section const*> >& pairs,
+                              Strategy const& strategy)
+            : m_pairs(pairs)
+            , m_strategy(strategy)
+        {}
+
+        inline bool apply(Section const& sec1, Section const& sec2)
+        {
+            if (! detail::disjoint::disjoint_box_box(sec1.bounding_box,
+                                                     sec2.bounding_box,
+                                                     m_strategy) )
+            {
+                m_pairs.push_back(std::make_pair(&sec1, &sec2));
+            }
+            return true;
+        }
+    };
 };
 
 
@@ -16,10 +16,16 @@
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_OVERLAY_HPP
 
 
+#include <algorithm>
+#include <cstddef>
 #include <deque>
 #include <map>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <boost/range/begin.hpp>
+#include <boost/range/empty.hpp>
 #include <boost/range/end.hpp>
 #include <boost/range/value_type.hpp>
 
@@ -29,6 +35,7 @@
 #include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
 #include <boost/geometry/algorithms/detail/overlay/is_self_turn.hpp>
 #include <boost/geometry/algorithms/detail/overlay/needs_self_turns.hpp>
+#include <boost/geometry/algorithms/detail/overlay/overlay_components.hpp>
 #include <boost/geometry/algorithms/detail/overlay/overlay_type.hpp>
 #include <boost/geometry/algorithms/detail/overlay/traverse.hpp>
 #include <boost/geometry/algorithms/detail/overlay/traversal_info.hpp>
@@ -48,7 +55,11 @@
 
 #include <boost/geometry/policies/robustness/segment_ratio_type.hpp>
 
+#include <boost/geometry/strategies/parallel.hpp>
+
 #include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/parallel.hpp>
+#include <boost/geometry/util/range.hpp>
 
 #ifdef BOOST_GEOMETRY_DEBUG_ASSEMBLE
 #  include <boost/geometry/io/dsv/write.hpp>
@@ -326,34 +337,48 @@ std::cout << "enrich" << std::endl;
 
         cluster_type clusters;
         std::map<ring_identifier, ring_turn_info> turn_info_per_ring;
+        ring_container_type rings;
+
+        if (traverse_components(geometry1, geometry2, robust_policy, strategy,
+                                turns, clusters, rings, turn_info_per_ring))
+        {
+            // The turns were enriched and traversed per component, they are
+            // visited after the traversal
+            visitor.visit_turns(2, turns);
 
-        geometry::enrich_intersection_points<Reverse1, Reverse2, OverlayType>(
-            turns, clusters, geometry1, geometry2, robust_policy, strategy);
+            visitor.visit_clusters(clusters, turns);
+
+            visitor.visit_turns(3, turns);
+        }
+        else
+        {
+            geometry::enrich_intersection_points<Reverse1, Reverse2, OverlayType>(
+                turns, clusters, geometry1, geometry2, robust_policy, strategy);
 
-        visitor.visit_turns(2, turns);
+            visitor.visit_turns(2, turns);
 
-        visitor.visit_clusters(clusters, turns);
+            visitor.visit_clusters(clusters, turns);
 
 #ifdef BOOST_GEOMETRY_DEBUG_ASSEMBLE
 std::cout << "traverse" << std::endl;
 #endif
-        // Traverse through intersection/turn points and create rings of them.
-        // These rings are always in clockwise order.
-        // In CCW polygons they are marked as "to be reversed" below.
-        ring_container_type rings;
-        traverse<Reverse1, Reverse2, Geometry1, Geometry2, OverlayType>::apply
-                (
-                    geometry1, geometry2,
-                    strategy,
-                    robust_policy,
-                    turns, rings,
-                    turn_info_per_ring,
-                    clusters,
-                    visitor
-                );
-        visitor.visit_turns(3, turns);
-
-        get_ring_turn_info<OverlayType>(turn_info_per_ring, turns, clusters);
+            // Traverse through intersection/turn points and create rings of them.
+            // These rings are always in clockwise order.
+            // In CCW polygons they are marked as "to be reversed" below.
+            traverse<Reverse1, Reverse2, Geometry1, Geometry2, OverlayType>::apply
+                    (
+                        geometry1, geometry2,
+                        strategy,
+                        robust_policy,
+                        turns, rings,
+                        turn_info_per_ring,
+                        clusters,
+                        visitor
+                    );
+            visitor.visit_turns(3, turns);
+
+            get_ring_turn_info<OverlayType>(turn_info_per_ring, turns, clusters);
+        }
 
         typedef ring_properties
             <
@@ -413,6 +438,212 @@ std::cout << "traverse" << std::endl;
         overlay_null_visitor visitor;
         return apply(geometry1, geometry2, robust_policy, out, strategy, visitor);
     }
+
+private :
+    // Without the parallel strategy all turns are enriched and traversed
+    // at once by the caller
+    template
+    <
+        typename RobustPolicy, typename Strategy,
+        typename Turns, typename Clusters, typename Rings, typename TurnInfoMap
+    >
+    static inline bool traverse_components(Geometry1 const& ,
+                Geometry2 const& ,
+                RobustPolicy const& ,
+                Strategy const& ,
+                Turns& , Clusters& , Rings& , TurnInfoMap& )
+    {
+        return false;
+    }
+
+    template
+    <
+        typename RobustPolicy, typename Strategy,
+        typename Turns, typename Clusters, typename Rings, typename TurnInfoMap
+    >
+    static inline bool traverse_components(Geometry1 const& geometry1,
+                Geometry2 const& geometry2,
+                RobustPolicy const& robust_policy,
+                strategies::parallel<Strategy> const& strategy,
+                Turns& turns, Clusters& clusters,
+                Rings& rings, TurnInfoMap& turn_info_per_ring)
+    {
+        return traverse_components(geometry1, geometry2, robust_policy,
+                    static_cast<Strategy const&>(strategy), strategy.threads(),
+                    turns, clusters, rings, turn_info_per_ring,
+                    is_splittable_into_components<Geometry1, Geometry2>());
+    }
+
+    template
+    <
+        typename RobustPolicy, typename Strategy,
+        typename Turns, typename Clusters, typename Rings, typename TurnInfoMap
+    >
+    static inline bool traverse_components(Geometry1 const& ,
+                Geometry2 const& ,
+                RobustPolicy const& ,
+                Strategy const& ,
+                std::size_t ,
+                Turns& , Clusters& , Rings& , TurnInfoMap& ,
+                std::false_type)
+    {
+        return false;
+    }
+
+    // The turns of each component of polygons with intersecting envelopes
+    // are enriched and traversed in parallel. The turns of a component are
+    // kept in the order they have in all turns and the rings are merged in
+    // the order of their start turns, so the rings and the ring infos are the
+    // same as if all turns were enriched and traversed at once. The enriched
+    // turns and the clusters of the components are copied back with the
+    // indexes of all turns.
+    template
+    <
+        typename RobustPolicy, typename Strategy,
+        typename Turns, typename Clusters, typename Rings, typename TurnInfoMap
+    >
+    static inline bool traverse_components(Geometry1 const& geometry1,
+                Geometry2 const& geometry2,
+                RobustPolicy const& robust_policy,
+                Strategy const& strategy,
+                std::size_t threads,
+                Turns& turns, Clusters& clusters,
+                Rings& rings, TurnInfoMap& turn_info_per_ring,
+                std::true_type)
+    {
+        if (boost::empty(turns))
+        {
+            return false;
+        }
+
+        std::vector<std::size_t> component_of;
+        std::size_t const count = assign_components(geometry1, geometry2,
+                                                    strategy, threads,
+                                                    component_of);
+        if (count <= 1)
+        {
+            return false;
+        }
+
+        std::size_t const count1 = component_members_count(geometry1);
+        std::vector<std::vector<std::size_t> > turn_indices(count);
+        for (std::size_t i = 0 ; i < turns.size() ; ++i)
+        {
+            std::size_t const member = component_member_index(
+                    turns[i].operations[0].seg_id, count1);
+            turn_indices[component_of[member]].push_back(i);
+        }
+
+        std::vector<Turns> component_turns(count);
+        std::vector<Clusters> component_clusters(count);
+        std::vector<Rings> component_rings(count);
+        std::vector<TurnInfoMap> component_turn_infos(count);
+        std::vector<std::vector<std::size_t> > start_turn_indices(count);
+
+        geometry::detail::parallel::for_each_index(count, threads,
+            [&](std::size_t c)
+            {
+                if (turn_indices[c].empty())
+                {
+                    return;
+                }
+
+                for (std::size_t i : turn_indices[c])
+                {
+                    component_turns[c].push_back(turns[i]);
+                }
+
+                overlay_null_visitor visitor;
+
+                geometry::enrich_intersection_points<Reverse1, Reverse2, OverlayType>(
+                    component_turns[c], component_clusters[c], geometry1, geometry2,
+                    robust_policy, strategy);
+
+                traverse<Reverse1, Reverse2, Geometry1, Geometry2, OverlayType>::apply
+                        (
+                            geometry1, geometry2,
+                            strategy,
+                            robust_policy,
+                            component_turns[c], component_rings[c],
+                            component_turn_infos[c],
+                            component_clusters[c],
+                            visitor,
+                            &start_turn_indices[c]
+                        );
+
+                get_ring_turn_info<OverlayType>(component_turn_infos[c],
+                                                component_turns[c],
+                                                component_clusters[c]);
+
+                for (std::size_t& index : start_turn_indices[c])
+                {
+                    index = turn_indices[c][index];
+                }
+            });
+
+        // start turn index, component, ring index in the component
+        std::vector<std::pair<std::size_t, std::pair<std::size_t, std::size_t> > > order;
+        for (std::size_t c = 0 ; c < count ; ++c)
+        {
+            for (std::size_t r = 0 ; r < start_turn_indices[c].size() ; ++r)
+            {
+                order.push_back(std::make_pair(start_turn_indices[c][r],
+                                               std::make_pair(c, r)));
+            }
+            turn_info_per_ring.insert(boost::begin(component_turn_infos[c]),
+                                      boost::end(component_turn_infos[c]));
+        }
+        std::sort(order.begin(), order.end());
+
+        for (auto const& item : order)
+        {
+            rings.push_back(std::move(
+                range::at(component_rings[item.second.first], item.second.second)));
+        }
+
+        // The ids of the clusters of the next components follow the ids
+        // of the clusters of the previous ones
+        signed_size_type cluster_offset = 0;
+        for (std::size_t c = 0 ; c < count ; ++c)
+        {
+            std::vector<std::size_t> const& indices = turn_indices[c];
+            auto const global_index = [&](signed_size_type index)
+            {
+                return index < 0 ? index
+                     : static_cast<signed_size_type>(indices[static_cast<std::size_t>(index)]);
+            };
+
+            for (std::size_t i = 0 ; i < indices.size() ; ++i)
+            {
+                auto& turn = turns[indices[i]];
+                turn = std::move(component_turns[c][i]);
+                if (turn.is_clustered())
+                {
+                    turn.cluster_id += cluster_offset;
+                }
+                for (auto& op : turn.operations)
+                {
+                    op.enriched.travels_to_ip_index = global_index(op.enriched.travels_to_ip_index);
+                    op.enriched.next_ip_index = global_index(op.enriched.next_ip_index);
+                }
+            }
+
+            signed_size_type max_cluster_id = 0;
+            for (auto const& item : component_clusters[c])
+            {
+                cluster_info& cinfo = clusters[item.first + cluster_offset];
+                cinfo.open_count = item.second.open_count;
+                for (signed_size_type index : item.second.turn_indices)
+                {
+                    cinfo.turn_indices.insert(global_index(index));
+                }
+                max_cluster_id = (std::max)(max_cluster_id, item.first);
+            }
+            cluster_offset += max_cluster_id;
+        }
+
+        return true;
+    }
 };
 
 
@@ -0,0 +1,242 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_OVERLAY_COMPONENTS_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_OVERLAY_COMPONENTS_HPP
+
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
+#include <boost/geometry/algorithms/detail/envelope/interface.hpp>
+#include <boost/geometry/algorithms/detail/expand/interface.hpp>
+#include <boost/geometry/algorithms/detail/overlay/segment_identifier.hpp>
+#include <boost/geometry/algorithms/detail/partition.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/util/parallel.hpp>
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/type_traits.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace overlay
+{
+
+// The areal geometries may be split into groups of polygons whose envelopes
+// don't intersect envelopes of polygons in other groups. The turns of
+// different groups are not connected so each group may be enriched and
+// traversed independently.
+template <typename Geometry1, typename Geometry2>
+struct is_splittable_into_components
+    : std::integral_constant
+        <
+            bool,
+            (util::is_polygon<Geometry1>::value || util::is_multi_polygon<Geometry1>::value)
+         && (util::is_polygon<Geometry2>::value || util::is_multi_polygon<Geometry2>::value)
+         && (util::is_multi_polygon<Geometry1>::value || util::is_multi_polygon<Geometry2>::value)
+        >
+{};
+
+template <typename MultiPolygon>
+inline std::size_t component_members_count(MultiPolygon const& multi_polygon,
+    std::enable_if_t<util::is_multi_polygon<MultiPolygon>::value> * = nullptr)
+{
+    return boost::size(multi_polygon);
+}
+
+template <typename Polygon>
+inline std::size_t component_members_count(Polygon const& ,
+    std::enable_if_t<util::is_polygon<Polygon>::value> * = nullptr)
+{
+    return 1;
+}
+
+template <typename MultiPolygon>
+inline auto const& component_member(MultiPolygon const& multi_polygon, std::size_t i,
+    std::enable_if_t<util::is_multi_polygon<MultiPolygon>::value> * = nullptr)
+{
+    return range::at(multi_polygon, i);
+}
+
+template <typename Polygon>
+inline Polygon const& component_member(Polygon const& polygon, std::size_t ,
+    std::enable_if_t<util::is_polygon<Polygon>::value> * = nullptr)
+{
+    return polygon;
+}
+
+template <typename Box>
+struct component_item
+{
+    Box envelope;
+    std::size_t index;
+};
+
+template <typename Strategy>
+struct component_item_get_box
+{
+    component_item_get_box(Strategy const& strategy)
+        : m_strategy(strategy)
+    {}
+
+    template <typename Box, typename Item>
+    inline void apply(Box& total, Item const& item) const
+    {
+        geometry::expand(total, item.envelope, m_strategy);
+    }
+
+    Strategy const& m_strategy;
+};
+
+template <typename Strategy>
+struct component_item_overlaps_box
+{
+    component_item_overlaps_box(Strategy const& strategy)
+        : m_strategy(strategy)
+    {}
+
+    template <typename Box, typename Item>
+    inline bool apply(Box const& box, Item const& item) const
+    {
+        return ! geometry::detail::disjoint::disjoint_box_box(
+                    box, item.envelope, m_strategy);
+    }
+
+    Strategy const& m_strategy;
+};
+
+// Joins the items with intersecting envelopes (union-find)
+template <typename Strategy>
+struct component_item_visitor
+{
+    component_item_visitor(std::vector<std::size_t>& parents, Strategy const& strategy)
+        : m_parents(parents)
+        , m_strategy(strategy)
+    {}
+
+    template <typename Item>
+    inline bool apply(Item const& item1, Item const& item2)
+    {
+        if (! geometry::detail::disjoint::disjoint_box_box(item1.envelope,
+                                                           item2.envelope,
+                                                           m_strategy))
+        {
+            std::size_t const root1 = root(item1.index);
+            std::size_t const root2 = root(item2.index);
+            // the smaller index is the root so the order of items is kept
+            if (root1 < root2)
+            {
+                m_parents[root2] = root1;
+            }
+            else if (root2 < root1)
+            {
+                m_parents[root1] = root2;
+            }
+        }
+        return true;
+    }
+
+    inline std::size_t root(std::size_t i)
+    {
+        while (m_parents[i] != i)
+        {
+            m_parents[i] = m_parents[m_parents[i]];
+            i = m_parents[i];
+        }
+        return i;
+    }
+
+    std::vector<std::size_t>& m_parents;
+    Strategy const& m_strategy;
+};
+
+// Assigns the polygons of both geometries to components of transitively
+// intersecting envelopes. The polygons of geometry2 follow the polygons of
+// geometry1 in component_of. Components are numbered in the order of their
+// first polygons. Returns the number of components.
+template <typename Geometry1, typename Geometry2, typename Strategy>
+inline std::size_t assign_components(Geometry1 const& geometry1,
+                                     Geometry2 const& geometry2,
+                                     Strategy const& strategy,
+                                     std::size_t threads,
+                                     std::vector<std::size_t>& component_of)
+{
+    typedef model::box<typename geometry::point_type<Geometry1>::type> box_type;
+    typedef component_item<box_type> item_type;
+
+    std::size_t const count1 = component_members_count(geometry1);
+    std::size_t const count2 = component_members_count(geometry2);
+
+    std::vector<item_type> items(count1 + count2);
+    geometry::detail::parallel::for_each_index(count1 + count2, threads,
+        [&](std::size_t i)
+        {
+            if (i < count1)
+            {
+                geometry::envelope(component_member(geometry1, i),
+                                   items[i].envelope, strategy);
+            }
+            else
+            {
+                geometry::envelope(component_member(geometry2, i - count1),
+                                   items[i].envelope, strategy);
+            }
+            items[i].index = i;
+        });
+
+    std::vector<std::size_t> parents(items.size());
+    for (std::size_t i = 0 ; i < parents.size() ; ++i)
+    {
+        parents[i] = i;
+    }
+
+    component_item_visitor<Strategy> visitor(parents, strategy);
+    geometry::partition
+        <
+            box_type
+        >::apply(items, visitor,
+                 component_item_get_box<Strategy>(strategy),
+                 component_item_overlaps_box<Strategy>(strategy));
+
+    component_of.resize(items.size());
+    std::size_t components_count = 0;
+    for (std::size_t i = 0 ; i < items.size() ; ++i)
+    {
+        std::size_t const root = visitor.root(i);
+        component_of[i] = root == i ? components_count++ : component_of[root];
+    }
+    return components_count;
+}
+
+// Returns the index of the polygon containing the segment in component_of
+inline std::size_t component_member_index(segment_identifier const& seg_id,
+                                          std::size_t count1)
+{
+    std::size_t const member = seg_id.multi_index < 0
+                             ? 0 : static_cast<std::size_t>(seg_id.multi_index);
+    return seg_id.source_index == 0 ? member : count1 + member;
+}
+
+
+}} // namespace detail::overlay
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_OVERLAY_COMPONENTS_HPP
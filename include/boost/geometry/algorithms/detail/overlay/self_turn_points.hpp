@@ -15,7 +15,12 @@
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_SELF_TURN_POINTS_HPP
 
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 
 #include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
@@ -32,10 +37,14 @@
 #include <boost/geometry/geometries/box.hpp>
 #include <boost/geometry/geometries/concepts/check.hpp>
 
+#include <boost/geometry/policies/predicate_based_interrupt_policy.hpp>
+
 #include <boost/geometry/strategies/detail.hpp>
+#include <boost/geometry/strategies/parallel.hpp>
 #include <boost/geometry/strategies/relate/services.hpp>
 
 #include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/parallel.hpp>
 
 
 namespace boost { namespace geometry
@@ -59,6 +68,47 @@ struct no_interrupt_policy
 };
 
 
+// Interrupt policies deciding only by the turns passed to apply(). For them
+// the self turns can be calculated in parallel, each chunk of sections
+// with its own copy of the policy.
+template <typename InterruptPolicy>
+struct is_chunkable_interrupt_policy
+    : std::false_type
+{};
+
+template <>
+struct is_chunkable_interrupt_policy<no_interrupt_policy>
+    : std::true_type
+{};
+
+template <>
+struct is_chunkable_interrupt_policy<detail::get_turns::no_interrupt_policy>
+    : std::true_type
+{};
+
+template <typename Predicate, bool AllowEmptyTurnRange>
+struct is_chunkable_interrupt_policy
+    <
+        detail::overlay::stateless_predicate_based_interrupt_policy
+            <
+                Predicate, AllowEmptyTurnRange
+            >
+    >
+    : std::true_type
+{};
+
+template <typename Predicate, bool AllowEmptyTurnRange>
+struct is_chunkable_interrupt_policy
+    <
+        detail::overlay::predicate_based_interrupt_policy
+            <
+                Predicate, AllowEmptyTurnRange
+            >
+    >
+    : std::true_type
+{};
+
+
 template
 <
     bool Reverse,
@@ -157,6 +207,17 @@ struct get_turns
         geometry::sectionalize<Reverse, dimensions>(geometry, robust_policy,
                                                     sec, strategy);
 
+        std::size_t const threads
+            = is_chunkable_interrupt_policy<InterruptPolicy>::value
+            ? strategies::detail::threads(strategy) : 1;
+
+        if (threads > 1)
+        {
+            return apply_parallel<box_type>(geometry, sec, strategy, robust_policy,
+                                            turns, interrupt_policy,
+                                            source_index, skip_adjacent, threads);
+        }
+
         self_section_visitor
             <
                 Reverse, Geometry,
@@ -174,6 +235,117 @@ struct get_turns
 
         return ! interrupt_policy.has_intersections;
     }
+
+private:
+    // The pairs of overlapping sections are collected in the order in which
+    // they are visited by partition and the turns are calculated for
+    // consecutive chunks of pairs in parallel, each chunk with its own copy
+    // of the interrupt policy. If a chunk is interrupted the chunks following
+    // it are not needed anymore. The turns of the chunks preceding the first
+    // interrupted one and of this chunk are appended in order so the result
+    // is the same as in the sequential version.
+    template
+    <
+        typename Box, typename Geometry, typename Sections,
+        typename Strategy, typename RobustPolicy,
+        typename Turns, typename InterruptPolicy
+    >
+    static inline bool apply_parallel(
+            Geometry const& geometry,
+            Sections const& sec,
+            Strategy const& strategy,
+            RobustPolicy const& robust_policy,
+            Turns& turns,
+            InterruptPolicy& interrupt_policy,
+            int source_index, bool skip_adjacent,
+            std::size_t threads)
+    {
+        typedef typename boost::range_value<Sections>::type section_type;
+
+        std::vector<std::pair<section_type const*, section_type const*> > pairs;
+        section_pairs_visitor<section_type, Strategy> visitor(pairs, strategy);
+
+        geometry::partition
+            <
+                Box
+            >::apply(sec, visitor,
+                     detail::section::get_section_box<Strategy>(strategy),
+                     detail::section::overlaps_section_box<Strategy>(strategy));
+
+        // More chunks than threads to balance the load
+        std::size_t const chunks = (std::min)(pairs.size(), threads * 8);
+        std::vector<Turns> chunk_turns(chunks);
+        std::vector<InterruptPolicy> chunk_policies(chunks, interrupt_policy);
+
+        std::size_t const interrupted = geometry::detail::parallel::find_first_false(
+            chunks, threads, [&](std::size_t c)
+        {
+            std::size_t const first = pairs.size() * c / chunks;
+            std::size_t const last = pairs.size() * (c + 1) / chunks;
+            for (std::size_t i = first ; i < last ; ++i)
+            {
+                // false if interrupted
+                if (! detail::get_turns::get_turns_in_sections
+                        <
+                            Geometry, Geometry,
+                            Reverse, Reverse,
+                            section_type, section_type,
+                            TurnPolicy
+                        >::apply(source_index, geometry, *pairs[i].first,
+                                 source_index, geometry, *pairs[i].second,
+                                 false, skip_adjacent,
+                                 strategy,
+                                 robust_policy,
+                                 chunk_turns[c], chunk_policies[c]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        });
+
+        std::size_t const used_chunks = interrupted < chunks ? interrupted + 1 : chunks;
+        for (std::size_t c = 0 ; c < used_chunks ; ++c)
+        {
+            std::move(boost::begin(chunk_turns[c]), boost::end(chunk_turns[c]),
+                      std::back_inserter(turns));
+        }
+
+        if (interrupted < chunks)
+        {
+            // Let the policy of the caller see the turns interrupting
+            // the process
+            interrupt_policy.apply(turns);
+        }
+
+        return ! interrupt_policy.has_intersections;
+    }
+
+    template <typename Section, typename Strategy>
+    struct section_pairs_visitor
+    {
+        std::vector<std::pair<Section const*, Section const*> >& m_pairs;
+        Strategy const& m_strategy;
+
+        section_pairs_visitor(std::vector<std::pair<Section const*, Section const*> >& pairs,
+                              Strategy const& strategy)
+            : m_pairs(pairs)
+            , m_strategy(strategy)
+        {}
+
+        inline bool apply(Section const& sec1, Section const& sec2)
+        {
+            if (! detail::disjoint::disjoint_box_box(sec1.bounding_box,
+                                                     sec2.bounding_box,
+                                                     m_strategy)
+                    && ! sec1.duplicate
+                    && ! sec2.duplicate)
+            {
+                m_pairs.push_back(std::make_pair(&sec1, &sec2));
+            }
+            return true;
+        }
+    };
 };
 
 
@@ -14,7 +14,9 @@
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_TRAVERSAL_RING_CREATOR_HPP
 
 #include <cstddef>
+#include <vector>
 
+#include <boost/range/size.hpp>
 #include <boost/range/value_type.hpp>
 
 #include <boost/geometry/algorithms/detail/overlay/backtrack_check_si.hpp>
@@ -318,9 +320,12 @@ struct traversal_ring_creator
                 : (is_union ? 0 : 1);
     }
 
+    // If start_turn_indices is not null, the index of the turn from which
+    // each ring was started is stored in it, one per ring
     template <typename Rings>
     void iterate(Rings& rings, std::size_t& finalized_ring_size,
-                 typename Backtrack::state_type& state)
+                 typename Backtrack::state_type& state,
+                 std::vector<std::size_t>* start_turn_indices = nullptr)
     {
         for (std::size_t turn_index = 0; turn_index < m_turns.size(); ++turn_index)
         {
@@ -346,6 +351,11 @@ struct traversal_ring_creator
                             rings, finalized_ring_size, state);
                 }
             }
+
+            if (start_turn_indices != nullptr)
+            {
+                start_turn_indices->resize(boost::size(rings), turn_index);
+            }
         }
     }
 
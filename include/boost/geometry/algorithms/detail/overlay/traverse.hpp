@@ -10,6 +10,7 @@
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_TRAVERSE_HPP
 
 #include <cstddef>
+#include <vector>
 
 #include <boost/geometry/algorithms/detail/overlay/backtrack_check_si.hpp>
 #include <boost/geometry/algorithms/detail/overlay/traversal_ring_creator.hpp>
@@ -73,7 +74,8 @@ public :
                 Turns& turns, Rings& rings,
                 TurnInfoMap& turn_info_map,
                 Clusters& clusters,
-                Visitor& visitor)
+                Visitor& visitor,
+                std::vector<std::size_t>* start_turn_indices = nullptr)
     {
         traversal_switch_detector
             <
@@ -102,7 +104,7 @@ public :
 
         typename Backtrack::state_type state;
 
-        trav.iterate(rings, finalized_ring_size, state);
+        trav.iterate(rings, finalized_ring_size, state, start_turn_indices);
     }
 };
 
@@ -0,0 +1,400 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_PREPARED_EDGE_GRID_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_PREPARED_EDGE_GRID_HPP
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/detail/disjoint/linear_linear.hpp>
+#include <boost/geometry/algorithms/dispatch/disjoint.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/segment.hpp>
+#include <boost/geometry/strategies/cartesian/point_in_poly_winding.hpp>
+#include <boost/geometry/views/detail/closed_clockwise_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace prepared
+{
+
+// The edge grid may be used only with the strategy checking the edges
+// crossing the vertical line going through the point
+template <typename Strategy>
+struct is_cartesian_winding
+{
+    template <typename Side, typename CalculationType>
+    static std::true_type test(strategy::within::detail::cartesian_winding_base
+                                    <
+                                        Side, CalculationType
+                                    > const*);
+    static std::false_type test(...);
+
+    static const bool value = decltype(test(static_cast<Strategy const*>(nullptr)))::value;
+};
+
+// Edges of the rings of (multi)polygon stored in vertical slabs covering
+// the x-range of the geometry. An edge is stored in every slab its x-range
+// overlaps. Edges not overlapping the x-coordinate of a point don't change
+// the result of the cartesian winding strategy so only the edges of one slab
+// are checked to find the location of a point. Ranges are expanded by a few
+// epsilons to account for the approximate comparisons of coordinates.
+template <typename Point>
+class edge_grid
+{
+    static const std::size_t max_references_factor = 8;
+
+    struct edge_type
+    {
+        Point const* first;
+        Point const* second;
+        std::size_t ring;
+        std::size_t slab;
+        double min;
+        double max;
+    };
+
+    struct ring_info
+    {
+        std::size_t polygon;
+        bool exterior;
+        bool reversed;
+        bool is_ring;
+    };
+
+public:
+    edge_grid()
+        : m_min(0)
+        , m_max(0)
+        , m_width(0)
+        , m_slabs(0)
+    {}
+
+    template <typename Geometry>
+    void build(Geometry const& geometry)
+    {
+        add(geometry, typename tag<Geometry>::type());
+
+        if (m_edges.empty())
+        {
+            return;
+        }
+
+        m_min = m_edges.front().min;
+        m_max = m_edges.front().max;
+        for (edge_type const& e : m_edges)
+        {
+            m_min = (std::min)(m_min, e.min);
+            m_max = (std::max)(m_max, e.max);
+        }
+
+        // Decrease the number of slabs if the edges are replicated too much
+        std::size_t const count = m_edges.size();
+        m_slabs = (std::max)(std::size_t(1), count / 4);
+        for (;;)
+        {
+            m_width = (m_max - m_min) / double(m_slabs);
+            if (m_slabs == 1 || ! (m_width > 0) || references_count() <= max_references_factor * count)
+            {
+                break;
+            }
+            m_slabs /= 2;
+        }
+        if (! (m_width > 0))
+        {
+            m_slabs = 1;
+        }
+
+        m_offsets.assign(m_slabs + 1, 0);
+        for (edge_type & e : m_edges)
+        {
+            e.slab = slab(e.min);
+            for (std::size_t s = e.slab, last = slab(e.max) ; s <= last ; ++s)
+            {
+                ++m_offsets[s + 1];
+            }
+        }
+        for (std::size_t s = 0 ; s < m_slabs ; ++s)
+        {
+            m_offsets[s + 1] += m_offsets[s];
+        }
+
+        // Edges are stored in the order of rings in every slab
+        m_indexes.resize(m_offsets.back());
+        std::vector<std::size_t> positions(m_offsets.begin(), m_offsets.end() - 1);
+        for (std::size_t i = 0 ; i < count ; ++i)
+        {
+            for (std::size_t s = m_edges[i].slab, last = slab(m_edges[i].max) ; s <= last ; ++s)
+            {
+                m_indexes[positions[s]++] = i;
+            }
+        }
+    }
+
+    bool empty() const
+    {
+        return m_edges.empty();
+    }
+
+    // Returns 1 if the point is in the interior, 0 if it is on the boundary
+    // and -1 if it is in the exterior of the geometry, the same as
+    // point_in_geometry() called with the strategy for the whole geometry
+    template <typename P, typename Strategy>
+    int point_in_geometry(P const& point, Strategy const& strategy) const
+    {
+        if (m_slabs == 0)
+        {
+            return -1;
+        }
+
+        // edges' ranges are already expanded by the tolerance
+        double const x = double(geometry::get<0>(point));
+        if (! (x >= m_min && x <= m_max))
+        {
+            return -1;
+        }
+
+        std::size_t const s = slab(x);
+        std::size_t const* it = m_indexes.data() + m_offsets[s];
+        std::size_t const* const end = m_indexes.data() + m_offsets[s + 1];
+
+        std::size_t polygon = (std::numeric_limits<std::size_t>::max)();
+        int code = -1;
+
+        while (it != end)
+        {
+            std::size_t const ring = m_edges[*it].ring;
+            ring_info const& info = m_rings[ring];
+
+            // the ring's state, all edges of the ring in this slab are checked
+            typename Strategy::state_type state;
+            bool check = info.is_ring;
+            for ( ; it != end && m_edges[*it].ring == ring ; ++it)
+            {
+                edge_type const& e = m_edges[*it];
+                if (check && ! strategy.apply(point, *e.first, *e.second, state))
+                {
+                    check = false;
+                }
+            }
+
+            if (! info.is_ring)
+            {
+                continue;
+            }
+
+            int const ring_code = strategy.result(state);
+            if (info.exterior)
+            {
+                // the first polygon containing the point or having it on
+                // the boundary defines the result
+                if (code >= 0)
+                {
+                    return code;
+                }
+                polygon = info.polygon;
+                code = ring_code;
+            }
+            else if (info.polygon == polygon && code == 1 && ring_code != -1)
+            {
+                code = -ring_code;
+            }
+        }
+
+        return code;
+    }
+
+    // Returns true if the segment intersects the boundary of the geometry
+    template <typename Segment, typename Strategy>
+    bool intersects_boundary(Segment const& segment, Strategy const& strategy) const
+    {
+        typedef model::referring_segment<Point const> edge_segment;
+
+        if (m_slabs == 0)
+        {
+            return false;
+        }
+
+        double const x0 = double(geometry::get<0, 0>(segment));
+        double const x1 = double(geometry::get<1, 0>(segment));
+        double const min = (std::min)(x0, x1);
+        double const max = (std::max)(x0, x1);
+        double const lo = min - tolerance(min);
+        double const hi = max + tolerance(max);
+        if (! (hi >= m_min && lo <= m_max))
+        {
+            return false;
+        }
+
+        std::size_t const first = slab(lo);
+        std::size_t const last = slab(hi);
+        for (std::size_t s = first ; s <= last ; ++s)
+        {
+            for (std::size_t i = m_offsets[s] ; i < m_offsets[s + 1] ; ++i)
+            {
+                edge_type const& e = m_edges[m_indexes[i]];
+                // every edge is checked once, in the first slab it's found in
+                if (e.slab != s && s != first)
+                {
+                    continue;
+                }
+                if (e.max < lo || e.min > hi)
+                {
+                    continue;
+                }
+
+                // the same order of points as in the original ring
+                bool const reversed = m_rings[e.ring].reversed;
+                edge_segment const es(reversed ? *e.second : *e.first,
+                                      reversed ? *e.first : *e.second);
+                if (! dispatch::disjoint
+                        <
+                            edge_segment, Segment
+                        >::apply(es, segment, strategy))
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+private:
+    static inline double tolerance(double x)
+    {
+        typedef typename coordinate_type<Point>::type coordinate_t;
+        double const epsilon = std::is_floating_point<coordinate_t>::value
+                             ? double(std::numeric_limits<coordinate_t>::epsilon())
+                             : 0.0;
+        return 4 * epsilon * (std::max)(1.0, std::abs(x));
+    }
+
+    inline std::size_t slab(double x) const
+    {
+        if (! (m_width > 0) || ! (x > m_min))
+        {
+            return 0;
+        }
+        double const s = (x - m_min) / m_width;
+        return s < double(m_slabs - 1) ? std::size_t(s) : m_slabs - 1;
+    }
+
+    inline std::size_t references_count() const
+    {
+        std::size_t result = 0;
+        for (edge_type const& e : m_edges)
+        {
+            result += slab(e.max) - slab(e.min) + 1;
+        }
+        return result;
+    }
+
+    template <typename MultiPolygon>
+    void add(MultiPolygon const& multi_polygon, multi_polygon_tag)
+    {
+        std::size_t i = 0;
+        for (auto it = boost::begin(multi_polygon) ; it != boost::end(multi_polygon) ; ++it, ++i)
+        {
+            add_polygon(*it, i);
+        }
+    }
+
+    template <typename Polygon>
+    void add(Polygon const& polygon, polygon_tag)
+    {
+        add_polygon(polygon, 0);
+    }
+
+    template <typename Polygon>
+    void add_polygon(Polygon const& polygon, std::size_t index)
+    {
+        add_ring(exterior_ring(polygon), index, true);
+
+        auto const& rings = interior_rings(polygon);
+        for (auto it = boost::begin(rings) ; it != boost::end(rings) ; ++it)
+        {
+            add_ring(*it, index, false);
+        }
+    }
+
+    template <typename Ring>
+    void add_ring(Ring const& ring, std::size_t polygon, bool exterior)
+    {
+        std::size_t const ring_index = m_rings.size();
+        ring_info info;
+        info.polygon = polygon;
+        info.exterior = exterior;
+        info.reversed = geometry::point_order<Ring>::value == counterclockwise;
+        info.is_ring = boost::size(ring) >= core_detail::closure::minimum_ring_size
+                                                <
+                                                    geometry::closure<Ring>::value
+                                                >::value;
+        m_rings.push_back(info);
+
+        if (boost::size(ring) < 2)
+        {
+            return;
+        }
+
+        detail::closed_clockwise_view<Ring const> const view(ring);
+        auto it = boost::begin(view);
+        auto const end = boost::end(view);
+        for (auto prev = it++ ; it != end ; ++prev, ++it)
+        {
+            edge_type e;
+            e.first = &*prev;
+            e.second = &*it;
+            e.ring = ring_index;
+            e.slab = 0;
+            double const x0 = double(geometry::get<0>(*prev));
+            double const x1 = double(geometry::get<0>(*it));
+            e.min = (std::min)(x0, x1);
+            e.max = (std::max)(x0, x1);
+            e.min -= tolerance(e.min);
+            e.max += tolerance(e.max);
+            m_edges.push_back(e);
+        }
+    }
+
+    std::vector<edge_type> m_edges;
+    std::vector<ring_info> m_rings;
+    std::vector<std::size_t> m_offsets;
+    std::vector<std::size_t> m_indexes;
+    double m_min;
+    double m_max;
+    double m_width;
+    std::size_t m_slabs;
+};
+
+
+}} // namespace detail::prepared
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_PREPARED_EDGE_GRID_HPP
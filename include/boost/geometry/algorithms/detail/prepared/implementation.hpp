@@ -0,0 +1,285 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_PREPARED_IMPLEMENTATION_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_PREPARED_IMPLEMENTATION_HPP
+
+
+#include <type_traits>
+#include <utility>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/linear_areal.hpp>
+#include <boost/geometry/algorithms/detail/prepared/edge_grid.hpp>
+#include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
+#include <boost/geometry/algorithms/dispatch/disjoint.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/prepared_geometry.hpp>
+#include <boost/geometry/iterators/segment_iterator.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace prepared
+{
+
+template <typename Geometry>
+struct is_cartesian
+    : std::is_same<typename cs_tag<Geometry>::type, cartesian_tag>
+{};
+
+template <typename Geometry>
+inline auto const& first_ring(Geometry const& geometry, polygon_tag)
+{
+    return geometry::exterior_ring(geometry);
+}
+
+template <typename Geometry>
+inline auto const& first_ring(Geometry const& geometry, multi_polygon_tag)
+{
+    return geometry::exterior_ring(*boost::begin(geometry));
+}
+
+// Location of a point. The index is used only with the cartesian winding
+// strategy, the referred geometry is used otherwise.
+template <typename Geometry>
+struct point_in_prepared
+{
+    typedef model::prepared_geometry<Geometry> prepared_type;
+    typedef typename tag<Geometry>::type tag_type;
+
+    template <typename Point, typename Strategy>
+    static inline int apply(Point const& point, prepared_type const& prepared,
+                            Strategy const& strategy)
+    {
+        typedef typename geometry::ring_type<Geometry>::type ring_type;
+        typedef decltype(strategy.relate(point, std::declval<ring_type const&>()))
+            ring_strategy_type;
+
+        return apply(point, prepared, strategy,
+                     std::integral_constant
+                        <
+                            bool,
+                            is_cartesian<Geometry>::value
+                         && is_cartesian_winding<ring_strategy_type>::value
+                        >());
+    }
+
+private :
+    template <typename Point, typename Strategy>
+    static inline int apply(Point const& point, prepared_type const& prepared,
+                            Strategy const& strategy, std::true_type)
+    {
+        // there are no rings with edges
+        if (prepared.index().empty())
+        {
+            return -1;
+        }
+
+        auto const s = strategy.relate(point,
+                                       first_ring(prepared.geometry(), tag_type()));
+        return prepared.index().point_in_geometry(point, s);
+    }
+
+    template <typename Point, typename Strategy>
+    static inline int apply(Point const& point, prepared_type const& prepared,
+                            Strategy const& strategy, std::false_type)
+    {
+        return detail_dispatch::within::point_in_geometry
+            <
+                Geometry
+            >::apply(point, prepared.geometry(), strategy);
+    }
+};
+
+// Segment against the prepared areal geometry. The edges close to the
+// segment are found in the index in cartesian coordinate system.
+template <typename Segment, typename Geometry>
+struct disjoint_segment_prepared
+{
+    typedef model::prepared_geometry<Geometry> prepared_type;
+
+    template <typename Strategy>
+    static inline bool apply(Segment const& segment, prepared_type const& prepared,
+                             Strategy const& strategy)
+    {
+        return apply(segment, prepared, strategy, is_cartesian<Geometry>());
+    }
+
+private :
+    template <typename Strategy>
+    static inline bool apply(Segment const& segment, prepared_type const& prepared,
+                             Strategy const& strategy, std::true_type)
+    {
+        if (prepared.index().intersects_boundary(segment, strategy))
+        {
+            return false;
+        }
+
+        typename point_type<Segment>::type p;
+        detail::assign_point_from_index<0>(segment, p);
+
+        return ! geometry::covered_by(p, prepared, strategy);
+    }
+
+    template <typename Strategy>
+    static inline bool apply(Segment const& segment, prepared_type const& prepared,
+                             Strategy const& strategy, std::false_type)
+    {
+        return dispatch::disjoint
+            <
+                Segment, Geometry
+            >::apply(segment, prepared.geometry(), strategy);
+    }
+};
+
+template <typename Linear, typename Geometry>
+struct disjoint_linear_prepared
+{
+    typedef model::prepared_geometry<Geometry> prepared_type;
+
+    template <typename Strategy>
+    static inline bool apply(Linear const& linear, prepared_type const& prepared,
+                             Strategy const& strategy)
+    {
+        return apply(linear, prepared, strategy, is_cartesian<Geometry>());
+    }
+
+private :
+    template <typename Strategy>
+    static inline bool apply(Linear const& linear, prepared_type const& prepared,
+                             Strategy const& strategy, std::true_type)
+    {
+        for (auto it = geometry::segments_begin(linear);
+             it != geometry::segments_end(linear); ++it)
+        {
+            if (prepared.index().intersects_boundary(*it, strategy))
+            {
+                return false;
+            }
+        }
+
+        return detail::disjoint::disjoint_no_intersections_policy
+            <
+                Linear, prepared_type
+            >::apply(linear, prepared, strategy);
+    }
+
+    template <typename Strategy>
+    static inline bool apply(Linear const& linear, prepared_type const& prepared,
+                             Strategy const& strategy, std::false_type)
+    {
+        return dispatch::disjoint
+            <
+                Linear, Geometry
+            >::apply(linear, prepared.geometry(), strategy);
+    }
+};
+
+
+}} // namespace detail::prepared
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail_dispatch { namespace within
+{
+
+template <typename Geometry>
+struct point_in_geometry<model::prepared_geometry<Geometry>, polygon_tag>
+    : detail::prepared::point_in_prepared<Geometry>
+{};
+
+template <typename Geometry>
+struct point_in_geometry<model::prepared_geometry<Geometry>, multi_polygon_tag>
+    : detail::prepared::point_in_prepared<Geometry>
+{};
+
+}} // namespace detail_dispatch::within
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Segment, typename Geometry>
+struct disjoint
+    <
+        Segment, model::prepared_geometry<Geometry>,
+        2, segment_tag, areal_tag, false
+    >
+    : detail::prepared::disjoint_segment_prepared<Segment, Geometry>
+{};
+
+template <typename Linear, typename Geometry>
+struct disjoint
+    <
+        Linear, model::prepared_geometry<Geometry>,
+        2, linear_tag, areal_tag, false
+    >
+    : detail::prepared::disjoint_linear_prepared<Linear, Geometry>
+{};
+
+template <typename Geometry, typename Segment>
+struct disjoint
+    <
+        model::prepared_geometry<Geometry>, Segment,
+        2, areal_tag, segment_tag, false
+    >
+{
+    template <typename Strategy>
+    static inline bool apply(model::prepared_geometry<Geometry> const& prepared,
+                             Segment const& segment,
+                             Strategy const& strategy)
+    {
+        return disjoint
+            <
+                Segment, model::prepared_geometry<Geometry>,
+                2, segment_tag, areal_tag, false
+            >::apply(segment, prepared, strategy);
+    }
+};
+
+template <typename Geometry, typename Linear>
+struct disjoint
+    <
+        model::prepared_geometry<Geometry>, Linear,
+        2, areal_tag, linear_tag, false
+    >
+{
+    template <typename Strategy>
+    static inline bool apply(model::prepared_geometry<Geometry> const& prepared,
+                             Linear const& linear,
+                             Strategy const& strategy)
+    {
+        return disjoint
+            <
+                Linear, model::prepared_geometry<Geometry>,
+                2, linear_tag, areal_tag, false
+            >::apply(linear, prepared, strategy);
+    }
+};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_PREPARED_IMPLEMENTATION_HPP
@@ -0,0 +1,354 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_SIMPLIFY_VISVALINGAM_WHYATT_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_SIMPLIFY_VISVALINGAM_WHYATT_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/core/addressof.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/detail/dummy_geometries.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/ring.hpp>
+#include <boost/geometry/geometries/segment.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/util/math.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace simplify
+{
+
+
+/*!
+\brief Simplifies ranges of points with the Visvalingam-Whyatt algorithm.
+\details The points are kept in doubly linked lists and the effective areas
+    in a heap so the simplification takes O(n log n). Several ranges may be
+    simplified together, one after another. If topology is preserved a point
+    is not removed if any other point of the ranges is in the removed
+    triangle. Segments can't cross the two removed sides so they can
+    intersect the new segment only if one of their points is in the triangle.
+    The remaining points are kept in an rtree. The endpoints of linear ranges
+    are kept and the rings are not reduced to less than 3 points. Rings are
+    passed without closing point.
+*/
+template <typename Point, typename Strategies>
+class visvalingam_whyatt_simplifier
+{
+    typedef model::ring<Point, true, false> triangle_type;
+    typedef decltype(std::declval<Strategies>().area(detail::dummy_ring())) area_strategy_type;
+    typedef typename area_strategy_type::template state<triangle_type> area_state_type;
+
+    typedef decltype(std::declval<Strategies>().side()) side_strategy_type;
+
+    typedef model::box<Point> box_type;
+    typedef std::pair<Point, std::size_t> rtree_value_type;
+    typedef index::rtree<rtree_value_type, index::quadratic<16> > rtree_type;
+
+public:
+    typedef typename area_strategy_type::template result_type
+        <
+            triangle_type
+        >::type area_type;
+
+private:
+    static const std::size_t npos = std::size_t(-1);
+
+    struct range_info
+    {
+        std::size_t first;
+        std::size_t count;
+        std::size_t remaining;
+        bool is_ring;
+    };
+
+    struct heap_entry
+    {
+        area_type area;
+        std::size_t index;
+        std::size_t version;
+
+        // The smallest area on top, the first point for equal areas
+        inline bool operator<(heap_entry const& other) const
+        {
+            return area != other.area ? area > other.area : index > other.index;
+        }
+    };
+
+public:
+    explicit visvalingam_whyatt_simplifier(Strategies const& strategies)
+        : m_area_strategy(strategies.area(detail::dummy_ring()))
+        , m_side_strategy(strategies.side())
+    {}
+
+    template <typename Range>
+    inline std::size_t add_range(Range const& range, std::size_t count, bool is_ring)
+    {
+        range_info info;
+        info.first = m_points.size();
+        info.count = count;
+        info.remaining = count;
+        info.is_ring = is_ring;
+
+        auto it = boost::begin(range);
+        for (std::size_t i = 0; i < count; ++i, ++it)
+        {
+            std::size_t const index = info.first + i;
+            m_points.push_back(boost::addressof(*it));
+            m_prev.push_back(i > 0 ? index - 1 : is_ring ? info.first + count - 1 : npos);
+            m_next.push_back(i + 1 < count ? index + 1 : is_ring ? info.first : npos);
+            m_range.push_back(m_ranges.size());
+            m_removed.push_back(false);
+            m_version.push_back(0);
+        }
+
+        m_ranges.push_back(info);
+        return m_ranges.size() - 1;
+    }
+
+    inline void apply(area_type const& max_area, bool preserve_topology)
+    {
+        if (preserve_topology)
+        {
+            std::vector<rtree_value_type> points;
+            points.reserve(m_points.size());
+            for (std::size_t i = 0; i < m_points.size(); ++i)
+            {
+                points.push_back(std::make_pair(*m_points[i], i));
+            }
+            m_rtree = rtree_type(points);
+        }
+
+        // The ranges are simplified one after another, with smaller heaps
+        std::vector<heap_entry> heap;
+        for (range_info const& info : m_ranges)
+        {
+            heap.clear();
+            for (std::size_t i = info.first; i < info.first + info.count; ++i)
+            {
+                if (is_removable(i))
+                {
+                    heap.push_back(heap_entry{triangle_area(i), i, 0});
+                }
+            }
+            std::make_heap(heap.begin(), heap.end());
+
+            apply(heap, max_area, preserve_topology);
+        }
+    }
+
+    // Copies the points of a range, in the original order. The first point
+    // of a ring is the first one which is not removed.
+    template <typename OutputIterator>
+    inline OutputIterator copy(std::size_t range_index, OutputIterator out,
+                               bool close) const
+    {
+        range_info const& info = m_ranges[range_index];
+        std::size_t start = info.first;
+        std::size_t const end = info.first + info.count;
+        while (start < end && m_removed[start])
+        {
+            ++start;
+        }
+        if (start == end)
+        {
+            return out;
+        }
+
+        std::size_t i = start;
+        do
+        {
+            *out = *m_points[i];
+            ++out;
+            i = m_next[i];
+        }
+        while (i != npos && i != start);
+
+        if (close && info.is_ring && info.count > 1)
+        {
+            *out = *m_points[start];
+            ++out;
+        }
+        return out;
+    }
+
+private:
+    inline bool is_removable(std::size_t i) const
+    {
+        range_info const& info = m_ranges[m_range[i]];
+        return info.is_ring
+             ? info.remaining > 3
+             : m_prev[i] != npos && m_next[i] != npos;
+    }
+
+    inline area_type triangle_area(std::size_t i) const
+    {
+        return math::abs(signed_triangle_area(m_prev[i], i, m_next[i]));
+    }
+
+    inline area_type signed_triangle_area(std::size_t p0, std::size_t p1,
+                                          std::size_t p2) const
+    {
+        area_state_type state;
+        m_area_strategy.apply(*m_points[p0], *m_points[p1], state);
+        m_area_strategy.apply(*m_points[p1], *m_points[p2], state);
+        m_area_strategy.apply(*m_points[p2], *m_points[p0], state);
+        return m_area_strategy.result(state);
+    }
+
+    inline void apply(std::vector<heap_entry>& heap, area_type const& max_area,
+                      bool preserve_topology)
+    {
+        while (! heap.empty())
+        {
+            std::pop_heap(heap.begin(), heap.end());
+            heap_entry const top = heap.back();
+            heap.pop_back();
+
+            std::size_t const i = top.index;
+            if (m_removed[i] || top.version != m_version[i])
+            {
+                continue;
+            }
+            if (! (top.area < max_area))
+            {
+                break;
+            }
+            if (! is_removable(i))
+            {
+                continue;
+            }
+
+            std::size_t const prev = m_prev[i];
+            std::size_t const next = m_next[i];
+            if (preserve_topology && ! is_removal_valid(prev, i, next))
+            {
+                // The point is reconsidered if its neighbours are removed
+                continue;
+            }
+
+            m_removed[i] = true;
+            m_next[prev] = next;
+            m_prev[next] = prev;
+            m_ranges[m_range[i]].remaining--;
+
+            if (preserve_topology)
+            {
+                m_rtree.remove(std::make_pair(*m_points[i], i));
+            }
+
+            update(prev, top.area, heap);
+            update(next, top.area, heap);
+        }
+    }
+
+    inline void update(std::size_t i, area_type const& removed_area,
+                       std::vector<heap_entry>& heap)
+    {
+        if (! is_removable(i))
+        {
+            return;
+        }
+
+        // The effective area of the neighbours can't be smaller than the area
+        // of the removed point so they are not removed before it
+        area_type area = triangle_area(i);
+        if (area < removed_area)
+        {
+            area = removed_area;
+        }
+        heap.push_back(heap_entry{area, i, ++m_version[i]});
+        std::push_heap(heap.begin(), heap.end());
+    }
+
+    // Returns true if the point is in the interior or on the boundary
+    // of the triangle. The point has to be in the box of the triangle,
+    // is_removal_valid() passes only the points found in this box.
+    inline bool covered_by_triangle(Point const& p, Point const& a,
+                                    Point const& i, Point const& b) const
+    {
+        int const side = m_side_strategy.apply(a, i, b);
+        if (side == 0)
+        {
+            // Degenerate triangle, the point is on it if it is collinear
+            // because it is in its box
+            return m_side_strategy.apply(a, b, p) == 0
+                && m_side_strategy.apply(a, i, p) == 0;
+        }
+        return m_side_strategy.apply(a, i, p) * side >= 0
+            && m_side_strategy.apply(i, b, p) * side >= 0
+            && m_side_strategy.apply(b, a, p) * side >= 0;
+    }
+
+    inline bool is_removal_valid(std::size_t prev, std::size_t i, std::size_t next)
+    {
+        Point const& a = *m_points[prev];
+        Point const& p = *m_points[i];
+        Point const& b = *m_points[next];
+
+        box_type box;
+        geometry::envelope(model::referring_segment<Point const>(a, p), box);
+        geometry::expand(box, b);
+
+        m_found.clear();
+        m_rtree.query(index::intersects(box), std::back_inserter(m_found));
+
+        for (rtree_value_type const& value : m_found)
+        {
+            std::size_t const index = value.second;
+            if (index == prev || index == i || index == next)
+            {
+                continue;
+            }
+
+            if (covered_by_triangle(value.first, a, p, b))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    area_strategy_type m_area_strategy;
+    side_strategy_type m_side_strategy;
+
+    std::vector<Point const*> m_points;
+    std::vector<std::size_t> m_prev;
+    std::vector<std::size_t> m_next;
+    std::vector<std::size_t> m_range;
+    std::vector<bool> m_removed;
+    std::vector<std::size_t> m_version;
+    std::vector<range_info> m_ranges;
+
+    rtree_type m_rtree;
+    std::vector<rtree_value_type> m_found;
+};
+
+
+}} // namespace detail::simplify
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_SIMPLIFY_VISVALINGAM_WHYATT_HPP
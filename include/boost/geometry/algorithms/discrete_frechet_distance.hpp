@@ -16,20 +16,15 @@
 #define BOOST_GEOMETRY_ALGORITHMS_DISCRETE_FRECHET_DISTANCE_HPP
 
 #include <algorithm>
-
-#ifdef BOOST_GEOMETRY_DEBUG_FRECHET_DISTANCE
-#include <iostream>
-#endif
-
-#include <iterator>
-#include <utility>
+#include <cstddef>
 #include <vector>
-#include <limits>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/size.hpp>
 
 #include <boost/geometry/algorithms/detail/dummy_geometries.hpp>
 #include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
 #include <boost/geometry/algorithms/not_implemented.hpp>
-#include <boost/geometry/core/assert.hpp>
 #include <boost/geometry/core/tag.hpp>
 #include <boost/geometry/core/tags.hpp>
 #include <boost/geometry/core/point_type.hpp>
@@ -38,7 +33,8 @@
 #include <boost/geometry/strategies/discrete_distance/geographic.hpp>
 #include <boost/geometry/strategies/discrete_distance/spherical.hpp>
 #include <boost/geometry/strategies/distance_result.hpp>
-#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/strategies/parallel.hpp>
+#include <boost/geometry/util/parallel.hpp>
 
 
 namespace boost { namespace geometry
@@ -50,24 +46,231 @@ namespace detail { namespace discrete_frechet_distance
 
 // TODO: The implementation should calculate comparable distances
 
-template <typename SizeType1, typename SizeType2, typename ResultType>
-class coup_mat
+// The coupling measures are calculated row by row for the points of the
+// longer linestring, the rows are indexed by the points of the shorter one.
+// The distance(i, j) functor returns the distance between the i-th point of
+// the longer linestring and the j-th point of the shorter one.
+
+// Calculates the coupling measures of the tile of rows [r0, r1) and columns
+// [c0, c1). On input row contains the measures of the row r0 - 1, col
+// the measures of the column c0 - 1 and corner the measure of the cell
+// (r0 - 1, c0 - 1). On output row contains the measures of the row r1 - 1
+// and col the measures of the column c1 - 1. The values of the previous
+// column are not needed in the first one and not stored in the last one.
+template <typename Result, typename Distance>
+inline void coupling_tile(std::size_t r0, std::size_t r1,
+                          std::size_t c0, std::size_t c1,
+                          bool store_col, Result corner,
+                          std::vector<Result>& row, std::vector<Result>& col,
+                          Distance const& distance)
+{
+    Result left_diag = corner;
+    for (std::size_t i = r0 ; i < r1 ; ++i)
+    {
+        Result diag = left_diag;
+        Result prev = diag;
+        if (c0 > 0)
+        {
+            prev = col[i];
+            left_diag = prev;
+        }
+
+        for (std::size_t j = c0 ; j < c1 ; ++j)
+        {
+            Result const dis = distance(i, j);
+            Result const up = row[j];
+            Result value = dis;
+            if (i > 0 && j > 0)
+            {
+                value = (std::max)((std::min)(prev, (std::min)(up, diag)), dis);
+            }
+            else if (j > 0)
+            {
+                value = (std::max)(prev, dis);
+            }
+            else if (i > 0)
+            {
+                value = (std::max)(up, dis);
+            }
+            diag = up;
+            row[j] = value;
+            prev = value;
+        }
+
+        if (store_col)
+        {
+            col[i] = prev;
+        }
+    }
+}
+
+// Sequential calculation of the measures with one row, in O(b) memory
+template <typename Result, typename Distance>
+inline Result coupling_measure(std::size_t a, std::size_t b,
+                               Distance const& distance)
 {
-public:
-    coup_mat(SizeType1 w, SizeType2 h)
-        : m_data(w * h,-1), m_width(w), m_height(h)
-    {}
+    std::vector<Result> row(b);
+    std::vector<Result> col;
+    coupling_tile(0, a, 0, b, false, Result(), row, col, distance);
+    return row[b - 1];
+}
 
-    ResultType & operator()(SizeType1 i, SizeType2 j)
+// Parallel calculation of the measures. The matrix is divided into tiles
+// which are calculated in the order of anti-diagonals, the tiles of the
+// same anti-diagonal in parallel. The boundary row and column are kept
+// so the memory is O(a + b). The result is the same as the sequential one.
+template <typename Result, typename Distance>
+inline Result coupling_measure(std::size_t a, std::size_t b,
+                               Distance const& distance,
+                               std::size_t threads)
+{
+    std::size_t const tile_size = 256;
+    if (threads <= 1 || b < 2 * tile_size)
     {
-        BOOST_GEOMETRY_ASSERT(i < m_width && j < m_height);
-        return m_data[j * m_width + i];
+        return coupling_measure<Result>(a, b, distance);
     }
 
-private:
-    std::vector<ResultType> m_data;
-    SizeType1 m_width;
-    SizeType2 m_height;
+    std::size_t const tile_rows = (a + tile_size - 1) / tile_size;
+    std::size_t const tile_cols = (b + tile_size - 1) / tile_size;
+
+    std::vector<Result> row(b);
+    std::vector<Result> col(a);
+    // The measure of the cell above and to the left of the next tile
+    // in each row of tiles. The tile to the left, calculating the same
+    // row of tiles for the previous anti-diagonal, stores it before it
+    // overwrites the boundary row.
+    std::vector<Result> corners(tile_rows);
+
+    for (std::size_t d = 0 ; d < tile_rows + tile_cols - 1 ; ++d)
+    {
+        std::size_t const first = d < tile_cols ? 0 : d - tile_cols + 1;
+        std::size_t const last = (std::min)(d + 1, tile_rows);
+
+        geometry::detail::parallel::for_each_index(last - first, threads,
+            [&](std::size_t k)
+            {
+                std::size_t const ti = first + k;
+                std::size_t const tj = d - ti;
+                std::size_t const r0 = ti * tile_size;
+                std::size_t const r1 = (std::min)(r0 + tile_size, a);
+                std::size_t const c0 = tj * tile_size;
+                std::size_t const c1 = (std::min)(c0 + tile_size, b);
+
+                Result const corner = corners[ti];
+                corners[ti] = row[c1 - 1];
+                coupling_tile(r0, r1, c0, c1, c1 < b, corner, row, col, distance);
+            });
+    }
+
+    return row[b - 1];
+}
+
+// Returns true if the measure is not greater than max_distance. Only the
+// reachable cells are stored, i.e. the cells for which a coupling with
+// the measure not greater than max_distance exists. They are calculated
+// from the first reachable cell of the previous row until there are
+// no more reachable cells in this row. The calculation stops if there
+// are no reachable cells in a row.
+template <typename Result, typename Distance>
+inline bool coupling_measure_within(std::size_t a, std::size_t b,
+                                    Distance const& distance,
+                                    Result const& max_distance)
+{
+    if (distance(0, 0) > max_distance || distance(a - 1, b - 1) > max_distance)
+    {
+        return false;
+    }
+
+    std::vector<char> prev(b, 0), cur(b, 0);
+
+    // The range of reachable cells in the previous row
+    std::size_t lo = 0;
+    std::size_t hi = 0;
+    for (std::size_t j = 0 ; j < b && distance(0, j) <= max_distance ; ++j)
+    {
+        prev[j] = 1;
+        hi = j;
+    }
+
+    for (std::size_t i = 1 ; i < a ; ++i)
+    {
+        std::size_t new_lo = b;
+        std::size_t new_hi = 0;
+        bool left = false;
+        for (std::size_t j = lo ; j < b ; ++j)
+        {
+            bool const up = j <= hi && prev[j];
+            bool const diag = j > lo && j - 1 <= hi && prev[j - 1];
+            if (! left && ! up && ! diag)
+            {
+                if (j > hi)
+                {
+                    break;
+                }
+                cur[j] = 0;
+                continue;
+            }
+
+            left = distance(i, j) <= max_distance;
+            cur[j] = left ? 1 : 0;
+            if (left)
+            {
+                new_lo = (std::min)(new_lo, j);
+                new_hi = j;
+            }
+        }
+
+        if (new_lo == b)
+        {
+            return false;
+        }
+
+        prev.swap(cur);
+        lo = new_lo;
+        hi = new_hi;
+    }
+
+    return hi == b - 1 && prev[b - 1];
+}
+
+// Calls the function with the number of rows, columns and the distance
+// functor for the linestrings, the longer one corresponding to the rows
+template <typename Linestring1, typename Linestring2, typename Strategy,
+          typename Function>
+inline auto call_with_distance(Linestring1 const& ls1, Linestring2 const& ls2,
+                               Strategy const& strategy, Function const& function)
+{
+    std::size_t const a = boost::size(ls1);
+    std::size_t const b = boost::size(ls2);
+
+    auto const it1 = boost::begin(ls1);
+    auto const it2 = boost::begin(ls2);
+
+    if (a >= b)
+    {
+        return function(a, b, [&](std::size_t i, std::size_t j)
+        {
+            return strategy.apply(*(it1 + i), *(it2 + j));
+        });
+    }
+    else
+    {
+        return function(b, a, [&](std::size_t i, std::size_t j)
+        {
+            return strategy.apply(*(it1 + j), *(it2 + i));
+        });
+    }
+}
+
+template <typename Linestring1, typename Linestring2, typename Strategies>
+struct linestring_linestring_result
+{
+    typedef typename distance_result
+        <
+            typename point_type<Linestring1>::type,
+            typename point_type<Linestring2>::type,
+            Strategies
+        >::type type;
 };
 
 struct linestring_linestring
@@ -76,64 +279,50 @@ struct linestring_linestring
     static inline auto apply(Linestring1 const& ls1, Linestring2 const& ls2,
                              Strategies const& strategies)
     {
-        typedef typename distance_result
+        typedef typename linestring_linestring_result
             <
-                typename point_type<Linestring1>::type,
-                typename point_type<Linestring2>::type,
-                Strategies
+                Linestring1, Linestring2, Strategies
             >::type result_type;
-        typedef typename boost::range_size<Linestring1>::type size_type1;
-        typedef typename boost::range_size<Linestring2>::type size_type2;
 
         boost::geometry::detail::throw_on_empty_input(ls1);
         boost::geometry::detail::throw_on_empty_input(ls2);
 
         // We can assume the inputs are not empty
         auto const strategy = strategies.distance(dummy_point(), dummy_point());
+        std::size_t const threads = strategies::detail::threads(strategies);
 
-        size_type1 const a = boost::size(ls1);
-        size_type2 const b = boost::size(ls2);
+        return call_with_distance(ls1, ls2, strategy,
+            [&](std::size_t a, std::size_t b, auto const& distance)
+            {
+                return coupling_measure<result_type>(a, b, distance, threads);
+            });
+    }
 
-        //Coupling Matrix CoupMat(a,b,-1);
-        coup_mat<size_type1, size_type2, result_type> coup_matrix(a, b);
+    template
+    <
+        typename Linestring1, typename Linestring2,
+        typename Distance, typename Strategies
+    >
+    static inline bool apply(Linestring1 const& ls1, Linestring2 const& ls2,
+                             Distance const& max_distance,
+                             Strategies const& strategies)
+    {
+        typedef typename linestring_linestring_result
+            <
+                Linestring1, Linestring2, Strategies
+            >::type result_type;
 
-        result_type const not_feasible = -100;
-        //findin the Coupling Measure
-        for (size_type1 i = 0 ; i < a ; i++ )
-        {
-            for (size_type2 j = 0 ; j < b ; j++ )
-            {
-                result_type dis = strategy.apply(range::at(ls1,i), range::at(ls2,j));
-                if(i==0 && j==0)
-                    coup_matrix(i,j) = dis;
-                else if(i==0 && j>0)
-                    coup_matrix(i,j) =
-                        (std::max)(coup_matrix(i,j-1), dis);
-                else if(i>0 && j==0)
-                    coup_matrix(i,j) =
-                        (std::max)(coup_matrix(i-1,j), dis);
-                else if(i>0 && j>0)
-                    coup_matrix(i,j) =
-                        (std::max)((std::min)(coup_matrix(i,j-1),
-                                              (std::min)(coup_matrix(i-1,j),
-                                                         coup_matrix(i-1,j-1))),
-                                   dis);
-                else
-                    coup_matrix(i,j) = not_feasible;
-            }
-        }
+        boost::geometry::detail::throw_on_empty_input(ls1);
+        boost::geometry::detail::throw_on_empty_input(ls2);
 
-        #ifdef BOOST_GEOMETRY_DEBUG_FRECHET_DISTANCE
-        //Print CoupLing Matrix
-        for(size_type i = 0; i <a; i++)
-        {
-            for(size_type j = 0; j <b; j++)
-            std::cout << coup_matrix(i,j) << " ";
-            std::cout << std::endl;
-        }
-        #endif
+        auto const strategy = strategies.distance(dummy_point(), dummy_point());
+        result_type const max = max_distance;
 
-        return coup_matrix(a-1,b-1);
+        return call_with_distance(ls1, ls2, strategy,
+            [&](std::size_t a, std::size_t b, auto const& distance)
+            {
+                return coupling_measure_within(a, b, distance, max);
+            });
     }
 };
 
@@ -186,6 +375,17 @@ struct discrete_frechet_distance
                 Geometry1, Geometry2
             >::apply(geometry1, geometry2, strategies);
     }
+
+    template <typename Geometry1, typename Geometry2, typename Distance>
+    static inline bool apply(Geometry1 const& geometry1, Geometry2 const& geometry2,
+                             Distance const& max_distance,
+                             Strategies const& strategies)
+    {
+        return dispatch::discrete_frechet_distance
+            <
+                Geometry1, Geometry2
+            >::apply(geometry1, geometry2, max_distance, strategies);
+    }
 };
 
 template <typename Strategy>
@@ -202,6 +402,19 @@ struct discrete_frechet_distance<Strategy, false>
             >::apply(geometry1, geometry2,
                      strategy_converter<Strategy>::get(strategy));
     }
+
+    template <typename Geometry1, typename Geometry2, typename Distance>
+    static inline bool apply(Geometry1 const& geometry1, Geometry2 const& geometry2,
+                             Distance const& max_distance,
+                             Strategy const& strategy)
+    {
+        using strategies::discrete_distance::services::strategy_converter;
+        return dispatch::discrete_frechet_distance
+            <
+                Geometry1, Geometry2
+            >::apply(geometry1, geometry2, max_distance,
+                     strategy_converter<Strategy>::get(strategy));
+    }
 };
 
 template <>
@@ -221,6 +434,22 @@ struct discrete_frechet_distance<default_strategy, false>
                 Geometry1, Geometry2
             >::apply(geometry1, geometry2, strategies_type());
     }
+
+    template <typename Geometry1, typename Geometry2, typename Distance>
+    static inline bool apply(Geometry1 const& geometry1, Geometry2 const& geometry2,
+                             Distance const& max_distance,
+                             default_strategy const&)
+    {
+        typedef typename strategies::discrete_distance::services::default_strategy
+            <
+                Geometry1, Geometry2
+            >::type strategies_type;
+
+        return dispatch::discrete_frechet_distance
+            <
+                Geometry1, Geometry2
+            >::apply(geometry1, geometry2, max_distance, strategies_type());
+    }
 };
 
 } // namespace resolve_strategy
@@ -237,6 +466,10 @@ struct discrete_frechet_distance<default_strategy, false>
 \param geometry2 Input geometry
 \param strategy Distance strategy to be used to calculate Pt-Pt distance
 
+\note The coupling measures are calculated in O(min(a, b)) memory. If
+    the strategy is wrapped in strategies::parallel the measures are
+    calculated in parallel in O(a + b) memory.
+
 \qbk{distinguish,with strategy}
 \qbk{[include reference/algorithms/discrete_frechet_distance.qbk]}
 
@@ -291,6 +524,65 @@ inline auto discrete_frechet_distance(Geometry1 const& geometry1,
             >::apply(geometry1, geometry2, default_strategy());
 }
 
+/*!
+\brief Check if discrete Frechet distance between two geometries (currently
+       works for LineString-LineString) is not greater than given distance
+       using specified strategy.
+\ingroup discrete_frechet_distance
+\details Only the couplings with the measure not greater than max_distance
+    are traced so the calculation stops early if the geometries are not
+    similar.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Distance Numeric type of the distance
+\tparam Strategy A type fulfilling a DistanceStrategy concept
+\param geometry1 Input geometry
+\param geometry2 Input geometry
+\param max_distance Maximum distance
+\param strategy Distance strategy to be used to calculate Pt-Pt distance
+\return True if the distance is not greater than max_distance
+
+\qbk{distinguish,with strategy}
+*/
+template
+<
+    typename Geometry1, typename Geometry2,
+    typename Distance, typename Strategy
+>
+inline bool discrete_frechet_distance_within(Geometry1 const& geometry1,
+                                             Geometry2 const& geometry2,
+                                             Distance const& max_distance,
+                                             Strategy const& strategy)
+{
+    return resolve_strategy::discrete_frechet_distance
+            <
+                Strategy
+            >::apply(geometry1, geometry2, max_distance, strategy);
+}
+
+/*!
+\brief Check if discrete Frechet distance between two geometries (currently
+       works for LineString-LineString) is not greater than given distance.
+\ingroup discrete_frechet_distance
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Distance Numeric type of the distance
+\param geometry1 Input geometry
+\param geometry2 Input geometry
+\param max_distance Maximum distance
+\return True if the distance is not greater than max_distance
+*/
+template <typename Geometry1, typename Geometry2, typename Distance>
+inline bool discrete_frechet_distance_within(Geometry1 const& geometry1,
+                                             Geometry2 const& geometry2,
+                                             Distance const& max_distance)
+{
+    return resolve_strategy::discrete_frechet_distance
+            <
+                default_strategy
+            >::apply(geometry1, geometry2, max_distance, default_strategy());
+}
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_ALGORITHMS_DISCRETE_FRECHET_DISTANCE_HPP
@@ -16,44 +16,177 @@
 #define BOOST_GEOMETRY_ALGORITHMS_DISCRETE_HAUSDORFF_DISTANCE_HPP
 
 #include <algorithm>
-
-#ifdef BOOST_GEOMETRY_DEBUG_HAUSDORFF_DISTANCE
-#include <iostream>
-#endif
-
+#include <cstddef>
 #include <iterator>
-#include <utility>
 #include <vector>
-#include <limits>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/throw_exception.hpp>
 
 #include <boost/geometry/algorithms/detail/dummy_geometries.hpp>
 #include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
 #include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/exception.hpp>
 #include <boost/geometry/core/point_type.hpp>
 #include <boost/geometry/core/tag.hpp>
 #include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/iterators/point_iterator.hpp>
 #include <boost/geometry/strategies/detail.hpp>
 #include <boost/geometry/strategies/discrete_distance/cartesian.hpp>
 #include <boost/geometry/strategies/discrete_distance/geographic.hpp>
 #include <boost/geometry/strategies/discrete_distance/spherical.hpp>
 #include <boost/geometry/strategies/distance_result.hpp>
+#include <boost/geometry/strategies/parallel.hpp>
+#include <boost/geometry/util/parallel.hpp>
 #include <boost/geometry/util/range.hpp>
 
-// Note that in order for this to work umbrella strategy has to contain
-// index strategies.
-#ifdef BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
-#include <boost/geometry/index/rtree.hpp>
-#endif // BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
 
 namespace boost { namespace geometry
 {
 
+namespace index
+{
+
+// Forward declarations, the rtree has to be included by the user
+template <typename Value, typename Options, typename IndexableGetter, typename EqualTo, typename Allocator>
+class rtree;
+
+namespace detail { namespace predicates
+{
+
+template <typename PointOrRelation>
+struct nearest;
+
+}} // namespace detail::predicates
+
+} // namespace index
+
 #ifndef DOXYGEN_NO_DETAIL
 namespace detail { namespace discrete_hausdorff_distance
 {
 
 // TODO: The implementation should calculate comparable distances
 
+// Returns the maximum of max_dis and the distances of the points of
+// [first, last) to the nearest points of rng. The scanning of the points
+// of rng is stopped as soon as a point closer than the current maximum
+// is found because such point can't increase the maximum. The scanning
+// starts at the nearest point of the previous point which for similar
+// geometries is likely to be close.
+template <typename Iterator, typename Range, typename Strategy, typename Result>
+inline Result max_nearest_distance(Iterator first, Iterator last,
+                                   Range const& rng, Strategy const& strategy,
+                                   Result max_dis)
+{
+    std::size_t const n = boost::size(rng);
+    auto const begin = boost::begin(rng);
+
+    std::size_t start = 0;
+    for ( ; first != last ; ++first)
+    {
+        Result dis_min = 0;
+        std::size_t nearest = start;
+        std::size_t k = start;
+        for (std::size_t c = 0 ; c < n ; c++)
+        {
+            Result const dis_temp = strategy.apply(*first, *(begin + k));
+            if (c == 0 || dis_temp < dis_min)
+            {
+                dis_min = dis_temp;
+                nearest = k;
+                if (dis_min <= max_dis)
+                {
+                    break;
+                }
+            }
+            if (++k == n)
+            {
+                k = 0;
+            }
+        }
+
+        start = nearest;
+        if (dis_min > max_dis)
+        {
+            max_dis = dis_min;
+        }
+    }
+    return max_dis;
+}
+
+// The same for the points stored in the rtree. The nearest point is found
+// with the rtree unless the nearest point of the previous point is closer
+// than the current maximum.
+template <typename Iterator, typename Rtree, typename Strategy, typename Result>
+inline Result max_nearest_distance_indexed(Iterator first, Iterator last,
+                                           Rtree const& rtree, Strategy const& strategy,
+                                           Result max_dis)
+{
+    typedef typename std::iterator_traits<Iterator>::value_type point_t;
+    typedef index::detail::predicates::nearest<point_t> nearest_type;
+
+    auto const& get = rtree.indexable_get();
+
+    std::vector<typename Rtree::value_type> found;
+    for ( ; first != last ; ++first)
+    {
+        if (! found.empty()
+            && ! (strategy.apply(*first, get(found.front())) > max_dis))
+        {
+            continue;
+        }
+
+        found.clear();
+        rtree.query(nearest_type(*first, 1), std::back_inserter(found));
+        if (found.empty())
+        {
+            continue;
+        }
+
+        Result const dis_min = strategy.apply(*first, get(found.front()));
+        if (dis_min > max_dis)
+        {
+            max_dis = dis_min;
+        }
+    }
+    return max_dis;
+}
+
+// Calls function(first, last, max_dis) for [first, last) or in parallel for
+// its chunks and returns the maximum of the results. The result is the same.
+template <typename Iterator, typename Result, typename Function>
+inline Result max_of_chunks(Iterator first, Iterator last, Result const& max_dis,
+                            std::size_t threads, Function const& function)
+{
+    std::size_t const min_chunk_size = 64;
+
+    std::size_t const count = std::distance(first, last);
+    std::size_t const chunks = (std::min)(count / min_chunk_size, threads * 4);
+    if (threads <= 1 || chunks <= 1)
+    {
+        return function(first, last, max_dis);
+    }
+
+    std::vector<Iterator> bounds(1, first);
+    for (std::size_t c = 1 ; c < chunks ; c++)
+    {
+        Iterator it = bounds.back();
+        std::advance(it, count * c / chunks - count * (c - 1) / chunks);
+        bounds.push_back(it);
+    }
+    bounds.push_back(last);
+
+    std::vector<Result> results(chunks, max_dis);
+    geometry::detail::parallel::for_each_index(chunks, threads, [&](std::size_t c)
+    {
+        results[c] = function(bounds[c], bounds[c + 1], max_dis);
+    });
+
+    return *std::max_element(results.begin(), results.end());
+}
+
 struct point_range
 {
     template <typename Point, typename Range, typename Strategies>
@@ -103,36 +236,25 @@ struct range_range
                 Strategies
             >::type result_type;
 
-        typedef typename boost::range_size<Range1>::type size_type;
+        return apply(r1, r2, strategies, result_type(0));
+    }
 
+    // Returns the greater of the distance and max_dis
+    template <typename Range1, typename Range2, typename Strategies, typename Result>
+    static inline Result apply(Range1 const& r1, Range2 const& r2,
+                               Strategies const& strategies, Result const& max_dis)
+    {
         boost::geometry::detail::throw_on_empty_input(r1);
         boost::geometry::detail::throw_on_empty_input(r2);
 
-        size_type const n = boost::size(r1);
-        result_type dis_max = 0;
-
-#ifdef BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
-        namespace bgi = boost::geometry::index;
-        typedef typename point_type<Range1>::type point_t;
-        typedef bgi::rtree<point_t, bgi::linear<4> > rtree_type;
-        rtree_type rtree(boost::begin(r2), boost::end(r2));
-        point_t res;
-#endif
+        auto const strategy = strategies.distance(dummy_point(), dummy_point());
 
-        for (size_type i = 0 ; i < n ; i++)
-        {
-#ifdef BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
-            size_type found = rtree.query(bgi::nearest(range::at(r1, i), 1), &res);
-            result_type dis_min = strategy.apply(range::at(r1,i), res);
-#else
-            result_type dis_min = point_range::apply(range::at(r1, i), r2, strategies);
-#endif
-            if (dis_min > dis_max )
+        return max_of_chunks(boost::begin(r1), boost::end(r1), max_dis,
+                             strategies::detail::threads(strategies),
+            [&](auto first, auto last, Result const& chunk_max)
             {
-                dis_max = dis_min;
-            }
-        }
-        return dis_max;
+                return max_nearest_distance(first, last, r2, strategy, chunk_max);
+            });
     }
 };
 
@@ -159,11 +281,7 @@ struct range_multi_range
 
         for (size_type j = 0 ; j < b ; j++)
         {
-            result_type dis_max = range_range::apply(rng, range::at(mrng, j), strategies);
-            if (dis_max > haus_dis)
-            {
-                haus_dis = dis_max;
-            }
+            haus_dis = range_range::apply(rng, range::at(mrng, j), strategies, haus_dis);
         }
 
         return haus_dis;
@@ -203,6 +321,72 @@ struct multi_range_multi_range
     }
 };
 
+// The distance of the points of a geometry to the points stored in an rtree
+struct geometry_rtree
+{
+    template <typename Geometry, typename Rtree, typename Strategies>
+    static inline auto apply(Geometry const& geometry, Rtree const& rtree,
+                             Strategies const& strategies)
+    {
+        return apply(geometry::points_begin(geometry), geometry::points_end(geometry),
+                     rtree, strategies);
+    }
+
+    template <typename Iterator, typename Rtree, typename Strategies>
+    static inline auto apply(Iterator first, Iterator last, Rtree const& rtree,
+                             Strategies const& strategies)
+    {
+        typedef typename distance_result
+            <
+                typename std::iterator_traits<Iterator>::value_type,
+                typename Rtree::indexable_type,
+                Strategies
+            >::type result_type;
+
+#if ! defined(BOOST_GEOMETRY_EMPTY_INPUT_NO_THROW)
+        if (first == last || rtree.empty())
+        {
+            BOOST_THROW_EXCEPTION(empty_input_exception());
+        }
+#endif
+
+        auto const strategy = strategies.distance(dummy_point(), dummy_point());
+
+        return max_of_chunks(first, last, result_type(0),
+                             strategies::detail::threads(strategies),
+            [&](Iterator first, Iterator last, result_type const& chunk_max)
+            {
+                return max_nearest_distance_indexed(first, last, rtree, strategy, chunk_max);
+            });
+    }
+};
+
+struct point_rtree
+{
+    template <typename Point, typename Rtree, typename Strategies>
+    static inline auto apply(Point const& point, Rtree const& rtree,
+                             Strategies const& strategies)
+    {
+        return geometry_rtree::apply(&point, &point + 1, rtree, strategies);
+    }
+};
+
+// The geometry defining the default strategy, for rtrees the indexable
+template <typename Geometry>
+struct strategy_geometry
+{
+    typedef Geometry type;
+};
+
+template <typename Value, typename Options, typename IndexableGetter, typename EqualTo, typename Allocator>
+struct strategy_geometry<index::rtree<Value, Options, IndexableGetter, EqualTo, Allocator> >
+{
+    typedef typename index::rtree
+        <
+            Value, Options, IndexableGetter, EqualTo, Allocator
+        >::indexable_type type;
+};
+
 }} // namespace detail::hausdorff_distance
 #endif // DOXYGEN_NO_DETAIL
 
@@ -249,6 +433,26 @@ struct discrete_hausdorff_distance<MultiLinestring1, MultiLinestring2, multi_lin
     : detail::discrete_hausdorff_distance::multi_range_multi_range
 {};
 
+// Specialization for Point and the points stored in an rtree
+template <typename Point, typename Value, typename Options, typename IndexableGetter, typename EqualTo, typename Allocator>
+struct discrete_hausdorff_distance
+    <
+        Point, index::rtree<Value, Options, IndexableGetter, EqualTo, Allocator>,
+        point_tag, void
+    >
+    : detail::discrete_hausdorff_distance::point_rtree
+{};
+
+// Specialization for other geometries and the points stored in an rtree
+template <typename Geometry, typename Value, typename Options, typename IndexableGetter, typename EqualTo, typename Allocator, typename Tag>
+struct discrete_hausdorff_distance
+    <
+        Geometry, index::rtree<Value, Options, IndexableGetter, EqualTo, Allocator>,
+        Tag, void
+    >
+    : detail::discrete_hausdorff_distance::geometry_rtree
+{};
+
 } // namespace dispatch
 #endif // DOXYGEN_NO_DISPATCH
 
@@ -298,7 +502,11 @@ struct discrete_hausdorff_distance<default_strategy, false>
     {
         typedef typename strategies::discrete_distance::services::default_strategy
             <
-                Geometry1, Geometry2
+                Geometry1,
+                typename detail::discrete_hausdorff_distance::strategy_geometry
+                    <
+                        Geometry2
+                    >::type
             >::type strategies_type;
 
         return dispatch::discrete_hausdorff_distance
@@ -323,6 +531,14 @@ struct discrete_hausdorff_distance<default_strategy, false>
 \param geometry2 Input geometry
 \param strategy Distance strategy to be used to calculate Pt-Pt distance
 
+\note The second geometry may also be an rtree of points, e.g. built once
+    from the points of a geometry compared with many others. The distance
+    of the points of the first geometry to the points stored in the rtree
+    is returned. The rtree has to find the nearest points in the same
+    coordinate system.
+\note If the strategy is wrapped in strategies::parallel the points
+    of the first geometry are processed in parallel.
+
 \qbk{distinguish,with strategy}
 \qbk{[include reference/algorithms/discrete_hausdorff_distance.qbk]}
 
@@ -0,0 +1,57 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_PREPARE_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_PREPARE_HPP
+
+
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/detail/prepared/implementation.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/relate.hpp>
+#include <boost/geometry/algorithms/relation.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/prepared_geometry.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief \brief_calc{prepared geometry}
+\ingroup prepare
+\details Builds the index of the edges of a polygon or a multi_polygon. The
+    returned prepared geometry may be passed to within, covered_by, disjoint,
+    intersects and relate in place of the geometry. Checking many points,
+    segments or linear geometries against the same areal geometry is then
+    faster. The geometry has to outlive the prepared geometry and must not be
+    modified.
+\tparam Geometry \tparam_geometry
+\param geometry \param_geometry which will be prepared
+\return The prepared geometry referring to the geometry
+*/
+template <typename Geometry>
+inline model::prepared_geometry<Geometry> prepare(Geometry const& geometry)
+{
+    concepts::check<Geometry const>();
+
+    return model::prepared_geometry<Geometry>(geometry);
+}
+
+// The prepared geometry refers to the geometry so it can't be a temporary
+template <typename Geometry>
+void prepare(Geometry const&&) = delete;
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_PREPARE_HPP
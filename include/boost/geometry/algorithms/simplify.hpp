@@ -37,6 +37,7 @@
 #include <boost/geometry/algorithms/convert.hpp>
 #include <boost/geometry/algorithms/detail/dummy_geometries.hpp>
 #include <boost/geometry/algorithms/detail/equals/point_point.hpp>
+#include <boost/geometry/algorithms/detail/simplify/visvalingam_whyatt.hpp>
 #include <boost/geometry/algorithms/detail/visit.hpp>
 #include <boost/geometry/algorithms/not_implemented.hpp>
 #include <boost/geometry/algorithms/is_empty.hpp>
@@ -60,7 +61,9 @@
 #include <boost/geometry/strategies/simplify/cartesian.hpp>
 #include <boost/geometry/strategies/simplify/geographic.hpp>
 #include <boost/geometry/strategies/simplify/spherical.hpp>
+#include <boost/geometry/strategies/simplify/visvalingam_whyatt.hpp>
 
+#include <boost/geometry/util/math.hpp>
 #include <boost/geometry/util/type_traits_std.hpp>
 
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
@@ -262,6 +265,67 @@ public:
                           >::apply(cstrategy, max_distance),
                       cstrategy);
     }
+
+    // Check if it is useful to try other starting points of a ring.
+    // A minimal triangle has a perimeter of a bit more than 3 times
+    // the simplify distance
+    template <typename Ring, typename Distance, typename Strategies>
+    static inline bool is_simplified_away(Ring const& ring,
+                                          Distance const& max_distance,
+                                          Strategies const& strategies)
+    {
+        return geometry::perimeter(ring, strategies) < 3 * max_distance;
+    }
+};
+
+
+/*!
+\brief Implements the simplify algorithm.
+\details The visvalingam_whyatt policy simplifies a linestring, ring or
+    vector of points using the Visvalingam-Whyatt algorithm. The points
+    having the smallest effective area are removed first until all points
+    have effective area greater than or equal to the given one.
+*/
+
+/*
+For the algorithm, see for example:
+ - https://en.wikipedia.org/wiki/Visvalingam-Whyatt_algorithm
+*/
+class visvalingam_whyatt
+{
+public:
+    explicit visvalingam_whyatt(bool preserve_topology = false)
+        : m_preserve_topology(preserve_topology)
+    {}
+
+    template <typename Range, typename OutputIterator, typename Area, typename Strategies>
+    inline OutputIterator apply(Range const& range,
+                                OutputIterator out,
+                                Area const& max_area,
+                                Strategies const& strategies) const
+    {
+        typedef typename boost::range_value<Range>::type point_type;
+        typedef visvalingam_whyatt_simplifier<point_type, Strategies> simplifier_type;
+        typedef typename simplifier_type::area_type area_type;
+
+        simplifier_type simplifier(strategies);
+        std::size_t const index = simplifier.add_range(range, boost::size(range), false);
+        simplifier.apply(area_type(max_area), m_preserve_topology);
+        return simplifier.copy(index, out, false);
+    }
+
+    // The whole ring is simplified away if its area is less than the minimal
+    // effective area
+    template <typename Ring, typename Area, typename Strategies>
+    static inline bool is_simplified_away(Ring const& ring,
+                                          Area const& max_area,
+                                          Strategies const& strategies)
+    {
+        return math::abs(geometry::area(ring, strategies)) < max_area;
+    }
+
+private:
+    bool m_preserve_topology;
 };
 
 
@@ -520,10 +584,9 @@ public :
             geometry::clear(out);
 
             if (iteration == 0
-                && geometry::perimeter(ring, strategies) < 3 * max_distance)
+                && impl.is_simplified_away(ring, max_distance, strategies))
             {
-                // Check if it is useful to iterate. A minimal triangle has a
-                // perimeter of a bit more than 3 times the simplify distance
+                // Check if it is useful to iterate
                 return;
             }
 
@@ -765,6 +828,216 @@ struct simplify_insert<Ring, ring_tag>
 #endif // DOXYGEN_NO_DISPATCH
 
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace simplify
+{
+
+// Adds all ranges of a geometry to the visvalingam_whyatt_simplifier and
+// assigns the simplified ranges to the output geometry in the same order
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct topology_preserving_ranges
+{};
+
+template <typename Linestring>
+struct topology_preserving_ranges<Linestring, linestring_tag>
+{
+    template <typename Simplifier>
+    static inline void add(Linestring const& linestring, Simplifier& simplifier)
+    {
+        simplifier.add_range(linestring, boost::size(linestring), false);
+    }
+
+    template <typename Simplifier, typename LinestringOut>
+    static inline void assign(Simplifier const& simplifier, std::size_t& index,
+                              Linestring const& , LinestringOut& out)
+    {
+        simplifier.copy(index++, geometry::range::back_inserter(out), false);
+    }
+};
+
+template <typename Ring>
+struct topology_preserving_ranges<Ring, ring_tag>
+{
+    template <typename Simplifier>
+    static inline void add(Ring const& ring, Simplifier& simplifier)
+    {
+        std::size_t count = boost::size(ring);
+        if (geometry::closure<Ring>::value == closed && count > 1)
+        {
+            --count;
+        }
+        simplifier.add_range(ring, count, true);
+    }
+
+    template <typename Simplifier, typename RingOut>
+    static inline void assign(Simplifier const& simplifier, std::size_t& index,
+                              Ring const& , RingOut& out)
+    {
+        bool const is_closed_out = geometry::closure<RingOut>::value == closed;
+        bool const is_clockwise_in = geometry::point_order<Ring>::value == clockwise;
+        bool const is_clockwise_out = geometry::point_order<RingOut>::value == clockwise;
+
+        simplifier.copy(index++, geometry::range::back_inserter(out), is_closed_out);
+
+        if (BOOST_GEOMETRY_CONDITION(is_clockwise_in != is_clockwise_out))
+        {
+            std::reverse(boost::begin(out), boost::end(out));
+        }
+    }
+};
+
+template <typename Polygon>
+struct topology_preserving_ranges<Polygon, polygon_tag>
+{
+    typedef typename geometry::ring_type<Polygon>::type ring_in_type;
+    typedef topology_preserving_ranges<ring_in_type, ring_tag> ring_ranges;
+
+    template <typename Simplifier>
+    static inline void add(Polygon const& polygon, Simplifier& simplifier)
+    {
+        ring_ranges::add(exterior_ring(polygon), simplifier);
+        for (auto const& ring : interior_rings(polygon))
+        {
+            ring_ranges::add(ring, simplifier);
+        }
+    }
+
+    template <typename Simplifier, typename PolygonOut>
+    static inline void assign(Simplifier const& simplifier, std::size_t& index,
+                              Polygon const& polygon, PolygonOut& out)
+    {
+        typedef typename geometry::ring_type<PolygonOut>::type ring_out_type;
+
+        ring_ranges::assign(simplifier, index, exterior_ring(polygon), exterior_ring(out));
+
+        range::clear(interior_rings(out));
+        for (auto const& ring : interior_rings(polygon))
+        {
+            ring_out_type ring_out;
+            ring_ranges::assign(simplifier, index, ring, ring_out);
+            if (! geometry::is_empty(ring_out))
+            {
+                range::push_back(interior_rings(out), std::move(ring_out));
+            }
+        }
+    }
+};
+
+template <typename MultiGeometry>
+struct topology_preserving_multi_ranges
+{
+    typedef typename boost::range_value<MultiGeometry>::type single_type;
+
+    template <typename Simplifier>
+    static inline void add(MultiGeometry const& multi, Simplifier& simplifier)
+    {
+        for (auto it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            topology_preserving_ranges<single_type>::add(*it, simplifier);
+        }
+    }
+
+    template <typename Simplifier, typename MultiGeometryOut>
+    static inline void assign(Simplifier const& simplifier, std::size_t& index,
+                              MultiGeometry const& multi, MultiGeometryOut& out)
+    {
+        typedef typename boost::range_value<MultiGeometryOut>::type single_out_type;
+
+        range::clear(out);
+        for (auto it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            single_out_type single_out;
+            topology_preserving_ranges<single_type>::assign(simplifier, index, *it, single_out);
+            if (! geometry::is_empty(single_out))
+            {
+                range::push_back(out, std::move(single_out));
+            }
+        }
+    }
+};
+
+template <typename MultiLinestring>
+struct topology_preserving_ranges<MultiLinestring, multi_linestring_tag>
+    : topology_preserving_multi_ranges<MultiLinestring>
+{};
+
+template <typename MultiPolygon>
+struct topology_preserving_ranges<MultiPolygon, multi_polygon_tag>
+    : topology_preserving_multi_ranges<MultiPolygon>
+{};
+
+
+// Geometries without segments which could intersect are simplified as usual
+template
+<
+    typename GeometryIn, typename GeometryOut,
+    typename TagIn = typename tag<GeometryIn>::type
+>
+struct simplify_preserve_topology
+{
+    template <typename Area, typename Strategies>
+    static inline void apply(GeometryIn const& geometry, GeometryOut& out,
+                             Area const& max_area, Strategies const& strategies)
+    {
+        dispatch::simplify
+            <
+                GeometryIn, GeometryOut
+            >::apply(geometry, out, max_area, visvalingam_whyatt(true), strategies);
+    }
+};
+
+// Simplifies all ranges of a geometry together, with the Visvalingam-Whyatt
+// algorithm, not creating intersections between any of them
+template <typename GeometryIn, typename GeometryOut>
+struct simplify_preserve_topology_ranges
+{
+    template <typename Area, typename Strategies>
+    static inline void apply(GeometryIn const& geometry, GeometryOut& out,
+                             Area const& max_area, Strategies const& strategies)
+    {
+        typedef typename geometry::point_type<GeometryIn>::type point_type;
+        typedef visvalingam_whyatt_simplifier<point_type, Strategies> simplifier_type;
+        typedef typename simplifier_type::area_type area_type;
+        typedef topology_preserving_ranges<GeometryIn> ranges_type;
+
+        simplifier_type simplifier(strategies);
+        ranges_type::add(geometry, simplifier);
+        simplifier.apply(area_type(max_area), true);
+
+        std::size_t index = 0;
+        ranges_type::assign(simplifier, index, geometry, out);
+    }
+};
+
+template <typename GeometryIn, typename GeometryOut>
+struct simplify_preserve_topology<GeometryIn, GeometryOut, linestring_tag>
+    : simplify_preserve_topology_ranges<GeometryIn, GeometryOut>
+{};
+
+template <typename GeometryIn, typename GeometryOut>
+struct simplify_preserve_topology<GeometryIn, GeometryOut, ring_tag>
+    : simplify_preserve_topology_ranges<GeometryIn, GeometryOut>
+{};
+
+template <typename GeometryIn, typename GeometryOut>
+struct simplify_preserve_topology<GeometryIn, GeometryOut, polygon_tag>
+    : simplify_preserve_topology_ranges<GeometryIn, GeometryOut>
+{};
+
+template <typename GeometryIn, typename GeometryOut>
+struct simplify_preserve_topology<GeometryIn, GeometryOut, multi_linestring_tag>
+    : simplify_preserve_topology_ranges<GeometryIn, GeometryOut>
+{};
+
+template <typename GeometryIn, typename GeometryOut>
+struct simplify_preserve_topology<GeometryIn, GeometryOut, multi_polygon_tag>
+    : simplify_preserve_topology_ranges<GeometryIn, GeometryOut>
+{};
+
+}} // namespace detail::simplify
+#endif // DOXYGEN_NO_DETAIL
+
+
 namespace resolve_strategy
 {
 
@@ -790,6 +1063,34 @@ struct simplify
     }
 };
 
+template <typename Strategies>
+struct simplify<strategies::simplify::visvalingam_whyatt<Strategies>, true>
+{
+    template <typename GeometryIn, typename GeometryOut, typename Area>
+    static inline void apply(GeometryIn const& geometry,
+                             GeometryOut& out,
+                             Area const& max_area,
+                             strategies::simplify::visvalingam_whyatt<Strategies> const& strategies)
+    {
+        if (strategies.preserve_topology())
+        {
+            detail::simplify::simplify_preserve_topology
+                <
+                    GeometryIn, GeometryOut
+                >::apply(geometry, out, max_area, strategies);
+        }
+        else
+        {
+            dispatch::simplify
+                <
+                    GeometryIn, GeometryOut
+                >::apply(geometry, out, max_area,
+                         detail::simplify::visvalingam_whyatt(),
+                         strategies);
+        }
+    }
+};
+
 template <typename Strategy>
 struct simplify<Strategy, false>
 {
@@ -860,6 +1161,24 @@ struct simplify_insert
     }
 };
 
+template <typename Strategies>
+struct simplify_insert<strategies::simplify::visvalingam_whyatt<Strategies>, true>
+{
+    template<typename Geometry, typename OutputIterator, typename Area>
+    static inline void apply(Geometry const& geometry,
+                             OutputIterator& out,
+                             Area const& max_area,
+                             strategies::simplify::visvalingam_whyatt<Strategies> const& strategies)
+    {
+        dispatch::simplify_insert
+            <
+                Geometry
+            >::apply(geometry, out, max_area,
+                     detail::simplify::visvalingam_whyatt(strategies.preserve_topology()),
+                     strategies);
+    }
+};
+
 template <typename Strategy>
 struct simplify_insert<Strategy, false>
 {
@@ -982,7 +1301,9 @@ struct simplify<GeometryIn, GeometryOut, geometry_collection_tag, geometry_colle
 \param max_distance distance (in units of input coordinates) of a vertex
     to other segments to be removed
 \param strategy simplify strategy to be used for simplification
-\note The simplification is done with Douglas-Peucker algorithm
+\note The simplification is done with Douglas-Peucker algorithm unless
+    strategies::simplify::visvalingam_whyatt is passed. Then max_distance
+    is the minimal effective area of the vertices which are kept.
 
 \image html svg_simplify_country.png "The image below presents the simplified country"
 \qbk{distinguish,with strategy}
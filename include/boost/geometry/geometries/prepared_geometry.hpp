@@ -0,0 +1,186 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_GEOMETRIES_PREPARED_GEOMETRY_HPP
+#define BOOST_GEOMETRY_GEOMETRIES_PREPARED_GEOMETRY_HPP
+
+
+#include <cstddef>
+#include <type_traits>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/detail/prepared/edge_grid.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/util/type_traits.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace prepared
+{
+
+// Range interface of the prepared multi_polygon
+template <typename Derived, typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct prepared_geometry_range
+{};
+
+template <typename Derived, typename MultiPolygon>
+struct prepared_geometry_range<Derived, MultiPolygon, multi_polygon_tag>
+{
+    typedef typename boost::range_iterator<MultiPolygon const>::type const_iterator;
+    typedef const_iterator iterator;
+
+    const_iterator begin() const { return boost::begin(derived().geometry()); }
+    const_iterator end() const { return boost::end(derived().geometry()); }
+    std::size_t size() const { return boost::size(derived().geometry()); }
+
+private :
+    Derived const& derived() const { return static_cast<Derived const&>(*this); }
+};
+
+}} // namespace detail::prepared
+#endif // DOXYGEN_NO_DETAIL
+
+
+namespace model
+{
+
+/*!
+\brief Areal geometry prepared for repeated queries
+\details The prepared geometry refers to a polygon or a multi_polygon and
+    stores the index of its edges. It is adapted to the concept of the
+    referred geometry so it may be passed to the algorithms in its place.
+    Checking the location of a point (within, covered_by, disjoint,
+    intersects and relate) and disjoint or intersects with a segment or
+    a linear geometry use the index in cartesian coordinate system, other
+    operations use the referred geometry. The referred geometry has to
+    outlive the prepared geometry and must not be modified.
+\tparam Geometry polygon or multi_polygon
+\ingroup geometries
+*/
+template <typename Geometry>
+class prepared_geometry
+    : public geometry::detail::prepared::prepared_geometry_range<prepared_geometry<Geometry>, Geometry>
+{
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (util::is_polygon<Geometry>::value || util::is_multi_polygon<Geometry>::value),
+        "Only polygons and multi_polygons can be prepared.",
+        Geometry);
+
+    typedef typename geometry::point_type<Geometry>::type point_type;
+
+public :
+    typedef Geometry geometry_type;
+    typedef geometry::detail::prepared::edge_grid<point_type> index_type;
+
+    /// Constructs the prepared geometry and builds the index
+    explicit prepared_geometry(Geometry const& geometry)
+        : m_geometry(&geometry)
+    {
+        if (std::is_same
+                <
+                    typename cs_tag<Geometry>::type,
+                    cartesian_tag
+                >::value)
+        {
+            m_index.build(geometry);
+        }
+    }
+
+    prepared_geometry(Geometry const&&) = delete;
+
+    /// Returns the referred geometry
+    Geometry const& geometry() const { return *m_geometry; }
+
+    /// Returns the index of the edges
+    index_type const& index() const { return m_index; }
+
+private :
+    Geometry const* m_geometry;
+    index_type m_index;
+};
+
+
+} // namespace model
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <typename Geometry>
+struct tag<model::prepared_geometry<Geometry> >
+{
+    typedef typename geometry::tag<Geometry>::type type;
+};
+
+template <typename Geometry>
+struct ring_const_type<model::prepared_geometry<Geometry> >
+{
+    typedef typename ring_const_type<Geometry>::type type;
+};
+
+template <typename Geometry>
+struct ring_mutable_type<model::prepared_geometry<Geometry> >
+{
+    typedef typename ring_const_type<Geometry>::type type;
+};
+
+template <typename Geometry>
+struct interior_const_type<model::prepared_geometry<Geometry> >
+{
+    typedef typename interior_const_type<Geometry>::type type;
+};
+
+template <typename Geometry>
+struct interior_mutable_type<model::prepared_geometry<Geometry> >
+{
+    typedef typename interior_const_type<Geometry>::type type;
+};
+
+template <typename Geometry>
+struct exterior_ring<model::prepared_geometry<Geometry> >
+{
+    static inline typename ring_const_type<Geometry>::type
+        get(model::prepared_geometry<Geometry> const& p)
+    {
+        return geometry::exterior_ring(p.geometry());
+    }
+};
+
+template <typename Geometry>
+struct interior_rings<model::prepared_geometry<Geometry> >
+{
+    static inline typename interior_const_type<Geometry>::type
+        get(model::prepared_geometry<Geometry> const& p)
+    {
+        return geometry::interior_rings(p.geometry());
+    }
+};
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_GEOMETRIES_PREPARED_GEOMETRY_HPP
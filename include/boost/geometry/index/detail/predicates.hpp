@@ -116,6 +116,19 @@ struct path
     std::size_t count;
 };
 
+// predicates of the pairs of Values of two rtrees passed to join()
+
+struct join_intersects {};
+
+template <typename T>
+struct join_within_distance
+{
+    join_within_distance(T const& d)
+        : distance(d)
+    {}
+    T distance;
+};
+
 } // namespace predicates
 
 // ------------------------------------------------------------------ //
@@ -414,7 +427,7 @@ struct predicate_check<predicates::spatial_predicate<Geometry, predicates::disjo
 // !intersects(I,G) !covered_by(I,G)
 // !overlaps(I,G)   TRUE
 // !touches(I,G)    !intersects(I,G)
-// !within(I,G)     !within(I,G)
+// !within(I,G)     TRUE
 
 // negated spatial predicate - default
 template <typename Geometry, typename Tag>
@@ -429,6 +442,21 @@ struct predicate_check<predicates::spatial_predicate<Geometry, Tag, true>, bound
     }
 };
 
+// negated spatial predicate - within
+// a node within the geometry may contain values which are not within it,
+// e.g. lying on its boundary, so the nodes are always visited
+template <typename Geometry>
+struct predicate_check<predicates::spatial_predicate<Geometry, predicates::within_tag, true>, bounds_tag>
+{
+    typedef predicates::spatial_predicate<Geometry, predicates::within_tag, true> Pred;
+
+    template <typename Value, typename Indexable, typename Strategy>
+    static inline bool apply(Pred const& , Value const&, Indexable const&, Strategy const&)
+    {
+        return true;
+    }
+};
+
 // negated spatial predicate - contains
 template <typename Geometry>
 struct predicate_check<predicates::spatial_predicate<Geometry, predicates::contains_tag, true>, bounds_tag>
@@ -0,0 +1,542 @@
+// Boost.Geometry Index
+//
+// R-tree flat, pointer-free layout
+//
+// Copyright (c) 2026 Boost.Geometry contributors.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_LAYOUT_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_LAYOUT_HPP
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/util/algorithm.hpp>
+
+#include <boost/geometry/index/detail/exception.hpp>
+#include <boost/geometry/index/detail/rtree/node/node.hpp>
+#include <boost/geometry/index/detail/rtree/utilities/view.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree { namespace flat {
+
+// The layout of the data, all integers and objects are stored in native
+// representation, the sections are aligned to flat::alignment:
+//
+// header
+// nodes    - nodes_count x node, children of a node are stored contiguously
+//            and the nodes are stored level by level starting from the root
+// boxes    - the bounds of the nodes, 2 x dimension x nodes_count coordinates,
+//            see coordinates_offset(), or only the bounds of the root if the
+//            boxes are quantized
+// codes    - the quantized bounds of the nodes, 2 x dimension x nodes_count
+//            unsigned integers of quantization_bits bits, empty if the boxes
+//            are not quantized
+// values   - values_count x Value, values of a leaf are stored contiguously
+//
+// For an internal node node::first is the index of the first child node,
+// for a leaf it is the index of the first value.
+//
+// The boxes of the children of a node are stored contiguously as structure
+// of arrays: for each dimension the min coordinates of all children followed
+// by, for each dimension, the max coordinates of all children. This way the
+// children of a node may be scanned sequentially. The root is the only child
+// of an imaginary node.
+//
+// Quantized boxes are stored relative to the box of the parent node, after
+// the box of the parent is decoded. Each coordinate is one of 2^bits - 1
+// evenly spaced positions between the min and max coordinates of the parent,
+// rounded outward, so the decoded box contains the original one. The codes
+// are stored in the same order as the coordinates. The code of the root is
+// not used, its box is stored exactly.
+
+static const std::uint32_t magic = 0x52464742; // "BGFR" in little endian
+static const std::uint32_t version = 3;
+static const std::size_t alignment = 16;
+
+// Values are copied bytewise, std::pair is not trivially copyable because of
+// the assignment operator so only the copy constructor and the destructor are checked
+template <typename Value>
+struct is_storable
+    : std::integral_constant
+        <
+            bool,
+            std::is_trivially_copy_constructible<Value>::value
+                && std::is_trivially_destructible<Value>::value
+        >
+{};
+
+struct header
+{
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t dimension;
+    std::uint32_t coordinate_size;
+    std::uint32_t box_size;
+    std::uint32_t value_size;
+    std::uint32_t quantization_bits;
+    std::uint32_t reserved;
+    std::uint64_t values_count;
+    std::uint64_t nodes_count;
+    std::uint64_t leafs_level;
+    std::uint64_t nodes_offset;
+    std::uint64_t boxes_offset;
+    std::uint64_t codes_offset;
+    std::uint64_t values_offset;
+    std::uint64_t size;
+};
+
+struct node
+{
+    std::uint64_t first;
+    std::uint64_t count;
+};
+
+inline std::uint64_t aligned(std::uint64_t offset)
+{
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+// The offset, in the number of coordinates, of the array of coordinates
+// Corner, Dimension of the children [first, first + count) of a node
+template <std::size_t Corner, std::size_t Dimension, std::size_t DimensionCount>
+inline std::size_t coordinates_offset(std::size_t first, std::size_t count)
+{
+    return 2 * DimensionCount * first + (Corner * DimensionCount + Dimension) * count;
+}
+
+inline bool is_valid_quantization(std::uint32_t quantization_bits)
+{
+    return quantization_bits == 0 || quantization_bits == 8 || quantization_bits == 16;
+}
+
+// The quantized coordinates are calculated in floating point
+template <typename T>
+struct quantization_calculation
+{
+    typedef std::conditional_t<std::is_floating_point<T>::value, T, double> type;
+};
+
+// Returns the coordinate represented by the code, lo and hi are the
+// coordinates of the parent. The same function is used to quantize and to
+// decode so the rounding is the same.
+template <typename T>
+inline T dequantize(T lo, T hi, std::uint32_t code, std::uint32_t max_code)
+{
+    typedef typename quantization_calculation<T>::type calc_t;
+    return code == 0 ? lo
+         : code == max_code ? hi
+         : T(calc_t(lo) + (calc_t(hi) - calc_t(lo)) * (calc_t(code) / calc_t(max_code)));
+}
+
+// Returns the greatest code of the coordinate lesser or equal to value
+template <typename T>
+inline std::uint32_t quantize_min(T lo, T hi, T value, std::uint32_t max_code)
+{
+    typedef typename quantization_calculation<T>::type calc_t;
+    if (! (lo < hi))
+    {
+        return 0;
+    }
+    calc_t const r = (calc_t(value) - calc_t(lo)) / (calc_t(hi) - calc_t(lo)) * calc_t(max_code);
+    std::uint32_t code = r <= calc_t(0) ? 0
+                       : r >= calc_t(max_code) ? max_code
+                       : static_cast<std::uint32_t>(r);
+    while (code > 0 && value < dequantize(lo, hi, code, max_code))
+    {
+        --code;
+    }
+    return code;
+}
+
+// Returns the lowest code of the coordinate greater or equal to value
+template <typename T>
+inline std::uint32_t quantize_max(T lo, T hi, T value, std::uint32_t max_code)
+{
+    typedef typename quantization_calculation<T>::type calc_t;
+    if (! (lo < hi))
+    {
+        return max_code;
+    }
+    calc_t const r = (calc_t(value) - calc_t(lo)) / (calc_t(hi) - calc_t(lo)) * calc_t(max_code);
+    std::uint32_t code = r <= calc_t(0) ? 0
+                       : r >= calc_t(max_code) ? max_code
+                       : static_cast<std::uint32_t>(std::ceil(r));
+    while (code < max_code && dequantize(lo, hi, code, max_code) < value)
+    {
+        ++code;
+    }
+    return code;
+}
+
+template <typename Box, typename Value>
+inline void initialize_header(header & h, std::uint64_t nodes_count,
+                              std::uint64_t values_count, std::uint64_t leafs_level,
+                              std::uint32_t quantization_bits)
+{
+    typedef typename geometry::coordinate_type<Box>::type coordinate_t;
+    static const std::uint64_t dimension = geometry::dimension<Box>::value;
+    std::uint64_t const boxes_count = quantization_bits > 0 ? (nodes_count > 0 ? 1 : 0) : nodes_count;
+
+    h.magic = flat::magic;
+    h.version = flat::version;
+    h.dimension = static_cast<std::uint32_t>(geometry::dimension<Box>::value);
+    h.coordinate_size = static_cast<std::uint32_t>(sizeof(coordinate_t));
+    h.box_size = static_cast<std::uint32_t>(sizeof(Box));
+    h.value_size = static_cast<std::uint32_t>(sizeof(Value));
+    h.quantization_bits = quantization_bits;
+    h.reserved = 0;
+    h.values_count = values_count;
+    h.nodes_count = nodes_count;
+    h.leafs_level = leafs_level;
+    h.nodes_offset = aligned(sizeof(header));
+    h.boxes_offset = aligned(h.nodes_offset + nodes_count * sizeof(node));
+    h.codes_offset = aligned(h.boxes_offset + 2 * dimension * boxes_count * sizeof(coordinate_t));
+    h.values_offset = aligned(h.codes_offset + 2 * dimension * nodes_count * quantization_bits / 8);
+    h.size = h.values_offset + values_count * sizeof(Value);
+}
+
+// Checks the header and the buffer, throws std::invalid_argument on failure
+template <typename Box, typename Value>
+inline header const& check_header(void const* data, std::size_t size)
+{
+    if (size < sizeof(header))
+    {
+        throw_invalid_argument("flat rtree: buffer too small");
+    }
+    if (reinterpret_cast<std::uintptr_t>(data) % alignment != 0)
+    {
+        throw_invalid_argument("flat rtree: buffer not aligned");
+    }
+
+    header const& h = *static_cast<header const*>(data);
+    if (h.nodes_count > size / sizeof(node) || h.values_count > size / sizeof(Value))
+    {
+        throw_invalid_argument("flat rtree: corrupted header");
+    }
+
+    if (! is_valid_quantization(h.quantization_bits))
+    {
+        throw_invalid_argument("flat rtree: unsupported quantization of boxes");
+    }
+
+    header expected;
+    initialize_header<Box, Value>(expected, h.nodes_count, h.values_count, h.leafs_level,
+                                  h.quantization_bits);
+
+    if (h.magic != expected.magic)
+    {
+        throw_invalid_argument("flat rtree: invalid magic number or byte order");
+    }
+    if (h.version != expected.version)
+    {
+        throw_invalid_argument("flat rtree: unsupported version");
+    }
+    if (h.dimension != expected.dimension
+        || h.coordinate_size != expected.coordinate_size
+        || h.box_size != expected.box_size
+        || h.value_size != expected.value_size)
+    {
+        throw_invalid_argument("flat rtree: incompatible Box or Value type");
+    }
+    if (h.nodes_offset != expected.nodes_offset
+        || h.boxes_offset != expected.boxes_offset
+        || h.codes_offset != expected.codes_offset
+        || h.values_offset != expected.values_offset
+        || h.size != expected.size
+        || h.size > size
+        || (h.nodes_count == 0) != (h.values_count == 0))
+    {
+        throw_invalid_argument("flat rtree: corrupted header");
+    }
+
+    return h;
+}
+
+// Checks that the nodes are stored level by level, that the children of
+// each internal node follow the children of the previous node of the same
+// level and that the values of each leaf follow the values of the previous
+// leaf. So all ranges are within the buffer and each node is visited once.
+// Throws std::invalid_argument on failure.
+inline void check_nodes(header const& h, void const* data)
+{
+    if (h.nodes_count == 0)
+    {
+        return;
+    }
+
+    node const* nodes = reinterpret_cast<node const*>(
+                            static_cast<const char*>(data) + h.nodes_offset);
+
+    // [first, last) - the nodes of the current level
+    std::uint64_t first = 0;
+    std::uint64_t last = 1;
+    for (std::uint64_t level = 0 ; level < h.leafs_level ; ++level)
+    {
+        std::uint64_t next = last;
+        for (std::uint64_t i = first ; i < last ; ++i)
+        {
+            // Internal nodes are never empty so the levels can't be empty
+            if (nodes[i].first != next
+                || nodes[i].count == 0
+                || nodes[i].count > h.nodes_count - next)
+            {
+                throw_invalid_argument("flat rtree: corrupted nodes");
+            }
+            next += nodes[i].count;
+        }
+        first = last;
+        last = next;
+    }
+
+    if (last != h.nodes_count)
+    {
+        throw_invalid_argument("flat rtree: corrupted nodes");
+    }
+
+    std::uint64_t next = 0;
+    for (std::uint64_t i = first ; i < last ; ++i)
+    {
+        if (nodes[i].first != next
+            || nodes[i].count > h.values_count - next)
+        {
+            throw_invalid_argument("flat rtree: corrupted nodes");
+        }
+        next += nodes[i].count;
+    }
+
+    if (next != h.values_count)
+    {
+        throw_invalid_argument("flat rtree: corrupted nodes");
+    }
+}
+
+// Converts the nodes of the rtree, level by level, into flat arrays
+template <typename MembersHolder>
+class flatten
+    : public MembersHolder::visitor_const
+{
+    typedef typename MembersHolder::value_type value_type;
+    typedef typename MembersHolder::box_type box_type;
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+    typedef typename MembersHolder::node_pointer node_pointer;
+    typedef typename geometry::coordinate_type<box_type>::type coordinate_type;
+
+public:
+    explicit flatten(std::uint32_t quantization_bits = 0)
+        : m_max_code(quantization_bits > 0 ? (std::uint32_t(1) << quantization_bits) - 1 : 0)
+    {}
+
+    inline void operator()(internal_node const& n)
+    {
+        flat::node & current = nodes[m_current];
+        current.first = nodes.size();
+        current.count = rtree::elements(n).size();
+
+        for (auto const& p : rtree::elements(n))
+        {
+            flat::node child = { 0, 0 };
+            nodes.push_back(child);
+            m_queue.push_back(p.second);
+        }
+
+        // the children are appended at the end so their coordinates too
+        if (m_max_code > 0)
+        {
+            append_codes(rtree::elements(n), m_boxes[m_current]);
+        }
+        else
+        {
+            append_coordinates(rtree::elements(n), [](auto const& p) -> box_type const& { return p.first; });
+        }
+    }
+
+    inline void operator()(leaf const& n)
+    {
+        flat::node & current = nodes[m_current];
+        current.first = values.size();
+        current.count = rtree::elements(n).size();
+
+        for (auto const& v : rtree::elements(n))
+        {
+            values.push_back(v);
+        }
+    }
+
+    template <typename Rtree>
+    inline void apply(Rtree const& tree)
+    {
+        if (tree.empty())
+        {
+            return;
+        }
+
+        flat::node root = { 0, 0 };
+        nodes.push_back(root);
+        box_type const bounds = tree.bounds();
+        append_coordinates(std::array<box_type, 1>{{ bounds }}, [](box_type const& b) -> box_type const& { return b; });
+        if (m_max_code > 0)
+        {
+            codes.resize(2 * geometry::dimension<box_type>::value, 0);
+            m_boxes.push_back(bounds);
+        }
+
+        utilities::view<Rtree> rtv(tree);
+        m_current = 0;
+        rtv.apply_visitor(*this);
+
+        for (std::size_t i = 0 ; i < m_queue.size() ; ++i)
+        {
+            m_current = i + 1;
+            rtree::apply_visitor(*this, *m_queue[i]);
+        }
+    }
+
+    std::vector<flat::node> nodes;
+    std::vector<coordinate_type> coordinates;
+    std::vector<std::uint16_t> codes;
+    std::vector<value_type> values;
+
+private:
+    template <typename Elements, typename GetBox>
+    inline void append_coordinates(Elements const& elements, GetBox const& get_box)
+    {
+        static const std::size_t dimension = geometry::dimension<box_type>::value;
+        std::size_t const count = elements.size();
+        std::size_t const first = coordinates.size() / (2 * dimension);
+
+        coordinates.resize(coordinates.size() + 2 * dimension * count);
+
+        geometry::detail::for_each_index<2 * dimension>([&](auto index)
+        {
+            static const std::size_t corner = decltype(index)::value / dimension;
+            static const std::size_t d = decltype(index)::value % dimension;
+            std::size_t const o = coordinates_offset<corner, d, dimension>(first, count);
+            std::size_t i = 0;
+            for (auto const& e : elements)
+            {
+                coordinates[o + i] = geometry::get<corner, d>(get_box(e));
+                ++i;
+            }
+        });
+    }
+
+    // Quantizes the boxes of the children relative to the decoded box of
+    // their parent and stores the decoded boxes of the children, the parent
+    // is passed by value because m_boxes is resized
+    template <typename Elements>
+    inline void append_codes(Elements const& elements, box_type const parent)
+    {
+        static const std::size_t dimension = geometry::dimension<box_type>::value;
+        std::size_t const count = elements.size();
+        std::size_t const first = codes.size() / (2 * dimension);
+
+        codes.resize(codes.size() + 2 * dimension * count);
+        m_boxes.resize(m_boxes.size() + count);
+
+        geometry::detail::for_each_dimension<box_type>([&](auto index)
+        {
+            static const std::size_t d = decltype(index)::value;
+            coordinate_type const lo = geometry::get<min_corner, d>(parent);
+            coordinate_type const hi = geometry::get<max_corner, d>(parent);
+            std::size_t const omin = coordinates_offset<min_corner, d, dimension>(first, count);
+            std::size_t const omax = coordinates_offset<max_corner, d, dimension>(first, count);
+            std::size_t i = 0;
+            for (auto const& e : elements)
+            {
+                std::uint32_t const cmin = quantize_min(lo, hi, geometry::get<min_corner, d>(e.first), m_max_code);
+                std::uint32_t const cmax = quantize_max(lo, hi, geometry::get<max_corner, d>(e.first), m_max_code);
+                codes[omin + i] = static_cast<std::uint16_t>(cmin);
+                codes[omax + i] = static_cast<std::uint16_t>(cmax);
+                geometry::set<min_corner, d>(m_boxes[first + i], dequantize(lo, hi, cmin, m_max_code));
+                geometry::set<max_corner, d>(m_boxes[first + i], dequantize(lo, hi, cmax, m_max_code));
+                ++i;
+            }
+        });
+    }
+
+    std::uint32_t m_max_code;
+    std::size_t m_current;
+    std::vector<node_pointer> m_queue;
+    std::vector<box_type> m_boxes;
+};
+
+inline void write_padding(std::ostream & os, std::uint64_t & offset, std::uint64_t aligned_offset)
+{
+    static const char zeros[alignment] = {};
+    os.write(zeros, static_cast<std::streamsize>(aligned_offset - offset));
+    offset = aligned_offset;
+}
+
+template <typename T>
+inline void write_array(std::ostream & os, std::uint64_t & offset, std::uint64_t aligned_offset,
+                        std::vector<T> const& v)
+{
+    write_padding(os, offset, aligned_offset);
+    if (! v.empty())
+    {
+        os.write(reinterpret_cast<const char*>(v.data()),
+                 static_cast<std::streamsize>(v.size() * sizeof(T)));
+        offset += v.size() * sizeof(T);
+    }
+}
+
+template <typename Rtree>
+inline std::uint64_t write(std::ostream & os, Rtree const& tree, std::uint32_t quantization_bits = 0)
+{
+    typedef typename utilities::view<Rtree>::members_holder members_holder;
+    typedef typename members_holder::value_type value_type;
+    typedef typename members_holder::box_type box_type;
+
+    BOOST_GEOMETRY_STATIC_ASSERT((is_storable<value_type>::value),
+        "Value has to be trivially copy constructible and destructible to be stored in the flat layout.",
+        value_type);
+
+    if (! is_valid_quantization(quantization_bits))
+    {
+        throw_invalid_argument("flat rtree: unsupported quantization of boxes");
+    }
+
+    flatten<members_holder> f(quantization_bits);
+    f.apply(tree);
+
+    utilities::view<Rtree> rtv(tree);
+    header h;
+    std::memset(&h, 0, sizeof(header));
+    initialize_header<box_type, value_type>(h, f.nodes.size(), f.values.size(),
+                                            f.nodes.empty() ? 0 : rtv.depth(),
+                                            quantization_bits);
+
+    std::uint64_t offset = sizeof(header);
+    os.write(reinterpret_cast<const char*>(&h), sizeof(header));
+    write_array(os, offset, h.nodes_offset, f.nodes);
+    write_array(os, offset, h.boxes_offset, f.coordinates);
+    if (quantization_bits == 8)
+    {
+        write_array(os, offset, h.codes_offset, std::vector<std::uint8_t>(f.codes.begin(), f.codes.end()));
+    }
+    else
+    {
+        write_array(os, offset, h.codes_offset, f.codes);
+    }
+    write_array(os, offset, h.values_offset, f.values);
+
+    return h.size;
+}
+
+}}}}}} // namespace boost::geometry::index::detail::rtree::flat
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_LAYOUT_HPP
@@ -0,0 +1,860 @@
+// Boost.Geometry Index
+//
+// R-tree queries of the flat, pointer-free layout
+//
+// Copyright (c) 2026 Boost.Geometry contributors.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_QUERY_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_QUERY_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/util/algorithm.hpp>
+
+#include <boost/geometry/index/detail/distance_predicates.hpp>
+#include <boost/geometry/index/detail/predicates.hpp>
+#include <boost/geometry/index/detail/rtree/flat/layout.hpp>
+#include <boost/geometry/index/detail/rtree/flat/scan.hpp>
+#include <boost/geometry/index/detail/rtree/query_iterators.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/distance_query.hpp>
+#include <boost/geometry/index/detail/translator.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree { namespace flat {
+
+// The data of the flat layout and the objects needed to query it
+template <typename Value, typename Box, typename IndexableGetter, typename Strategy>
+struct members
+{
+    typedef Value value_type;
+    typedef Box box_type;
+    typedef IndexableGetter indexable_getter;
+    typedef Strategy strategy_type;
+    typedef typename index::detail::indexable_type<IndexableGetter>::type indexable_type;
+    typedef std::size_t size_type;
+
+    typedef typename geometry::coordinate_type<Box>::type coordinate_type;
+    static const std::size_t dimension = geometry::dimension<Box>::value;
+
+    members(IndexableGetter const& g, Strategy const& s)
+        : getter(g), strategy(s)
+        , nodes(nullptr), coordinates(nullptr), codes(nullptr), values(nullptr)
+        , nodes_count(0), values_count(0), leafs_level(0), quantization_bits(0)
+    {}
+
+    // Returns the box of the i-th child of the children [first, first + count)
+    // of some node, parent is the box of this node
+    Box box(std::size_t first, std::size_t count, std::size_t i, Box const& parent) const
+    {
+        if (quantization_bits == 8)
+        {
+            return decode_box(static_cast<std::uint8_t const*>(codes), first, count, i, parent);
+        }
+        else if (quantization_bits == 16)
+        {
+            return decode_box(static_cast<std::uint16_t const*>(codes), first, count, i, parent);
+        }
+
+        Box result;
+        geometry::detail::for_each_dimension<Box>([&](auto index)
+        {
+            geometry::set<min_corner, index>(result,
+                coordinates[flat::coordinates_offset<min_corner, index, dimension>(first, count) + i - first]);
+            geometry::set<max_corner, index>(result,
+                coordinates[flat::coordinates_offset<max_corner, index, dimension>(first, count) + i - first]);
+        });
+        return result;
+    }
+
+    // Returns the box of the root, it's never quantized
+    Box root_box() const
+    {
+        Box result;
+        geometry::detail::for_each_dimension<Box>([&](auto index)
+        {
+            geometry::set<min_corner, index>(result, coordinates[index]);
+            geometry::set<max_corner, index>(result, coordinates[dimension + index]);
+        });
+        return result;
+    }
+
+    // Calls f(coordinates, first, count, block) where the boxes of the children
+    // [block, block + block_count) of a node stored at [first, first + count)
+    // are stored as in the layout with not quantized boxes. Quantized boxes
+    // are decoded into a temporary buffer.
+    template <typename Function>
+    void scan_block(std::size_t first, std::size_t count,
+                    std::size_t block, std::size_t block_count,
+                    Box const& parent, Function const& f) const
+    {
+        if (quantization_bits == 0)
+        {
+            f(coordinates, first, count, block);
+            return;
+        }
+
+        coordinate_type buffer[2 * dimension * scan::block_size];
+        if (quantization_bits == 8)
+        {
+            decode_block(static_cast<std::uint8_t const*>(codes), first, count,
+                         block, block_count, parent, buffer);
+        }
+        else
+        {
+            decode_block(static_cast<std::uint16_t const*>(codes), first, count,
+                         block, block_count, parent, buffer);
+        }
+        f(static_cast<coordinate_type const*>(buffer), std::size_t(0), block_count, std::size_t(0));
+    }
+
+    IndexableGetter getter;
+    Strategy strategy;
+
+    flat::node const* nodes;
+    coordinate_type const* coordinates;
+    void const* codes;
+    Value const* values;
+    size_type nodes_count;
+    size_type values_count;
+    size_type leafs_level;
+    std::uint32_t quantization_bits;
+
+private:
+    std::uint32_t max_code() const
+    {
+        return (std::uint32_t(1) << quantization_bits) - 1;
+    }
+
+    template <typename Code>
+    Box decode_box(Code const* c, std::size_t first, std::size_t count, std::size_t i,
+                   Box const& parent) const
+    {
+        std::uint32_t const mc = max_code();
+        Box result;
+        geometry::detail::for_each_dimension<Box>([&](auto index)
+        {
+            coordinate_type const lo = geometry::get<min_corner, index>(parent);
+            coordinate_type const hi = geometry::get<max_corner, index>(parent);
+            geometry::set<min_corner, index>(result, flat::dequantize(lo, hi,
+                c[flat::coordinates_offset<min_corner, index, dimension>(first, count) + i - first], mc));
+            geometry::set<max_corner, index>(result, flat::dequantize(lo, hi,
+                c[flat::coordinates_offset<max_corner, index, dimension>(first, count) + i - first], mc));
+        });
+        return result;
+    }
+
+    template <typename Code>
+    void decode_block(Code const* c, std::size_t first, std::size_t count,
+                      std::size_t block, std::size_t block_count,
+                      Box const& parent, coordinate_type * buffer) const
+    {
+        std::uint32_t const mc = max_code();
+        geometry::detail::for_each_index<2 * dimension>([&](auto index)
+        {
+            static const std::size_t corner = decltype(index)::value / dimension;
+            static const std::size_t d = decltype(index)::value % dimension;
+            coordinate_type const lo = geometry::get<min_corner, d>(parent);
+            coordinate_type const hi = geometry::get<max_corner, d>(parent);
+            Code const* const src = c + block - first
+                                  + flat::coordinates_offset<corner, d, dimension>(first, count);
+            coordinate_type * const dst = buffer
+                                        + flat::coordinates_offset<corner, d, dimension>(0, block_count);
+            for (std::size_t i = 0 ; i < block_count ; ++i)
+            {
+                dst[i] = flat::dequantize(lo, hi, static_cast<std::uint32_t>(src[i]), mc);
+            }
+        });
+    }
+};
+
+template <typename Members, typename Predicates, typename OutIter>
+class spatial_query
+{
+    typedef typename Members::size_type size_type;
+    typedef typename Members::box_type box_type;
+
+    typedef scan::is_supported_spatial
+        <
+            Predicates, typename Members::box_type, typename Members::strategy_type
+        > use_scan;
+
+public:
+    spatial_query(Members const& members, Predicates const& pred, OutIter out_it)
+        : m_members(members), m_pred(pred), m_out_iter(out_it), m_found_count(0)
+    {}
+
+    size_type apply()
+    {
+        namespace id = index::detail;
+
+        if (m_members.nodes_count > 0)
+        {
+            box_type const root_box = m_members.root_box();
+            if (id::predicates_check<id::bounds_tag>(m_pred, 0, root_box, m_members.strategy))
+            {
+                apply(0, m_members.leafs_level, root_box);
+            }
+        }
+
+        return m_found_count;
+    }
+
+private:
+    void apply(std::size_t node_index, size_type reverse_level, box_type const& node_box)
+    {
+        namespace id = index::detail;
+
+        flat::node const& n = m_members.nodes[node_index];
+        std::size_t const first = static_cast<std::size_t>(n.first);
+        std::size_t const last = first + static_cast<std::size_t>(n.count);
+
+        if (reverse_level > 0)
+        {
+            apply_internal(first, last, reverse_level, node_box, use_scan());
+        }
+        else
+        {
+            for (std::size_t i = first ; i < last ; ++i)
+            {
+                auto const& v = m_members.values[i];
+                if (id::predicates_check<id::value_tag>(m_pred, v, m_members.getter(v), m_members.strategy))
+                {
+                    *m_out_iter = v;
+                    ++m_out_iter;
+                    ++m_found_count;
+                }
+            }
+        }
+    }
+
+    void apply_internal(std::size_t first, std::size_t last, size_type reverse_level,
+                        box_type const& node_box, std::false_type /*use_scan*/)
+    {
+        namespace id = index::detail;
+
+        for (std::size_t i = first ; i < last ; ++i)
+        {
+            box_type const box = m_members.box(first, last - first, i, node_box);
+            // if node meets predicates (0 is dummy value)
+            if (id::predicates_check<id::bounds_tag>(m_pred, 0, box, m_members.strategy))
+            {
+                apply(i, reverse_level - 1, box);
+            }
+        }
+    }
+
+    void apply_internal(std::size_t first, std::size_t last, size_type reverse_level,
+                        box_type const& node_box, std::true_type /*use_scan*/)
+    {
+        if (last - first < scan::min_count)
+        {
+            apply_internal(first, last, reverse_level, node_box, std::false_type());
+            return;
+        }
+
+        unsigned char mask[scan::block_size];
+
+        for (std::size_t block = first ; block < last ; block += scan::block_size)
+        {
+            std::size_t const count = (std::min)(last - block, scan::block_size);
+
+            m_members.scan_block(first, last - first, block, count, node_box,
+                [&](auto const* coordinates, std::size_t f, std::size_t c, std::size_t b)
+                {
+                    scan::intersects_mask<Members::dimension>(coordinates, f, c, b, count,
+                                                              m_pred.geometry, mask);
+                });
+
+            for (std::size_t i = 0 ; i < count ; ++i)
+            {
+                if (mask[i])
+                {
+                    apply(block + i, reverse_level - 1,
+                          m_members.box(first, last - first, block + i, node_box));
+                }
+            }
+        }
+    }
+
+    Members const& m_members;
+    Predicates const& m_pred;
+    OutIter m_out_iter;
+    size_type m_found_count;
+};
+
+template <typename Members, typename Predicates>
+struct distance_query_types
+{
+    typedef typename Members::value_type value_type;
+    typedef typename Members::box_type box_type;
+    typedef typename Members::strategy_type strategy_type;
+    typedef typename Members::indexable_type indexable_type;
+    typedef typename Members::size_type size_type;
+
+    typedef index::detail::predicates_element
+        <
+            index::detail::predicates_find_distance<Predicates>::value, Predicates
+        > nearest_predicate_access;
+    typedef typename nearest_predicate_access::type nearest_predicate_type;
+
+    typedef index::detail::calculate_distance<nearest_predicate_type, indexable_type, strategy_type, value_tag> calculate_value_distance;
+    typedef index::detail::calculate_distance<nearest_predicate_type, box_type, strategy_type, bounds_tag> calculate_node_distance;
+    typedef typename calculate_value_distance::result_type value_distance_type;
+    typedef typename calculate_node_distance::result_type node_distance_type;
+
+    struct branch_data
+    {
+        branch_data(node_distance_type d, size_type rl, std::size_t i, box_type const& b)
+            : distance(d), reverse_level(rl), index(i), box(b)
+        {}
+
+        node_distance_type distance;
+        size_type reverse_level;
+        std::size_t index;
+        box_type box;
+    };
+};
+
+template <typename Members, typename Predicates>
+class distance_query
+    : distance_query_types<Members, Predicates>
+{
+    typedef distance_query_types<Members, Predicates> types;
+
+    typedef typename types::value_type value_type;
+    typedef typename types::box_type box_type;
+    typedef typename types::size_type size_type;
+    typedef typename types::nearest_predicate_access nearest_predicate_access;
+    typedef typename types::nearest_predicate_type nearest_predicate_type;
+    typedef typename types::calculate_value_distance calculate_value_distance;
+    typedef typename types::calculate_node_distance calculate_node_distance;
+    typedef typename types::value_distance_type value_distance_type;
+    typedef typename types::node_distance_type node_distance_type;
+    typedef typename types::branch_data branch_data;
+
+    typedef visitors::distance_query_result<value_distance_type, value_type> result_type;
+    typedef visitors::priority_queue<branch_data, visitors::branch_data_comp> branches_type;
+
+    typedef scan::is_supported_distance
+        <
+            Predicates, typename Members::box_type, typename Members::strategy_type
+        > use_scan;
+
+public:
+    distance_query(Members const& members, Predicates const& pred)
+        : m_members(members), m_pred(pred)
+        , m_result((std::min)(members.values_count, max_count()))
+    {}
+
+    template <typename OutIter>
+    size_type apply(OutIter out_it)
+    {
+        namespace id = index::detail;
+
+        if (m_members.nodes_count == 0 || max_count() <= 0)
+        {
+            return 0;
+        }
+
+        std::size_t node_index = 0;
+        size_type reverse_level = m_members.leafs_level;
+        box_type node_box = m_members.root_box();
+
+        for (;;)
+        {
+            flat::node const& n = m_members.nodes[node_index];
+            std::size_t const first = static_cast<std::size_t>(n.first);
+            std::size_t const last = first + static_cast<std::size_t>(n.count);
+
+            if (reverse_level > 0)
+            {
+                apply_internal(first, last, reverse_level, node_box, use_scan());
+            }
+            else
+            {
+                for (std::size_t i = first ; i < last ; ++i)
+                {
+                    auto const& v = m_members.values[i];
+                    value_distance_type value_distance;
+                    if (id::predicates_check<id::value_tag>(m_pred, v, m_members.getter(v), m_members.strategy)
+                        && calculate_value_distance::apply(predicate(), m_members.getter(v), m_members.strategy, value_distance))
+                    {
+                        m_result.store(value_distance, boost::addressof(v));
+                    }
+                }
+            }
+
+            if (m_branches.empty()
+                || m_result.ignore_branch(m_branches.top().distance))
+            {
+                break;
+            }
+
+            node_index = m_branches.top().index;
+            reverse_level = m_branches.top().reverse_level;
+            node_box = m_branches.top().box;
+            m_branches.pop();
+        }
+
+        return m_result.finish(out_it);
+    }
+
+private:
+    void apply_internal(std::size_t first, std::size_t last, size_type reverse_level,
+                        box_type const& node_box, std::false_type /*use_scan*/)
+    {
+        namespace id = index::detail;
+
+        for (std::size_t i = first ; i < last ; ++i)
+        {
+            box_type const box = m_members.box(first, last - first, i, node_box);
+            node_distance_type node_distance;
+            if (id::predicates_check<id::bounds_tag>(m_pred, 0, box, m_members.strategy)
+                && calculate_node_distance::apply(predicate(), box, m_members.strategy, node_distance)
+                && ! m_result.ignore_branch(node_distance))
+            {
+                m_branches.push(branch_data(node_distance, reverse_level - 1, i, box));
+            }
+        }
+    }
+
+    void apply_internal(std::size_t first, std::size_t last, size_type reverse_level,
+                        box_type const& node_box, std::true_type /*use_scan*/)
+    {
+        if (last - first < scan::min_count)
+        {
+            apply_internal(first, last, reverse_level, node_box, std::false_type());
+            return;
+        }
+
+        node_distance_type distances[scan::block_size];
+
+        for (std::size_t block = first ; block < last ; block += scan::block_size)
+        {
+            std::size_t const count = (std::min)(last - block, scan::block_size);
+
+            m_members.scan_block(first, last - first, block, count, node_box,
+                [&](auto const* coordinates, std::size_t f, std::size_t c, std::size_t b)
+                {
+                    scan::comparable_distances<Members::dimension>(coordinates, f, c, b, count,
+                                                                   predicate().point_or_relation,
+                                                                   distances);
+                });
+
+            for (std::size_t i = 0 ; i < count ; ++i)
+            {
+                if (! m_result.ignore_branch(distances[i]))
+                {
+                    m_branches.push(branch_data(distances[i], reverse_level - 1, block + i,
+                                                m_members.box(first, last - first, block + i, node_box)));
+                }
+            }
+        }
+    }
+
+    std::size_t max_count() const
+    {
+        return nearest_predicate_access::get(m_pred).count;
+    }
+
+    nearest_predicate_type const& predicate() const
+    {
+        return nearest_predicate_access::get(m_pred);
+    }
+
+    Members const& m_members;
+    Predicates const& m_pred;
+    result_type m_result;
+    branches_type m_branches;
+};
+
+template <typename Members, typename Predicates>
+class spatial_query_incremental
+{
+    typedef typename Members::value_type value_type;
+    typedef typename Members::box_type box_type;
+    typedef typename Members::size_type size_type;
+
+    struct internal_data
+    {
+        internal_data(std::size_t f, std::size_t l, size_type rl, box_type const& b)
+            : children_first(f), first(f), last(l), reverse_level(rl), box(b)
+        {}
+        std::size_t children_first;
+        std::size_t first;
+        std::size_t last;
+        size_type reverse_level;
+        box_type box;
+    };
+
+public:
+    spatial_query_incremental()
+        : m_members(nullptr), m_current(0), m_last(0), m_in_leaf(false)
+    {}
+
+    spatial_query_incremental(Members const& members, Predicates const& pred)
+        : m_members(boost::addressof(members)), m_pred(pred)
+        , m_current(0), m_last(0), m_in_leaf(false)
+    {
+        namespace id = index::detail;
+
+        if (members.nodes_count > 0)
+        {
+            box_type const root_box = members.root_box();
+            if (id::predicates_check<id::bounds_tag>(m_pred, 0, root_box, members.strategy))
+            {
+                apply(0, members.leafs_level, root_box);
+            }
+        }
+        search_value();
+    }
+
+    value_type const& dereference() const
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(m_in_leaf, "not dereferencable");
+        return m_members->values[m_current];
+    }
+
+    void increment()
+    {
+        ++m_current;
+        search_value();
+    }
+
+    bool is_end() const
+    {
+        return ! m_in_leaf;
+    }
+
+    friend bool operator==(spatial_query_incremental const& l, spatial_query_incremental const& r)
+    {
+        return l.m_in_leaf == r.m_in_leaf && (! l.m_in_leaf || l.m_current == r.m_current);
+    }
+
+private:
+    void apply(std::size_t node_index, size_type reverse_level, box_type const& node_box)
+    {
+        flat::node const& n = m_members->nodes[node_index];
+        std::size_t const first = static_cast<std::size_t>(n.first);
+        std::size_t const last = first + static_cast<std::size_t>(n.count);
+
+        if (reverse_level > 0)
+        {
+            m_internal_stack.push_back(internal_data(first, last, reverse_level - 1, node_box));
+        }
+        else
+        {
+            m_in_leaf = true;
+            m_current = first;
+            m_last = last;
+        }
+    }
+
+    void search_value()
+    {
+        namespace id = index::detail;
+        for (;;)
+        {
+            if (m_in_leaf)
+            {
+                if (m_current < m_last)
+                {
+                    value_type const& v = m_members->values[m_current];
+                    if (id::predicates_check<id::value_tag>(m_pred, v, m_members->getter(v), m_members->strategy))
+                    {
+                        return;
+                    }
+
+                    ++m_current;
+                }
+                else
+                {
+                    m_in_leaf = false;
+                }
+            }
+            else
+            {
+                if (m_internal_stack.empty())
+                {
+                    return;
+                }
+
+                internal_data & current_data = m_internal_stack.back();
+
+                if (current_data.first == current_data.last)
+                {
+                    m_internal_stack.pop_back();
+                    continue;
+                }
+
+                std::size_t const i = current_data.first;
+                ++current_data.first;
+
+                box_type const box
+                    = m_members->box(current_data.children_first,
+                                     current_data.last - current_data.children_first, i,
+                                     current_data.box);
+                if (id::predicates_check<id::bounds_tag>(m_pred, 0, box, m_members->strategy))
+                {
+                    apply(i, current_data.reverse_level, box);
+                }
+            }
+        }
+    }
+
+    Members const* m_members;
+    Predicates m_pred;
+
+    std::vector<internal_data> m_internal_stack;
+    std::size_t m_current;
+    std::size_t m_last;
+    bool m_in_leaf;
+};
+
+template <typename Members, typename Predicates>
+class distance_query_incremental
+    : distance_query_types<Members, Predicates>
+{
+    typedef distance_query_types<Members, Predicates> types;
+
+    typedef typename types::value_type value_type;
+    typedef typename types::box_type box_type;
+    typedef typename types::size_type size_type;
+    typedef typename types::nearest_predicate_access nearest_predicate_access;
+    typedef typename types::nearest_predicate_type nearest_predicate_type;
+    typedef typename types::calculate_value_distance calculate_value_distance;
+    typedef typename types::calculate_node_distance calculate_node_distance;
+    typedef typename types::value_distance_type value_distance_type;
+    typedef typename types::node_distance_type node_distance_type;
+    typedef typename types::branch_data branch_data;
+
+    using neighbor_data = std::pair<value_distance_type, const value_type *>;
+    using neighbors_type = visitors::priority_dequeue<neighbor_data, visitors::pair_first_greater>;
+    using branches_type = visitors::priority_queue<branch_data, visitors::branch_data_comp>;
+
+public:
+    distance_query_incremental()
+        : m_members(nullptr), m_neighbors_count(0), m_neighbor_ptr(nullptr)
+    {}
+
+    distance_query_incremental(Members const& members, Predicates const& pred)
+        : m_members(boost::addressof(members)), m_pred(pred)
+        , m_neighbors_count(0), m_neighbor_ptr(nullptr)
+    {
+        if (members.nodes_count > 0 && 0 < max_count())
+        {
+            apply(0, members.leafs_level, members.root_box());
+            increment();
+        }
+    }
+
+    value_type const& dereference() const
+    {
+        return *m_neighbor_ptr;
+    }
+
+    void increment()
+    {
+        for (;;)
+        {
+            if (m_branches.empty())
+            {
+                if (! m_neighbors.empty())
+                {
+                    m_neighbor_ptr = m_neighbors.top().second;
+                    ++m_neighbors_count;
+                    m_neighbors.pop_top();
+                }
+                else
+                {
+                    m_neighbor_ptr = nullptr;
+                    m_neighbors_count = max_count();
+                }
+
+                return;
+            }
+
+            branch_data const& closest_branch = m_branches.top();
+
+            if (! m_neighbors.empty() && m_neighbors.top().first <= closest_branch.distance)
+            {
+                m_neighbor_ptr = m_neighbors.top().second;
+                ++m_neighbors_count;
+                m_neighbors.pop_top();
+                return;
+            }
+
+            if (ignore_branch_or_value(closest_branch.distance))
+            {
+                m_branches.clear();
+                continue;
+            }
+
+            std::size_t const node_index = closest_branch.index;
+            size_type const reverse_level = closest_branch.reverse_level;
+            box_type const node_box = closest_branch.box;
+            m_branches.pop();
+
+            apply(node_index, reverse_level, node_box);
+        }
+    }
+
+    bool is_end() const
+    {
+        return m_neighbor_ptr == nullptr;
+    }
+
+    friend bool operator==(distance_query_incremental const& l, distance_query_incremental const& r)
+    {
+        return l.m_neighbors_count == r.m_neighbors_count;
+    }
+
+private:
+    void apply(std::size_t node_index, size_type reverse_level, box_type const& node_box)
+    {
+        namespace id = index::detail;
+
+        flat::node const& n = m_members->nodes[node_index];
+        std::size_t const first = static_cast<std::size_t>(n.first);
+        std::size_t const last = first + static_cast<std::size_t>(n.count);
+
+        if (reverse_level > 0)
+        {
+            for (std::size_t i = first ; i < last ; ++i)
+            {
+                box_type const box = m_members->box(first, last - first, i, node_box);
+                node_distance_type node_distance;
+                if (id::predicates_check<id::bounds_tag>(m_pred, 0, box, m_members->strategy)
+                    && calculate_node_distance::apply(predicate(), box, m_members->strategy, node_distance)
+                    && ! ignore_branch_or_value(node_distance))
+                {
+                    m_branches.push(branch_data(node_distance, reverse_level - 1, i, box));
+                }
+            }
+        }
+        else
+        {
+            for (std::size_t i = first ; i < last ; ++i)
+            {
+                value_type const& v = m_members->values[i];
+                value_distance_type value_distance;
+                if (id::predicates_check<id::value_tag>(m_pred, v, m_members->getter(v), m_members->strategy)
+                    && calculate_value_distance::apply(predicate(), m_members->getter(v), m_members->strategy, value_distance)
+                    && ! ignore_branch_or_value(value_distance))
+                {
+                    m_neighbors.push(std::make_pair(value_distance, boost::addressof(v)));
+
+                    if (m_neighbors_count + m_neighbors.size() > max_count())
+                    {
+                        m_neighbors.pop_bottom();
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename Distance>
+    bool ignore_branch_or_value(Distance const& distance)
+    {
+        return m_neighbors_count + m_neighbors.size() == max_count()
+            && (m_neighbors.empty() || m_neighbors.bottom().first <= distance);
+    }
+
+    std::size_t max_count() const
+    {
+        return nearest_predicate_access::get(m_pred).count;
+    }
+
+    nearest_predicate_type const& predicate() const
+    {
+        return nearest_predicate_access::get(m_pred);
+    }
+
+    Members const* m_members;
+    Predicates m_pred;
+
+    branches_type m_branches;
+    neighbors_type m_neighbors;
+    size_type m_neighbors_count;
+    const value_type * m_neighbor_ptr;
+};
+
+// Iterator adaptor of the incremental queries compatible with
+// iterators::end_query_iterator and iterators::query_iterator
+template <typename Impl, typename Value, typename Traits>
+class query_iterator
+{
+public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef Value value_type;
+    typedef typename Traits::const_reference reference;
+    typedef typename Traits::difference_type difference_type;
+    typedef typename Traits::const_pointer pointer;
+
+    query_iterator() = default;
+
+    template <typename Members, typename Predicates>
+    query_iterator(Members const& members, Predicates const& pred)
+        : m_impl(members, pred)
+    {}
+
+    reference operator*() const
+    {
+        return m_impl.dereference();
+    }
+
+    const value_type * operator->() const
+    {
+        return boost::addressof(m_impl.dereference());
+    }
+
+    query_iterator & operator++()
+    {
+        m_impl.increment();
+        return *this;
+    }
+
+    query_iterator operator++(int)
+    {
+        query_iterator temp = *this;
+        this->operator++();
+        return temp;
+    }
+
+    friend bool operator==(query_iterator const& l, query_iterator const& r)
+    {
+        return l.m_impl == r.m_impl;
+    }
+
+    friend bool operator!=(query_iterator const& l, query_iterator const& r)
+    {
+        return !(l.m_impl == r.m_impl);
+    }
+
+    friend bool operator==(query_iterator const& l, iterators::end_query_iterator<Value, Traits> const& /*r*/)
+    {
+        return l.m_impl.is_end();
+    }
+
+    friend bool operator==(iterators::end_query_iterator<Value, Traits> const& /*l*/, query_iterator const& r)
+    {
+        return r.m_impl.is_end();
+    }
+
+private:
+    Impl m_impl;
+};
+
+}}}}}} // namespace boost::geometry::index::detail::rtree::flat
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_QUERY_HPP
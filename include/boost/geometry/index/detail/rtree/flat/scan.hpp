@@ -0,0 +1,183 @@
+// Boost.Geometry Index
+//
+// R-tree flat layout, vectorized scan of the children of nodes
+//
+// Copyright (c) 2026 Boost.Geometry contributors.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_SCAN_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_SCAN_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_system.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/strategies/default_strategy.hpp>
+#include <boost/geometry/strategies/index/cartesian.hpp>
+#include <boost/geometry/util/algorithm.hpp>
+
+#include <boost/geometry/index/detail/predicates.hpp>
+#include <boost/geometry/index/detail/rtree/flat/layout.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree { namespace flat {
+
+namespace scan {
+
+// The number of children checked at once
+static const std::size_t block_size = 32;
+
+// The minimal number of children of a node checked in blocks. The children of
+// smaller nodes are checked one by one, for them the scan wasn't faster.
+static const std::size_t min_count = 9;
+
+// The children are scanned in blocks for cartesian boxes with floating point
+// coordinates and the default or the cartesian strategy. The loops below are
+// written so that they may be vectorized by the compiler.
+template <typename Box, typename Strategy>
+struct is_supported
+    : std::integral_constant
+        <
+            bool,
+            std::is_same<typename cs_tag<Box>::type, cartesian_tag>::value
+         && std::is_floating_point<typename coordinate_type<Box>::type>::value
+         && (dimension<Box>::value == 2 || dimension<Box>::value == 3)
+         && (std::is_same<Strategy, default_strategy>::value
+          || std::is_same<Strategy, strategies::index::cartesian<> >::value)
+        >
+{};
+
+template <typename Geometry, typename Box, typename Tag = typename tag<Geometry>::type>
+struct is_supported_geometry
+    : std::false_type
+{};
+
+template <typename Point, typename Box>
+struct is_supported_geometry<Point, Box, point_tag>
+    : std::integral_constant
+        <
+            bool,
+            std::is_same<typename cs_tag<Point>::type, cartesian_tag>::value
+         && dimension<Point>::value == dimension<Box>::value
+        >
+{};
+
+template <typename QueryBox, typename Box>
+struct is_supported_geometry<QueryBox, Box, box_tag>
+    : is_supported_geometry<typename point_type<QueryBox>::type, Box, point_tag>
+{};
+
+// Predicates which may be checked with intersects_mask()
+template <typename Predicates, typename Box, typename Strategy>
+struct is_supported_spatial
+    : std::false_type
+{};
+
+template <typename Geometry, typename Box, typename Strategy>
+struct is_supported_spatial
+    <
+        predicates::spatial_predicate<Geometry, predicates::intersects_tag, false>,
+        Box, Strategy
+    >
+    : std::integral_constant
+        <
+            bool,
+            is_supported<Box, Strategy>::value
+         && std::is_same<typename tag<Geometry>::type, box_tag>::value
+         && is_supported_geometry<Geometry, Box>::value
+        >
+{};
+
+// Predicates which may be checked with comparable_distances()
+template <typename Predicates, typename Box, typename Strategy>
+struct is_supported_distance
+    : std::false_type
+{};
+
+template <typename Point, typename Box, typename Strategy>
+struct is_supported_distance<predicates::nearest<Point>, Box, Strategy>
+    : std::integral_constant
+        <
+            bool,
+            is_supported<Box, Strategy>::value
+         && std::is_same<typename tag<Point>::type, point_tag>::value
+         && is_supported_geometry<Point, Box>::value
+        >
+{};
+
+// Sets mask[i] to 1 if the box of the (block + i)-th node intersects the box
+// and to 0 otherwise. The nodes are children of a node stored at
+// [first, first + count). The comparisons are the same as in cartesian
+// disjoint(box, box) so the results are the same.
+template <std::size_t Dimension, typename T, typename QueryBox>
+inline void intersects_mask(T const* coordinates, std::size_t first, std::size_t count,
+                            std::size_t block, std::size_t block_count,
+                            QueryBox const& box, unsigned char * mask)
+{
+    for (std::size_t i = 0 ; i < block_count ; ++i)
+    {
+        mask[i] = 1;
+    }
+
+    geometry::detail::for_each_index<Dimension>([&](auto index)
+    {
+        auto const lo = geometry::get<min_corner, index>(box);
+        auto const hi = geometry::get<max_corner, index>(box);
+        T const* const mn = coordinates + block - first
+                          + coordinates_offset<min_corner, index, Dimension>(first, count);
+        T const* const mx = coordinates + block - first
+                          + coordinates_offset<max_corner, index, Dimension>(first, count);
+        for (std::size_t i = 0 ; i < block_count ; ++i)
+        {
+            mask[i] &= static_cast<unsigned char>(! (mx[i] < lo) & ! (mn[i] > hi));
+        }
+    });
+}
+
+// Calculates the comparable distances between the point and the boxes of the
+// [block, block + block_count) nodes, children of a node stored at
+// [first, first + count). The operations are performed in the same order as
+// in cartesian comparable::pythagoras_point_box so the results are the same.
+template <std::size_t Dimension, typename T, typename Point, typename Result>
+inline void comparable_distances(T const* coordinates, std::size_t first, std::size_t count,
+                                 std::size_t block, std::size_t block_count,
+                                 Point const& point, Result * result)
+{
+    for (std::size_t i = 0 ; i < block_count ; ++i)
+    {
+        result[i] = 0;
+    }
+
+    geometry::detail::for_each_index<Dimension>([&](auto index)
+    {
+        static const std::size_t d = Dimension - 1 - decltype(index)::value;
+        Result const p = Result(geometry::get<d>(point));
+        T const* const mn = coordinates + block - first
+                          + coordinates_offset<min_corner, d, Dimension>(first, count);
+        T const* const mx = coordinates + block - first
+                          + coordinates_offset<max_corner, d, Dimension>(first, count);
+        for (std::size_t i = 0 ; i < block_count ; ++i)
+        {
+            Result const lo = Result(mn[i]);
+            Result const hi = Result(mx[i]);
+            Result const d1 = p < lo ? lo - p : Result(0);
+            Result const d2 = p > hi ? p - hi : Result(0);
+            result[i] += d1 * d1;
+            result[i] += d2 * d2;
+        }
+    });
+}
+
+} // namespace scan
+
+}}}}}} // namespace boost::geometry::index::detail::rtree::flat
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_FLAT_SCAN_HPP
@@ -0,0 +1,315 @@
+// Boost.Geometry Index
+//
+// R-tree spatial join
+//
+// Copyright (c) 2026 Boost.Geometry contributors.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_JOIN_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_JOIN_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/algorithms/detail/distance/interface.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/util/parallel.hpp>
+
+#include <boost/geometry/index/detail/predicates.hpp>
+#include <boost/geometry/index/detail/rtree/node/node_elements.hpp>
+#include <boost/geometry/index/parameters.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree {
+
+namespace join {
+
+// Checks the Indexables or the boxes of nodes of both rtrees
+template <typename Predicate>
+struct predicate_check
+{
+    BOOST_GEOMETRY_STATIC_ASSERT_FALSE(
+        "Not implemented for this Predicate.",
+        Predicate);
+};
+
+template <>
+struct predicate_check<predicates::join_intersects>
+{
+    template <typename G1, typename G2, typename Strategy>
+    static inline bool apply(predicates::join_intersects const&,
+                             G1 const& g1, G2 const& g2, Strategy const& s)
+    {
+        return spatial_predicate_call<predicates::intersects_tag>::apply(g1, g2, s);
+    }
+};
+
+template <typename T>
+struct predicate_check<predicates::join_within_distance<T> >
+{
+    template <typename G1, typename G2, typename Strategy>
+    static inline bool apply(predicates::join_within_distance<T> const& p,
+                             G1 const& g1, G2 const& g2, Strategy const& s)
+    {
+        return geometry::distance(g1, g2, s) <= p.distance;
+    }
+};
+
+// Traverses both rtrees at once. Only the pairs of nodes which boxes meet
+// the predicate are visited. If the trees have different heights the deeper
+// one is traversed alone until the levels are the same.
+template <typename MembersHolder1, typename MembersHolder2, typename Predicate>
+class join_traversal
+{
+    typedef typename MembersHolder1::translator_type translator1_type;
+    typedef typename MembersHolder2::translator_type translator2_type;
+    typedef typename MembersHolder1::box_type box1_type;
+    typedef typename MembersHolder2::box_type box2_type;
+
+    typedef typename MembersHolder1::internal_node internal_node1;
+    typedef typename MembersHolder1::leaf leaf1;
+    typedef typename MembersHolder2::internal_node internal_node2;
+    typedef typename MembersHolder2::leaf leaf2;
+
+    typedef typename MembersHolder1::allocators_type::node_pointer node_pointer1;
+    typedef typename MembersHolder2::allocators_type::node_pointer node_pointer2;
+
+    typedef typename index::detail::strategy_type
+        <
+            typename MembersHolder1::parameters_type
+        >::type strategy_type;
+
+    typedef predicate_check<Predicate> check;
+
+public:
+    typedef typename MembersHolder1::value_type value1_type;
+    typedef typename MembersHolder2::value_type value2_type;
+
+    // A pair of nodes visited by the traversal
+    struct node_pair
+    {
+        box1_type const* box1;
+        node_pointer1 node1;
+        std::size_t level1;
+        box2_type const* box2;
+        node_pointer2 node2;
+        std::size_t level2;
+    };
+
+    join_traversal(MembersHolder1 const& members1, MembersHolder2 const& members2,
+                   Predicate const& predicate)
+        : m_tr1(members1.translator())
+        , m_tr2(members2.translator())
+        , m_strategy(index::detail::get_strategy(members1.parameters()))
+        , m_pred(predicate)
+    {}
+
+    // Calls f(pair) for the pairs of children of the nodes in the order
+    // in which they are visited by apply()
+    template <typename Function>
+    void for_each_child_pair(node_pair const& p, Function && f) const
+    {
+        if (p.level1 > p.level2)
+        {
+            for (auto const& e1 : rtree::elements(rtree::get<internal_node1>(*p.node1)))
+            {
+                if (check::apply(m_pred, e1.first, *p.box2, m_strategy))
+                {
+                    f(node_pair{&e1.first, e1.second, p.level1 - 1,
+                                p.box2, p.node2, p.level2});
+                }
+            }
+        }
+        else if (p.level1 < p.level2)
+        {
+            for (auto const& e2 : rtree::elements(rtree::get<internal_node2>(*p.node2)))
+            {
+                if (check::apply(m_pred, *p.box1, e2.first, m_strategy))
+                {
+                    f(node_pair{p.box1, p.node1, p.level1,
+                                &e2.first, e2.second, p.level2 - 1});
+                }
+            }
+        }
+        else
+        {
+            auto const& elements2 = rtree::elements(rtree::get<internal_node2>(*p.node2));
+            for (auto const& e1 : rtree::elements(rtree::get<internal_node1>(*p.node1)))
+            {
+                if (! check::apply(m_pred, e1.first, *p.box2, m_strategy))
+                {
+                    continue;
+                }
+                for (auto const& e2 : elements2)
+                {
+                    if (check::apply(m_pred, e1.first, e2.first, m_strategy))
+                    {
+                        f(node_pair{&e1.first, e1.second, p.level1 - 1,
+                                    &e2.first, e2.second, p.level2 - 1});
+                    }
+                }
+            }
+        }
+    }
+
+    // Calls f(value1, value2) for all pairs of values meeting the predicate
+    // stored in the nodes and their children
+    template <typename Function>
+    void apply(node_pair const& p, Function & f) const
+    {
+        std::vector<value2_type const*> values2;
+        apply(p, f, values2);
+    }
+
+private:
+    template <typename Function>
+    void apply(node_pair const& p, Function & f,
+               std::vector<value2_type const*> & values2) const
+    {
+        if (p.level1 == 0 && p.level2 == 0)
+        {
+            // only the values of the second node meeting the predicate with
+            // the box of the first node are checked for each value
+            values2.clear();
+            for (auto const& v2 : rtree::elements(rtree::get<leaf2>(*p.node2)))
+            {
+                if (check::apply(m_pred, *p.box1, m_tr2(v2), m_strategy))
+                {
+                    values2.push_back(&v2);
+                }
+            }
+
+            if (values2.empty())
+            {
+                return;
+            }
+
+            for (auto const& v1 : rtree::elements(rtree::get<leaf1>(*p.node1)))
+            {
+                auto const& indexable1 = m_tr1(v1);
+                if (! check::apply(m_pred, indexable1, *p.box2, m_strategy))
+                {
+                    continue;
+                }
+                for (value2_type const* v2 : values2)
+                {
+                    if (check::apply(m_pred, indexable1, m_tr2(*v2), m_strategy))
+                    {
+                        f(v1, *v2);
+                    }
+                }
+            }
+        }
+        else
+        {
+            for_each_child_pair(p, [&](node_pair const& child)
+            {
+                apply(child, f, values2);
+            });
+        }
+    }
+
+    translator1_type const& m_tr1;
+    translator2_type const& m_tr2;
+    strategy_type m_strategy;
+    Predicate const& m_pred;
+};
+
+template <typename MembersHolder1, typename MembersHolder2, typename Predicate, typename OutIter>
+inline typename MembersHolder1::size_type
+apply(MembersHolder1 const& members1, typename MembersHolder1::box_type const& bounds1,
+      MembersHolder2 const& members2, typename MembersHolder2::box_type const& bounds2,
+      Predicate const& predicate, OutIter out_it, std::size_t threads)
+{
+    typedef join_traversal<MembersHolder1, MembersHolder2, Predicate> traversal_type;
+    typedef typename traversal_type::node_pair node_pair;
+    typedef typename traversal_type::value1_type value1_type;
+    typedef typename traversal_type::value2_type value2_type;
+    typedef typename MembersHolder1::size_type size_type;
+
+    traversal_type const traversal(members1, members2, predicate);
+
+    node_pair const root{&bounds1, members1.root, members1.leafs_level,
+                         &bounds2, members2.root, members2.leafs_level};
+
+    if (! predicate_check<Predicate>::apply(predicate, bounds1, bounds2,
+                                            index::detail::get_strategy(members1.parameters())))
+    {
+        return 0;
+    }
+
+    if (threads <= 1)
+    {
+        size_type found = 0;
+        auto output = [&](value1_type const& v1, value2_type const& v2)
+        {
+            *out_it = std::make_pair(v1, v2);
+            ++out_it;
+            ++found;
+        };
+        traversal.apply(root, output);
+        return found;
+    }
+
+    // Split the traversal into the pairs of nodes visited at the top levels,
+    // more of them than threads to balance the load. The pairs are kept in
+    // the order of the traversal so the results are the same as the results
+    // of the sequential traversal.
+    std::vector<node_pair> pairs(1, root);
+    std::vector<node_pair> next;
+    while (pairs.size() < threads * 8)
+    {
+        next.clear();
+        bool leafs = false;
+        for (node_pair const& p : pairs)
+        {
+            if (p.level1 == 0 && p.level2 == 0)
+            {
+                leafs = true;
+                break;
+            }
+            traversal.for_each_child_pair(p, [&](node_pair const& child)
+            {
+                next.push_back(child);
+            });
+        }
+        if (leafs || next.empty())
+        {
+            break;
+        }
+        pairs.swap(next);
+    }
+
+    std::vector<std::vector<std::pair<value1_type const*, value2_type const*> > >
+        results(pairs.size());
+
+    geometry::detail::parallel::for_each_index(pairs.size(), threads, [&](std::size_t i)
+    {
+        auto output = [&](value1_type const& v1, value2_type const& v2)
+        {
+            results[i].push_back(std::make_pair(&v1, &v2));
+        };
+        traversal.apply(pairs[i], output);
+    });
+
+    size_type found = 0;
+    for (auto const& result : results)
+    {
+        for (auto const& p : result)
+        {
+            *out_it = std::make_pair(*p.first, *p.second);
+            ++out_it;
+            ++found;
+        }
+    }
+    return found;
+}
+
+} // namespace join
+
+}}}}} // namespace boost::geometry::index::detail::rtree
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_JOIN_HPP
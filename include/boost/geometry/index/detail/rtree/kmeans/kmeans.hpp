@@ -15,6 +15,6 @@
 #ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_KMEANS_KMEANS_HPP
 #define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_KMEANS_KMEANS_HPP
 
-#include <boost/geometry/index/detail/rtree/kmeans/split.hpp>
+#include <boost/geometry/index/detail/rtree/kmeans/redistribute_elements.hpp>
 
 #endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_KMEANS_KMEANS_HPP
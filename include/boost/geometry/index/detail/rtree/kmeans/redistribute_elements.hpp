@@ -0,0 +1,354 @@
+// Boost.Geometry Index
+//
+// R-tree kmeans split algorithm implementation
+//
+// Copyright (c) 2026 Boost.Geometry contributors.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_KMEANS_REDISTRIBUTE_ELEMENTS_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_KMEANS_REDISTRIBUTE_ELEMENTS_HPP
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include <boost/geometry/util/algorithm.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
+#include <boost/geometry/index/detail/algorithms/content.hpp>
+#include <boost/geometry/index/detail/algorithms/intersection_content.hpp>
+
+#include <boost/geometry/index/detail/rtree/node/node.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/insert.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/is_leaf.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree {
+
+namespace kmeans {
+
+// The maximum number of iterations of the Lloyd's algorithm. The elements of
+// a node are usually divided after a few of them.
+static const std::size_t max_iterations = 8;
+
+template <typename Box>
+struct center_type
+{
+    typedef typename select_most_precise
+        <
+            typename coordinate_type<Box>::type, double
+        >::type calculation_type;
+
+    typedef std::array<calculation_type, dimension<Box>::value> type;
+};
+
+template <typename Center>
+inline typename Center::value_type squared_distance(Center const& c1, Center const& c2)
+{
+    typename Center::value_type result = 0;
+    for (std::size_t d = 0 ; d < c1.size() ; ++d)
+    {
+        typename Center::value_type const diff = c1[d] - c2[d];
+        result += diff * diff;
+    }
+    return result;
+}
+
+// Calculates the centers of the bounding boxes of the elements
+template <typename Box, typename Elements, typename Translator, typename Strategy>
+inline void centers(Elements const& elements, Translator const& tr, Strategy const& strategy,
+                    std::vector<typename center_type<Box>::type> & result)
+{
+    typedef typename center_type<Box>::calculation_type calc_t;
+
+    result.resize(elements.size());
+    for (std::size_t i = 0 ; i < elements.size() ; ++i)
+    {
+        Box box;
+        index::detail::bounds(rtree::element_indexable(elements[i], tr), box, strategy);
+        geometry::detail::for_each_dimension<Box>([&](auto index)
+        {
+            result[i][index] = (calc_t(geometry::get<min_corner, index>(box))
+                              + calc_t(geometry::get<max_corner, index>(box))) / 2;
+        });
+    }
+}
+
+// Picks the center farthest from the mean and then the center farthest from it
+template <typename Center>
+inline void pick_seeds(std::vector<Center> const& centers,
+                       std::size_t & seed1,
+                       std::size_t & seed2)
+{
+    std::size_t const count = centers.size();
+
+    Center mean;
+    mean.fill(0);
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        for (std::size_t d = 0 ; d < mean.size() ; ++d)
+        {
+            mean[d] += centers[i][d];
+        }
+    }
+    for (std::size_t d = 0 ; d < mean.size() ; ++d)
+    {
+        mean[d] /= typename Center::value_type(count);
+    }
+
+    seed1 = 0;
+    typename Center::value_type greatest_distance = 0;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        typename Center::value_type const dist = kmeans::squared_distance(centers[i], mean);
+        if (greatest_distance < dist)
+        {
+            greatest_distance = dist;
+            seed1 = i;
+        }
+    }
+
+    // if all of the centers are equal the second seed is any other element
+    seed2 = seed1 == 0 ? 1 : 0;
+    greatest_distance = 0;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        typename Center::value_type const dist = kmeans::squared_distance(centers[i], centers[seed1]);
+        if (greatest_distance < dist)
+        {
+            greatest_distance = dist;
+            seed2 = i;
+        }
+    }
+}
+
+// Divides the elements into two clusters with the 2-means algorithm. The
+// elements are ordered by the difference of distances to the means of the
+// clusters and the first group1_count of them form the first cluster, so the
+// number of elements in both clusters is kept between min and count - min.
+template <typename Center>
+inline void divide(std::vector<Center> const& centers,
+                   std::size_t min_elements,
+                   std::vector<std::size_t> & order,
+                   std::size_t & group1_count)
+{
+    typedef typename Center::value_type calc_t;
+
+    std::size_t const count = centers.size();
+
+    std::size_t seed1 = 0;
+    std::size_t seed2 = 0;
+    kmeans::pick_seeds(centers, seed1, seed2);
+    Center mean1 = centers[seed1];
+    Center mean2 = centers[seed2];
+
+    std::vector<calc_t> diffs(count);
+    std::vector<bool> previous;
+    order.resize(count);
+    group1_count = 0;
+
+    for (std::size_t iteration = 0 ; iteration < max_iterations ; ++iteration)
+    {
+        for (std::size_t i = 0 ; i < count ; ++i)
+        {
+            diffs[i] = kmeans::squared_distance(centers[i], mean1)
+                     - kmeans::squared_distance(centers[i], mean2);
+            order[i] = i;
+        }
+
+        std::sort(order.begin(), order.end(), [&](std::size_t i1, std::size_t i2)
+        {
+            return diffs[i1] < diffs[i2] || (diffs[i1] == diffs[i2] && i1 < i2);
+        });
+
+        std::size_t nearer1 = 0;
+        while (nearer1 < count && diffs[order[nearer1]] <= 0)
+        {
+            ++nearer1;
+        }
+        group1_count = (std::max)(min_elements, (std::min)(nearer1, count - min_elements));
+
+        std::vector<bool> in_group1(count, false);
+        for (std::size_t i = 0 ; i < group1_count ; ++i)
+        {
+            in_group1[order[i]] = true;
+        }
+        if (in_group1 == previous)
+        {
+            break;
+        }
+        previous.swap(in_group1);
+
+        mean1.fill(0);
+        mean2.fill(0);
+        for (std::size_t i = 0 ; i < count ; ++i)
+        {
+            Center & mean = i < group1_count ? mean1 : mean2;
+            for (std::size_t d = 0 ; d < mean.size() ; ++d)
+            {
+                mean[d] += centers[order[i]][d];
+            }
+        }
+        for (std::size_t d = 0 ; d < mean1.size() ; ++d)
+        {
+            mean1[d] /= calc_t(group1_count);
+            mean2[d] /= calc_t(count - group1_count);
+        }
+    }
+}
+
+} // namespace kmeans
+
+template <typename MembersHolder>
+struct redistribute_elements<MembersHolder, kmeans_tag>
+{
+    typedef typename MembersHolder::box_type box_type;
+    typedef typename MembersHolder::parameters_type parameters_type;
+    typedef typename MembersHolder::translator_type translator_type;
+    typedef typename MembersHolder::allocators_type allocators_type;
+
+    typedef typename MembersHolder::node node;
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    template <typename Node>
+    static inline void apply(Node & n,
+                             Node & second_node,
+                             box_type & box1,
+                             box_type & box2,
+                             parameters_type const& parameters,
+                             translator_type const& translator,
+                             allocators_type & allocators)
+    {
+        typedef typename rtree::elements_type<Node>::type elements_type;
+        typedef typename elements_type::value_type element_type;
+
+        typename index::detail::strategy_type<parameters_type>::type const&
+            strategy = index::detail::get_strategy(parameters);
+
+        elements_type & elements1 = rtree::elements(n);
+        elements_type & elements2 = rtree::elements(second_node);
+        const size_t elements1_count = parameters.get_max_elements() + 1;
+
+        BOOST_GEOMETRY_INDEX_ASSERT(elements1.size() == elements1_count, "unexpected number of elements");
+
+        // copy original elements - use in-memory storage (std::allocator)
+        typedef typename rtree::container_from_elements_type<elements_type, element_type>::type
+            container_type;
+        container_type elements_copy(elements1.begin(), elements1.end());                                   // MAY THROW, STRONG (alloc, copy)
+
+        // divide the elements into two clusters
+        std::vector<typename kmeans::center_type<box_type>::type> centers;
+        kmeans::centers<box_type>(elements_copy, translator, strategy, centers);                            // MAY THROW, STRONG (alloc)
+        std::vector<std::size_t> order;
+        std::size_t group1_count = 0;
+        kmeans::divide(centers, parameters.get_min_elements(), order, group1_count);                       // MAY THROW, STRONG (alloc)
+        choose_group1_count(elements_copy, order, parameters.get_min_elements(),
+                            translator, strategy, group1_count);                                            // MAY THROW, STRONG (alloc)
+
+        // prepare nodes' elements containers
+        elements1.clear();
+        BOOST_GEOMETRY_INDEX_ASSERT(elements2.empty(), "unexpected container state");
+
+        BOOST_TRY
+        {
+            for ( size_t i = 0 ; i < elements1_count ; ++i )
+            {
+                element_type const& elem = elements_copy[order[i]];
+                if ( i < group1_count )
+                {
+                    elements1.push_back(elem);                                                              // MAY THROW, STRONG (copy)
+                }
+                else
+                {
+                    elements2.push_back(elem);                                                              // MAY THROW, STRONG (alloc, copy)
+                }
+            }
+
+            // calculate boxes
+            box1 = rtree::elements_box<box_type>(elements1.begin(), elements1.end(), translator, strategy);
+            box2 = rtree::elements_box<box_type>(elements2.begin(), elements2.end(), translator, strategy);
+        }
+        BOOST_CATCH(...)
+        {
+            elements1.clear();
+            elements2.clear();
+
+            rtree::destroy_elements<MembersHolder>::apply(elements_copy, allocators);
+            //elements_copy.clear();
+
+            BOOST_RETHROW                                                                                     // RETHROW, BASIC
+        }
+        BOOST_CATCH_END
+    }
+
+private:
+    // The clusters found by the k-means algorithm are divided where the
+    // elements are equally distant from both means. Since the extents of the
+    // elements are not taken into account the division is moved along the
+    // order of elements to the place where the boxes of the groups overlap
+    // the least and then have the smallest content.
+    template <typename Elements, typename Strategy>
+    static inline void choose_group1_count(Elements const& elements,
+                                           std::vector<std::size_t> const& order,
+                                           std::size_t min_elements,
+                                           translator_type const& translator,
+                                           Strategy const& strategy,
+                                           std::size_t & group1_count)
+    {
+        typedef typename index::detail::default_content_result<box_type>::type content_type;
+
+        std::size_t const count = order.size();
+
+        // boxes of the elements [0, i] and [i, count) in the order
+        std::vector<box_type> prefix(count), suffix(count);
+        index::detail::bounds(rtree::element_indexable(elements[order[0]], translator), prefix[0], strategy);
+        for (std::size_t i = 1 ; i < count ; ++i)
+        {
+            prefix[i] = prefix[i - 1];
+            index::detail::expand(prefix[i], rtree::element_indexable(elements[order[i]], translator), strategy);
+        }
+        index::detail::bounds(rtree::element_indexable(elements[order[count - 1]], translator), suffix[count - 1], strategy);
+        for (std::size_t i = count - 1 ; i > 0 ; --i)
+        {
+            suffix[i - 1] = suffix[i];
+            index::detail::expand(suffix[i - 1], rtree::element_indexable(elements[order[i - 1]], translator), strategy);
+        }
+
+        std::size_t const kmeans_count = group1_count;
+        content_type smallest_overlap = 0;
+        content_type smallest_content = 0;
+        std::size_t smallest_distance = 0;
+        bool found = false;
+        for (std::size_t k = min_elements ; k + min_elements <= count ; ++k)
+        {
+            content_type const overlap = index::detail::intersection_content(prefix[k - 1], suffix[k], strategy);
+            content_type const content = index::detail::content(prefix[k - 1])
+                                       + index::detail::content(suffix[k]);
+            std::size_t const distance = k < kmeans_count ? kmeans_count - k : k - kmeans_count;
+            if ( ! found
+              || overlap < smallest_overlap
+              || ( overlap == smallest_overlap
+                && ( content < smallest_content
+                  || ( content == smallest_content && distance < smallest_distance ) ) ) )
+            {
+                found = true;
+                smallest_overlap = overlap;
+                smallest_content = content;
+                smallest_distance = distance;
+                group1_count = k;
+            }
+        }
+    }
+};
+
+}} // namespace detail::rtree
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_KMEANS_REDISTRIBUTE_ELEMENTS_HPP
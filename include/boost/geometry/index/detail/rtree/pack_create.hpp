@@ -16,9 +16,15 @@
 #ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PACK_CREATE_HPP
 #define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PACK_CREATE_HPP
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
 #include <boost/core/ignore_unused.hpp>
 
 #include <boost/geometry/algorithms/detail/expand_by_epsilon.hpp>
+#include <boost/geometry/algorithms/detail/hilbert_index.hpp>
 #include <boost/geometry/algorithms/expand.hpp>
 
 #include <boost/geometry/index/detail/algorithms/content.hpp>
@@ -28,6 +34,8 @@
 #include <boost/geometry/index/detail/rtree/node/subtree_destroyer.hpp>
 #include <boost/geometry/index/parameters.hpp>
 
+#include <boost/geometry/util/parallel.hpp>
+
 namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree {
 
 namespace pack_utils {
@@ -107,6 +115,49 @@ struct nth_element_and_half_boxes<Dimension, Dimension>
     static inline void apply(EIt , EIt , EIt , Box const& , Box & , Box & , std::size_t ) {}
 };
 
+template <std::size_t I, std::size_t Dimension>
+struct sort_by_dimension
+{
+    template <typename EIt>
+    static inline void apply(EIt first, EIt last, std::size_t dim_index)
+    {
+        if (I == dim_index)
+        {
+            std::sort(first, last, point_entries_comparer<I>());
+        }
+        else
+        {
+            sort_by_dimension<I + 1, Dimension>::apply(first, last, dim_index);
+        }
+    }
+};
+
+template <std::size_t Dimension>
+struct sort_by_dimension<Dimension, Dimension>
+{
+    template <typename EIt>
+    static inline void apply(EIt , EIt , std::size_t ) {}
+};
+
+// Returns the smallest number of slabs s such that s^dimensions >= count
+inline std::size_t str_slabs_count(std::size_t count, std::size_t dimensions)
+{
+    std::size_t s = 1;
+    for (;;)
+    {
+        std::size_t p = 1;
+        for (std::size_t i = 0 ; i < dimensions && p < count ; ++i)
+        {
+            p *= s;
+        }
+        if (count <= p)
+        {
+            return s;
+        }
+        ++s;
+    }
+}
+
 } // namespace pack_utils
 
 // STR leafs number are calculated as rcount/max
@@ -135,6 +186,16 @@ struct nth_element_and_half_boxes<Dimension, Dimension>
 // L1          125               52
 // L2  25  25  25  25  25   25  17    10
 // L3  5x5 5x5 5x5 5x5 5x5  5x5 3x5+2 2x5
+//
+// The above is packing_default. The other algorithms use the same division
+// into packets, so the same number of elements in nodes, but a different
+// order of elements:
+// packing_str     - before the packets of an internal node are created its
+//                   elements are sorted by the first coordinate and divided
+//                   into slabs of whole packets, each slab is sorted by the
+//                   next coordinate and so on (Sort-Tile-Recursive)
+// packing_hilbert - all elements are sorted once by the Hilbert index of
+//                   their centroids and then divided into packets in order
 
 template <typename MembersHolder>
 class pack
@@ -188,6 +249,20 @@ public:
                        translator_type const& translator,
                        allocators_type & allocators,
                        TmpAlloc const& temp_allocator)
+    {
+        return apply(first, last, values_count, leafs_level, parameters, translator,
+                     allocators, temp_allocator, packing_parameters());
+    }
+
+    template <typename InIt, typename TmpAlloc> inline static
+    node_pointer apply(InIt first, InIt last,
+                       size_type & values_count,
+                       size_type & leafs_level,
+                       parameters_type const& parameters,
+                       translator_type const& translator,
+                       allocators_type & allocators,
+                       TmpAlloc const& temp_allocator,
+                       packing_parameters const& packing)
     {
         typedef typename std::iterator_traits<InIt>::difference_type diff_type;
             
@@ -229,13 +304,52 @@ public:
         }
 
         subtree_elements_counts subtree_counts = calculate_subtree_elements_counts(values_count, parameters, leafs_level);
+        std::size_t threads = geometry::detail::parallel::threads_count(packing.get_threads());
+        packing_algorithm const algorithm = packing.get_algorithm();
+
+        if ( algorithm == packing_hilbert )
+        {
+            hilbert_sort(entries, hint_box.get(), temp_allocator, threads);
+        }
+
         internal_element el = per_level(entries.begin(), entries.end(), hint_box.get(), values_count, subtree_counts,
-                                        parameters, translator, allocators);
+                                        parameters, translator, allocators, threads, algorithm);
 
         return el.second;
     }
 
 private:
+    // Sorts the entries by the Hilbert index of their points. The indexes of
+    // entries are compared if the Hilbert indexes are equal so the order is
+    // the same regardless of the number of threads.
+    template <typename Entries, typename TmpAlloc> inline static
+    void hilbert_sort(Entries & entries, box_type const& hint_box,
+                      TmpAlloc const& temp_allocator, std::size_t threads)
+    {
+        typedef std::pair<std::uint64_t, std::size_t> key_type;
+        typedef typename boost::container::allocator_traits<TmpAlloc>::
+            template rebind_alloc<key_type> temp_key_allocator_type;
+
+        temp_key_allocator_type temp_key_allocator(temp_allocator);
+        boost::container::vector<key_type, temp_key_allocator_type> keys(temp_key_allocator);
+        keys.reserve(entries.size());
+        unsigned int const order = geometry::detail::hilbert::max_order<dimension>::value;
+        for ( std::size_t i = 0 ; i < entries.size() ; ++i )
+        {
+            keys.push_back(key_type(geometry::detail::hilbert::point_index(entries[i].first, hint_box, order), i));
+        }
+
+        geometry::detail::parallel::sort(keys.begin(), keys.end(), std::less<key_type>(), threads);
+
+        Entries sorted(entries.get_allocator());
+        sorted.reserve(entries.size());
+        for ( std::size_t i = 0 ; i < keys.size() ; ++i )
+        {
+            sorted.push_back(entries[keys[i].second]);
+        }
+        entries.swap(sorted);
+    }
+
     template <typename BoxType, typename Strategy>
     class expandable_box
     {
@@ -299,7 +413,9 @@ private:
                                subtree_elements_counts const& subtree_counts,
                                parameters_type const& parameters,
                                translator_type const& translator,
-                               allocators_type & allocators)
+                               allocators_type & allocators,
+                               std::size_t threads,
+                               packing_algorithm algorithm)
     {
         BOOST_GEOMETRY_INDEX_ASSERT(0 < std::distance(first, last) && static_cast<size_type>(std::distance(first, last)) == values_count,
                                     "unexpected parameters");
@@ -369,26 +485,33 @@ private:
         rtree::elements(in).reserve(nodes_count);                                                           // MAY THROW (A)
         // calculate values box and copy values
         expandable_box<box_type, strategy_type> elements_box(detail::get_strategy(parameters));
-        
+
+        if ( algorithm == packing_str )
+        {
+            str_tile(first, last, values_count, subtree_counts);
+        }
+
         per_level_packets(first, last, hint_box, values_count, subtree_counts, next_subtree_counts,
                           rtree::elements(in), elements_box,
-                          parameters, translator, allocators);
+                          parameters, translator, allocators, threads, algorithm);
 
         auto_remover.release();
         return internal_element(elements_box.get(), n);
     }
 
-    template <typename EIt, typename ExpandableBox> inline static
+    template <typename EIt, typename Elements, typename ExpandableBox> inline static
     void per_level_packets(EIt first, EIt last,
                            box_type const& hint_box,
                            size_type values_count,
                            subtree_elements_counts const& subtree_counts,
                            subtree_elements_counts const& next_subtree_counts,
-                           internal_elements & elements,
+                           Elements & elements,
                            ExpandableBox & elements_box,
                            parameters_type const& parameters,
                            translator_type const& translator,
-                           allocators_type & allocators)
+                           allocators_type & allocators,
+                           std::size_t threads,
+                           packing_algorithm algorithm)
     {
         BOOST_GEOMETRY_INDEX_ASSERT(0 < std::distance(first, last) && static_cast<size_type>(std::distance(first, last)) == values_count,
                                     "unexpected parameters");
@@ -401,7 +524,7 @@ private:
         {
             // the end, move to the next level
             internal_element el = per_level(first, last, hint_box, values_count, next_subtree_counts,
-                                            parameters, translator, allocators);
+                                            parameters, translator, allocators, threads, algorithm);
 
             // in case if push_back() do throw here
             // and even if this is not probable (previously reserved memory, nonthrowing pairs copy)
@@ -418,23 +541,180 @@ private:
         size_type median_count = calculate_median_count(values_count, subtree_counts);
         EIt median = first + median_count;
 
-        coordinate_type greatest_length;
-        std::size_t greatest_dim_index = 0;
-        pack_utils::biggest_edge<dimension>::apply(hint_box, greatest_length, greatest_dim_index);
-        box_type left, right;
-        pack_utils::nth_element_and_half_boxes<0, dimension>
-            ::apply(first, median, last, hint_box, left, right, greatest_dim_index);
-        
+        // the other algorithms have already ordered the elements and don't
+        // use the hint box
+        box_type left = hint_box, right = hint_box;
+        if ( algorithm == packing_default )
+        {
+            coordinate_type greatest_length;
+            std::size_t greatest_dim_index = 0;
+            pack_utils::biggest_edge<dimension>::apply(hint_box, greatest_length, greatest_dim_index);
+            pack_utils::nth_element_and_half_boxes<0, dimension>
+                ::apply(first, median, last, hint_box, left, right, greatest_dim_index);
+        }
+
+        if ( 1 < threads )
+        {
+            per_level_packets_parallel(first, median, last, left, right,
+                                       values_count, median_count, subtree_counts, next_subtree_counts,
+                                       elements, elements_box,
+                                       parameters, translator, allocators, threads, algorithm);
+            return;
+        }
+
         per_level_packets(first, median, left,
                           median_count, subtree_counts, next_subtree_counts,
                           elements, elements_box,
-                          parameters, translator, allocators);
+                          parameters, translator, allocators, threads, algorithm);
         per_level_packets(median, last, right,
                           values_count - median_count, subtree_counts, next_subtree_counts,
                           elements, elements_box,
-                          parameters, translator, allocators);
+                          parameters, translator, allocators, threads, algorithm);
+    }
+
+    // Orders the elements of an internal node so that the packets created
+    // by per_level_packets() are the tiles of STR
+    template <typename EIt> inline static
+    void str_tile(EIt first, EIt last, size_type values_count,
+                  subtree_elements_counts const& subtree_counts)
+    {
+        std::vector<size_type> counts;
+        packets_counts(values_count, subtree_counts, counts);
+        str_tile(first, last, counts.begin(), counts.end(), 0);
+    }
+
+    template <typename EIt, typename CIt> inline static
+    void str_tile(EIt first, EIt last, CIt counts_first, CIt counts_last, std::size_t dim_index)
+    {
+        pack_utils::sort_by_dimension<0, dimension>::apply(first, last, dim_index);
+
+        std::size_t const packets = static_cast<std::size_t>(std::distance(counts_first, counts_last));
+        if ( dimension <= dim_index + 1 || packets <= 1 )
+        {
+            return;
+        }
+
+        std::size_t const slabs = pack_utils::str_slabs_count(packets, dimension - dim_index);
+        std::size_t const slab_packets = (packets + slabs - 1) / slabs;
+        while ( counts_first != counts_last )
+        {
+            CIt const slab_last = counts_first + (std::min)(slab_packets,
+                static_cast<std::size_t>(std::distance(counts_first, counts_last)));
+            size_type slab_count = 0;
+            for ( CIt it = counts_first ; it != slab_last ; ++it )
+            {
+                slab_count += *it;
+            }
+            EIt const slab_end = first + slab_count;
+            str_tile(first, slab_end, counts_first, slab_last, dim_index + 1);
+            first = slab_end;
+            counts_first = slab_last;
+        }
     }
 
+    // Calculates the numbers of elements of the packets in the same order
+    // in which they're created by per_level_packets()
+    inline static
+    void packets_counts(size_type values_count,
+                        subtree_elements_counts const& subtree_counts,
+                        std::vector<size_type> & counts)
+    {
+        if ( values_count <= subtree_counts.maxc )
+        {
+            counts.push_back(values_count);
+            return;
+        }
+
+        size_type median_count = calculate_median_count(values_count, subtree_counts);
+        packets_counts(median_count, subtree_counts, counts);
+        packets_counts(values_count - median_count, subtree_counts, counts);
+    }
+
+    // Both halves are created concurrently into temporary containers which are
+    // then appended in order, so the result is the same as the sequential one.
+    template <typename EIt, typename Elements, typename ExpandableBox> inline static
+    void per_level_packets_parallel(EIt first, EIt median, EIt last,
+                                    box_type const& left, box_type const& right,
+                                    size_type values_count,
+                                    size_type median_count,
+                                    subtree_elements_counts const& subtree_counts,
+                                    subtree_elements_counts const& next_subtree_counts,
+                                    Elements & elements,
+                                    ExpandableBox & elements_box,
+                                    parameters_type const& parameters,
+                                    translator_type const& translator,
+                                    allocators_type & allocators,
+                                    std::size_t threads,
+                                    packing_algorithm algorithm)
+    {
+        std::vector<internal_element> left_elements, right_elements;
+        elements_destroyer left_destroyer(left_elements, allocators);
+        elements_destroyer right_destroyer(right_elements, allocators);
+
+        std::size_t const left_threads = threads / 2;
+
+        geometry::detail::parallel::fork_join(
+            [&]()
+            {
+                ExpandableBox left_box(detail::get_strategy(parameters));
+                per_level_packets(first, median, left,
+                                  median_count, subtree_counts, next_subtree_counts,
+                                  left_elements, left_box,
+                                  parameters, translator, allocators, left_threads, algorithm);
+            },
+            [&]()
+            {
+                ExpandableBox right_box(detail::get_strategy(parameters));
+                per_level_packets(median, last, right,
+                                  values_count - median_count, subtree_counts, next_subtree_counts,
+                                  right_elements, right_box,
+                                  parameters, translator, allocators, threads - left_threads, algorithm);
+            },
+            true);
+
+        append_elements(left_elements, elements, elements_box);
+        append_elements(right_elements, elements, elements_box);
+    }
+
+    template <typename Elements, typename ExpandableBox> inline static
+    void append_elements(std::vector<internal_element> & source,
+                         Elements & elements,
+                         ExpandableBox & elements_box)
+    {
+        // Elements are removed from source one by one so in case of an exception
+        // each node is owned either by elements or by the source destroyer.
+        for ( std::size_t i = 0 ; i < source.size() ; ++i )
+        {
+            elements.push_back(source[i]);                                          // MAY THROW (A?,C) - however in normal conditions shouldn't
+            source[i].second = 0;
+            elements_box.expand(elements.back().first);
+        }
+        source.clear();
+    }
+
+    class elements_destroyer
+    {
+    public:
+        elements_destroyer(std::vector<internal_element> & elements, allocators_type & allocators)
+            : m_elements(elements), m_allocators(allocators)
+        {}
+
+        ~elements_destroyer()
+        {
+            for ( std::size_t i = 0 ; i < m_elements.size() ; ++i )
+            {
+                if ( m_elements[i].second )
+                {
+                    subtree_destroyer remover(m_elements[i].second, m_allocators);
+                }
+            }
+        }
+
+    private:
+        std::vector<internal_element> & m_elements;
+        allocators_type & m_allocators;
+    };
+
     inline static
     subtree_elements_counts calculate_subtree_elements_counts(size_type elements_count, parameters_type const& parameters, size_type & leafs_level)
     {
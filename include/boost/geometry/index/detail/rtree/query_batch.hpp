@@ -0,0 +1,181 @@
+// Boost.Geometry Index
+//
+// R-tree batched queries
+//
+// Copyright (c) 2026 Boost.Geometry contributors.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_QUERY_BATCH_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_QUERY_BATCH_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/util/algorithm.hpp>
+
+#include <boost/geometry/index/detail/distance_predicates.hpp>
+#include <boost/geometry/index/detail/predicates.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree {
+
+namespace query_batch {
+
+// Calculates the box of the area where the results of the predicate are
+// located. Returns false if the predicate doesn't define such area, e.g.
+// satisfies() or negated intersects().
+template <typename Predicate>
+struct predicate_box
+{
+    template <typename Box>
+    static inline bool apply(Predicate const&, Box &)
+    {
+        return false;
+    }
+};
+
+template <typename Geometry, typename Tag, bool Negated>
+struct predicate_box<predicates::spatial_predicate<Geometry, Tag, Negated> >
+{
+    template <typename Box>
+    static inline bool apply(predicates::spatial_predicate<Geometry, Tag, Negated> const& p,
+                             Box & box)
+    {
+        // only disjoint() and negated predicates other than disjoint() are
+        // not local
+        if (Negated != std::is_same<Tag, predicates::disjoint_tag>::value)
+        {
+            return false;
+        }
+        geometry::envelope(p.geometry, box);
+        return true;
+    }
+};
+
+template <typename PointOrRelation>
+struct predicate_box<predicates::nearest<PointOrRelation> >
+{
+    template <typename Box>
+    static inline bool apply(predicates::nearest<PointOrRelation> const& p, Box & box)
+    {
+        geometry::envelope(relation<PointOrRelation>::value(p.point_or_relation), box);
+        return true;
+    }
+};
+
+template <typename SegmentOrLinestring>
+struct predicate_box<predicates::path<SegmentOrLinestring> >
+{
+    template <typename Box>
+    static inline bool apply(predicates::path<SegmentOrLinestring> const& p, Box & box)
+    {
+        geometry::envelope(p.geometry, box);
+        return true;
+    }
+};
+
+// The first predicate defining the area is used
+template <typename ...Predicates>
+struct predicate_box<std::tuple<Predicates...> >
+{
+    template <typename Box>
+    static inline bool apply(std::tuple<Predicates...> const& p, Box & box)
+    {
+        return apply(p, box, std::integral_constant<std::size_t, 0>());
+    }
+
+private:
+    template <typename Box, std::size_t I>
+    static inline bool apply(std::tuple<Predicates...> const& p, Box & box,
+                             std::integral_constant<std::size_t, I>)
+    {
+        typedef std::tuple_element_t<I, std::tuple<Predicates...> > predicate_type;
+        return predicate_box<predicate_type>::apply(std::get<I>(p), box)
+            || apply(p, box, std::integral_constant<std::size_t, I + 1>());
+    }
+
+    template <typename Box>
+    static inline bool apply(std::tuple<Predicates...> const&, Box &,
+                             std::integral_constant<std::size_t, sizeof...(Predicates)>)
+    {
+        return false;
+    }
+};
+
+// Calculates the Morton code (Z-order) of the center of the box quantized
+// in the grid covering the bounds
+template <typename Box>
+inline std::uint64_t morton_code(Box const& box, Box const& bounds)
+{
+    static const std::size_t dimension = geometry::dimension<Box>::value;
+    static const std::size_t bits = (std::min)(std::size_t(32),
+                                               (std::max)(std::size_t(1), 64 / dimension));
+    static const double cells = double((std::uint64_t(1) << bits) - 1);
+
+    std::uint64_t cell[dimension];
+    geometry::detail::for_each_dimension<Box>([&](auto index)
+    {
+        double const lo = double(geometry::get<min_corner, index>(bounds));
+        double const hi = double(geometry::get<max_corner, index>(bounds));
+        double const c = (double(geometry::get<min_corner, index>(box))
+                        + double(geometry::get<max_corner, index>(box))) / 2;
+        double t = (c - lo) / (hi - lo);
+        // also handles NaN, e.g. for degenerated bounds
+        t = t > 0 ? (t < 1 ? t : 1) : 0;
+        cell[index] = std::uint64_t(t * cells);
+    });
+
+    std::uint64_t result = 0;
+    for (std::size_t b = bits ; b > 0 ; --b)
+    {
+        for (std::size_t d = 0 ; d < dimension ; ++d)
+        {
+            result = (result << 1) | ((cell[d] >> (b - 1)) & 1);
+        }
+    }
+    return result;
+}
+
+// Calculates the order in which the predicates should be processed so that
+// the queries close to each other are performed one after another. The order
+// of predicates not defining the area is preserved, they are processed first.
+template <typename PredicatesIterator, typename Box>
+inline void spatial_order(PredicatesIterator first, std::size_t count, Box const& bounds,
+                          std::vector<std::size_t> & order)
+{
+    typedef typename std::iterator_traits<PredicatesIterator>::value_type predicates_type;
+
+    std::vector<std::pair<std::uint64_t, std::size_t> > codes;
+    codes.reserve(count);
+    Box box;
+    for (std::size_t i = 0 ; i < count ; ++i, ++first)
+    {
+        std::uint64_t const code = predicate_box<predicates_type>::apply(*first, box)
+                                 ? morton_code(box, bounds) : 0;
+        codes.push_back(std::make_pair(code, i));
+    }
+
+    std::sort(codes.begin(), codes.end());
+
+    order.resize(count);
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        order[i] = codes[i].second;
+    }
+}
+
+} // namespace query_batch
+
+}}}}} // namespace boost::geometry::index::detail::rtree
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_QUERY_BATCH_HPP
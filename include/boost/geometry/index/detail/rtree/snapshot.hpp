@@ -0,0 +1,574 @@
+// Boost.Geometry Index
+//
+// R-tree copy-on-write modifications used by the snapshot rtree
+//
+// Copyright (c) 2026 Boost.Geometry contributors.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_SNAPSHOT_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_SNAPSHOT_HPP
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
+#include <boost/geometry/index/detail/assert.hpp>
+#include <boost/geometry/index/detail/rtree/node/node.hpp>
+#include <boost/geometry/index/detail/rtree/node/node_elements.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/insert.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/is_leaf.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace snapshot {
+
+// Gives the snapshot rtree access to the nodes structure of the rtree
+template <typename Rtree>
+class access
+{
+public:
+    typedef typename Rtree::members_holder members_holder;
+
+    static members_holder & members(Rtree & rt)
+    {
+        return rt.m_members;
+    }
+
+    static members_holder const& members(Rtree const& rt)
+    {
+        return rt.m_members;
+    }
+};
+
+// Creates a copy of a node sharing the children of the original node
+template <typename MembersHolder>
+class copy_node
+    : public MembersHolder::visitor
+{
+    typedef typename MembersHolder::allocators_type allocators_type;
+
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    typedef typename allocators_type::node_pointer node_pointer;
+
+public:
+    explicit inline copy_node(allocators_type & allocators)
+        : result(0)
+        , m_allocators(allocators)
+    {}
+
+    inline void operator()(internal_node & n)
+    {
+        result = apply(n);
+    }
+
+    inline void operator()(leaf & n)
+    {
+        result = apply(n);
+    }
+
+    node_pointer result;
+
+private:
+    template <typename Node>
+    inline node_pointer apply(Node & n)
+    {
+        node_pointer new_node = rtree::create_node<allocators_type, Node>::apply(m_allocators);           // MAY THROW, STRONG (N: alloc)
+
+        BOOST_TRY
+        {
+            rtree::elements(rtree::get<Node>(*new_node)) = rtree::elements(n);                        // MAY THROW (V, E: alloc, copy)
+        }
+        BOOST_CATCH(...)
+        {
+            rtree::destroy_node<allocators_type, Node>::apply(m_allocators, new_node);
+            BOOST_RETHROW                                                                             // RETHROW
+        }
+        BOOST_CATCH_END
+
+        return new_node;
+    }
+
+    allocators_type & m_allocators;
+};
+
+// Destroys a node without destroying its children
+template <typename MembersHolder>
+inline void destroy_node(typename MembersHolder::node_pointer n,
+                         typename MembersHolder::allocators_type & allocators)
+{
+    typedef typename MembersHolder::allocators_type allocators_type;
+
+    visitors::is_leaf<MembersHolder> ilv;
+    rtree::apply_visitor(ilv, *n);
+    if (ilv.result)
+    {
+        rtree::destroy_node<allocators_type, typename MembersHolder::leaf>::apply(allocators, n);
+    }
+    else
+    {
+        rtree::destroy_node<allocators_type, typename MembersHolder::internal_node>::apply(allocators, n);
+    }
+}
+
+// Modifies the nodes structure stored in MembersHolder which shares nodes with
+// the previous version of the rtree. The nodes of the previous version are
+// never modified, each of them is copied before the first modification and
+// the replaced node is stored. So the nodes on a path from the root to a leaf
+// are copied and the rest is shared.
+template <typename MembersHolder>
+class writer
+{
+    typedef typename MembersHolder::value_type value_type;
+    typedef typename MembersHolder::box_type box_type;
+    typedef typename MembersHolder::size_type size_type;
+    typedef typename MembersHolder::allocators_type allocators_type;
+
+    typedef typename MembersHolder::node node;
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    typedef typename allocators_type::node_pointer node_pointer;
+
+    typedef typename rtree::elements_type<internal_node>::type internal_elements_type;
+    typedef typename rtree::elements_type<leaf>::type leaf_elements_type;
+
+public:
+    explicit writer(MembersHolder & members)
+        : m_members(members)
+        , m_old_root(members.root)
+        , m_old_leafs_level(members.leafs_level)
+    {}
+
+    // true if the nodes structure is different than in the previous version
+    bool modified() const
+    {
+        return m_members.root != m_old_root;
+    }
+
+    // The nodes of the previous version which are not used by this version
+    std::vector<node_pointer> & replaced()
+    {
+        return m_replaced;
+    }
+
+    // Returns the node which may be modified in place of the node n
+    node_pointer modifiable(node_pointer n)
+    {
+        if (m_created.count(std::addressof(*n)) > 0)
+        {
+            return n;
+        }
+
+        copy_node<MembersHolder> copy_v(m_members.allocators());
+        rtree::apply_visitor(copy_v, *n);                                                            // MAY THROW (V, E: alloc, copy, N: alloc)
+
+        BOOST_TRY
+        {
+            created(copy_v.result);                                                                  // MAY THROW (alloc)
+            m_replaced.push_back(n);                                                                 // MAY THROW (alloc)
+        }
+        BOOST_CATCH(...)
+        {
+            destroy_created(copy_v.result);
+            BOOST_RETHROW                                                                            // RETHROW
+        }
+        BOOST_CATCH_END
+
+        return copy_v.result;
+    }
+
+    // Marks the node created by this writer, it may be modified in place
+    // NOTE: If this throws the node is copied before the next modification
+    //       so nothing besides performance is affected
+    void created(node_pointer n)
+    {
+        m_created.emplace(std::addressof(*n), n);
+    }
+
+    void insert(value_type const& value)
+    {
+        if (! m_members.root)
+        {
+            m_members.root = rtree::create_node<allocators_type, leaf>::apply(m_members.allocators()); // MAY THROW (N: alloc)
+            m_members.leafs_level = 0;
+            created(m_members.root);                                                                 // MAY THROW (alloc)
+        }
+
+        insert(value, 0);
+
+        ++m_members.values_count;
+    }
+
+    size_type remove(value_type const& value)
+    {
+        std::vector<std::size_t> path;
+        if (! m_members.root
+         || ! find(value, m_members.root, 0, path))
+        {
+            return 0;
+        }
+
+        // copy the nodes on the path to the value
+        m_members.root = modifiable(m_members.root);                                                 // MAY THROW (V, E: alloc, copy, N: alloc)
+
+        std::vector<internal_node*> parents;
+        node_pointer n = m_members.root;
+        for (size_type level = 0 ; level < m_members.leafs_level ; ++level)
+        {
+            internal_node & in = rtree::get<internal_node>(*n);
+            parents.push_back(&in);                                                                  // MAY THROW (alloc)
+            auto & element = rtree::elements(in)[path[level]];
+            element.second = modifiable(element.second);                                           // MAY THROW (V, E: alloc, copy, N: alloc)
+            n = element.second;
+        }
+
+        leaf_elements_type & values = rtree::elements(rtree::get<leaf>(*n));
+        rtree::move_from_back(values, values.begin() + path.back());                                // MAY THROW (V: copy)
+        values.pop_back();
+        --m_members.values_count;
+
+        // going from the leaf to the root remove the nodes with too few
+        // elements from their parents or update the boxes of the nodes
+        auto const strategy = index::detail::get_strategy(m_members.parameters());
+        size_type const min_elements = m_members.parameters().get_min_elements();
+        std::vector<std::pair<size_type, node_pointer> > underflowed;
+        bool is_underflow = values.size() < min_elements;
+        for (std::size_t i = parents.size() ; i-- > 0 ; )
+        {
+            internal_elements_type & elements = rtree::elements(*parents[i]);
+            auto const it = elements.begin() + path[i];
+            if (is_underflow)
+            {
+                underflowed.push_back(std::make_pair(m_members.leafs_level - i, it->second));       // MAY THROW (alloc)
+                rtree::move_from_back(elements, it);                                                 // MAY THROW (E: copy)
+                elements.pop_back();
+            }
+            else if (i + 1 == parents.size())
+            {
+                leaf_elements_type const& child = rtree::elements(rtree::get<leaf>(*it->second));
+                it->first = rtree::values_box<box_type>(child.begin(), child.end(),
+                                                        m_members.translator(), strategy);
+            }
+            else
+            {
+                internal_elements_type const& child = rtree::elements(rtree::get<internal_node>(*it->second));
+                it->first = rtree::elements_box<box_type>(child.begin(), child.end(),
+                                                          m_members.translator(), strategy);
+            }
+
+            is_underflow = elements.size() < min_elements;
+        }
+
+        // reinsert elements of removed nodes, begin with levels closer to the root
+        for (auto it = underflowed.rbegin() ; it != underflowed.rend() ; ++it)
+        {
+            if (it->first == 1)
+            {
+                for (value_type const& v : rtree::elements(rtree::get<leaf>(*it->second)))
+                {
+                    insert(v, 0);                                                                    // MAY THROW (V, E: alloc, copy, N: alloc)
+                }
+            }
+            else
+            {
+                for (auto const& e : rtree::elements(rtree::get<internal_node>(*it->second)))
+                {
+                    insert(e, it->first - 1);                                                        // MAY THROW (E: alloc, copy, N: alloc)
+                }
+            }
+
+            destroy_created(it->second);
+        }
+
+        // shorten the tree
+        if (m_members.leafs_level > 0
+         && rtree::elements(rtree::get<internal_node>(*m_members.root)).size() <= 1)
+        {
+            node_pointer const root_to_destroy = m_members.root;
+            internal_elements_type const& elements = rtree::elements(rtree::get<internal_node>(*root_to_destroy));
+            m_members.root = elements.empty() ? node_pointer(0) : elements[0].second;
+            --m_members.leafs_level;
+
+            destroy_created(root_to_destroy);
+        }
+
+        return 1;
+    }
+
+    // Destroys the nodes created by this writer after an exception was thrown.
+    // The nodes of the previous version are not affected.
+    void rollback()
+    {
+        std::unordered_set<node const*> old_nodes;
+        if (m_old_root)
+        {
+            collect(m_old_root, 0, m_old_leafs_level, old_nodes);
+        }
+
+        std::unordered_set<node const*> destroyed;
+        if (m_members.root)
+        {
+            destroy_new(m_members.root, 0, old_nodes, destroyed);
+        }
+
+        for (node_pointer n : m_replaced)
+        {
+            destroy_new_node(n, old_nodes, destroyed);
+        }
+
+        // e.g. the nodes removed from the tree before reinsertion of elements
+        for (auto const& c : m_created)
+        {
+            destroy_new_node(c.second, old_nodes, destroyed);
+        }
+        m_created.clear();
+
+        m_members.root = m_old_root;
+        m_members.leafs_level = m_old_leafs_level;
+    }
+
+private:
+    template <typename Element>
+    void insert(Element const& element, size_type relative_level);
+
+    bool find(value_type const& value, node_pointer n, size_type level,
+              std::vector<std::size_t> & path) const
+    {
+        auto const strategy = index::detail::get_strategy(m_members.parameters());
+
+        if (level == m_members.leafs_level)
+        {
+            leaf_elements_type const& values = rtree::elements(rtree::get<leaf>(*n));
+            for (std::size_t i = 0 ; i < values.size() ; ++i)
+            {
+                if (m_members.translator().equals(values[i], value, strategy))
+                {
+                    path.push_back(i);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        internal_elements_type const& children = rtree::elements(rtree::get<internal_node>(*n));
+        for (std::size_t i = 0 ; i < children.size() ; ++i)
+        {
+            if (index::detail::covered_by_bounds(m_members.translator()(value),
+                                                 children[i].first, strategy))
+            {
+                path.push_back(i);
+                if (find(value, children[i].second, level + 1, path))
+                {
+                    return true;
+                }
+                path.pop_back();
+            }
+        }
+        return false;
+    }
+
+    void destroy_created(node_pointer n)
+    {
+        m_created.erase(std::addressof(*n));
+        snapshot::destroy_node<MembersHolder>(n, m_members.allocators());
+    }
+
+    void collect(node_pointer n, size_type level, size_type leafs_level,
+                 std::unordered_set<node const*> & nodes) const
+    {
+        nodes.insert(std::addressof(*n));
+        if (level < leafs_level)
+        {
+            for (auto const& e : rtree::elements(rtree::get<internal_node>(*n)))
+            {
+                collect(e.second, level + 1, leafs_level, nodes);
+            }
+        }
+    }
+
+    void destroy_new(node_pointer n, size_type level,
+                     std::unordered_set<node const*> const& old_nodes,
+                     std::unordered_set<node const*> & destroyed)
+    {
+        if (old_nodes.count(std::addressof(*n)) > 0)
+        {
+            return;
+        }
+        if (level < m_members.leafs_level)
+        {
+            for (auto const& e : rtree::elements(rtree::get<internal_node>(*n)))
+            {
+                destroy_new(e.second, level + 1, old_nodes, destroyed);
+            }
+        }
+        destroy_new_node(n, old_nodes, destroyed);
+    }
+
+    void destroy_new_node(node_pointer n,
+                          std::unordered_set<node const*> const& old_nodes,
+                          std::unordered_set<node const*> & destroyed)
+    {
+        node const* const ptr = std::addressof(*n);
+        if (old_nodes.count(ptr) == 0 && destroyed.insert(ptr).second)
+        {
+            snapshot::destroy_node<MembersHolder>(n, m_members.allocators());
+        }
+    }
+
+    MembersHolder & m_members;
+    node_pointer const m_old_root;
+    size_type const m_old_leafs_level;
+
+    std::vector<node_pointer> m_replaced;
+    std::unordered_map<node const*, node_pointer> m_created;
+};
+
+// Insert visitor copying the nodes of the previous version before modifying
+// them. The default insert algorithm is used for all balancing algorithms,
+// i.e. there is no forced reinsertion since it would modify nodes outside
+// of the path from the root to the leaf.
+template <typename Element, typename MembersHolder>
+class insert
+    : public visitors::detail::insert<Element, MembersHolder>
+{
+    typedef visitors::detail::insert<Element, MembersHolder> base;
+
+    typedef typename base::value_type value_type;
+    typedef typename base::parameters_type parameters_type;
+    typedef typename base::translator_type translator_type;
+    typedef typename base::allocators_type allocators_type;
+
+    typedef typename base::internal_node internal_node;
+    typedef typename base::leaf leaf;
+
+    typedef typename base::node_pointer node_pointer;
+    typedef typename base::size_type size_type;
+
+public:
+    inline insert(node_pointer & root,
+                  size_type & leafs_level,
+                  Element const& element,
+                  parameters_type const& parameters,
+                  translator_type const& translator,
+                  allocators_type & allocators,
+                  writer<MembersHolder> & w,
+                  size_type relative_level = 0)
+        : base(root, leafs_level, element, parameters, translator, allocators, relative_level)
+        , m_writer(w)
+    {}
+
+    inline void operator()(internal_node & n)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(base::m_traverse_data.current_level < base::m_leafs_level, "unexpected level");
+
+        if (base::m_traverse_data.current_level < base::m_level)
+        {
+            traverse(n);                                                                             // MAY THROW (V, E: alloc, copy, N: alloc)
+        }
+        else
+        {
+            push_back(n, typename std::is_same<Element, value_type>::type());                                       // MAY THROW, STRONG (E: alloc, copy)
+        }
+
+        post_traverse(n);                                                                            // MAY THROW (E: alloc, copy, N: alloc)
+    }
+
+    inline void operator()(leaf & n)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(base::m_traverse_data.current_level == base::m_leafs_level, "unexpected level");
+
+        push_back(n, typename std::is_same<Element, value_type>::type());                                           // MAY THROW, STRONG (V: alloc, copy)
+
+        post_traverse(n);                                                                            // MAY THROW (V: alloc, copy, N: alloc)
+    }
+
+private:
+    inline void traverse(internal_node & n)
+    {
+        std::size_t const choosen_node_index = rtree::choose_next_node<MembersHolder>
+            ::apply(n, rtree::element_indexable(base::m_element, base::m_translator),
+                    base::m_parameters,
+                    base::m_leafs_level - base::m_traverse_data.current_level);
+
+        auto & element = rtree::elements(n)[choosen_node_index];
+
+        element.second = m_writer.modifiable(element.second);                                       // MAY THROW (V, E: alloc, copy, N: alloc)
+
+        index::detail::expand(element.first, base::m_element_bounds,
+                              index::detail::get_strategy(base::m_parameters));
+
+        base::traverse_apply_visitor(*this, n, choosen_node_index);                                  // MAY THROW (V, E: alloc, copy, N: alloc)
+    }
+
+    template <typename Node>
+    inline void post_traverse(Node & n)
+    {
+        if (base::m_parameters.get_max_elements() < rtree::elements(n).size())
+        {
+            bool const is_root = base::m_traverse_data.current_is_root();
+
+            base::split(n);                                                                          // MAY THROW (V, E: alloc, copy, N:alloc)
+
+            // the nodes created by the split may be modified in place
+            if (is_root)
+            {
+                m_writer.created(base::m_root_node);
+                m_writer.created(rtree::elements(rtree::get<internal_node>(*base::m_root_node)).back().second);
+            }
+            else
+            {
+                m_writer.created(base::m_traverse_data.parent_elements().back().second);
+            }
+        }
+    }
+
+    // NOTE: The element pushed to an internal node is a subtree which may be
+    //       shared with the previous versions so it's not destroyed if this throws.
+    inline void push_back(internal_node & n, std::false_type /*is_value*/)
+    {
+        rtree::elements(n).push_back(base::m_element);                                               // MAY THROW, STRONG (E: alloc, copy)
+    }
+
+    inline void push_back(leaf & n, std::true_type /*is_value*/)
+    {
+        rtree::elements(n).push_back(base::m_element);                                               // MAY THROW, STRONG (V: alloc, copy)
+    }
+
+    template <typename Node, typename IsValue>
+    inline void push_back(Node &, IsValue)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(false, "unexpected level");
+    }
+
+    writer<MembersHolder> & m_writer;
+};
+
+template <typename MembersHolder>
+template <typename Element>
+inline void writer<MembersHolder>::insert(Element const& element, size_type relative_level)
+{
+    m_members.root = modifiable(m_members.root);                                                     // MAY THROW (V, E: alloc, copy, N: alloc)
+
+    snapshot::insert<Element, MembersHolder>
+        insert_v(m_members.root, m_members.leafs_level, element,
+                 m_members.parameters(), m_members.translator(), m_members.allocators(),
+                 *this, relative_level);
+
+    rtree::apply_visitor(insert_v, *m_members.root);                                                 // MAY THROW (V, E: alloc, copy, N: alloc)
+}
+
+}}} // namespace detail::rtree::snapshot
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_SNAPSHOT_HPP
@@ -90,7 +90,7 @@ private:
     }
 
     size_t m_current_level;
-    parameters_type const& m_parameters;
+    parameters_type m_parameters;
     bool m_check_min;
 };
 
@@ -0,0 +1,390 @@
+// Boost.Geometry Index
+//
+// R-tree batch updating visitor implementation
+//
+// Copyright (c) 2026 Boost.Geometry contributors.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_UPDATE_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_UPDATE_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/algorithms/detail/covered_by/interface.hpp>
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
+#include <boost/geometry/index/detail/rtree/node/node_elements.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/destroy.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/insert.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace visitors {
+
+// Replaces a batch of old values with the new ones in one traversal.
+// The items are passed down to the children which boxes cover the old values.
+// A new value is stored in place of the old one if it's covered by the box
+// of the leaf, otherwise the old value is removed and the new one has to be
+// inserted afterwards. The boxes of modified nodes are updated and underflows
+// are handled after all children of a node are traversed.
+template <typename MembersHolder>
+class update
+    : public MembersHolder::visitor
+{
+    typedef typename MembersHolder::box_type box_type;
+    typedef typename MembersHolder::value_type value_type;
+    typedef typename MembersHolder::parameters_type parameters_type;
+    typedef typename MembersHolder::translator_type translator_type;
+    typedef typename MembersHolder::allocators_type allocators_type;
+
+    typedef typename MembersHolder::node node;
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    typedef typename allocators_type::node_pointer node_pointer;
+    typedef typename allocators_type::size_type size_type;
+
+    typedef typename rtree::elements_type<internal_node>::type::size_type internal_size_type;
+
+    //typedef typename Allocators::internal_node_pointer internal_node_pointer;
+    typedef internal_node * internal_node_pointer;
+
+public:
+    // pairs of pointers to the old and the new values
+    typedef std::vector<std::pair<value_type const*, value_type const*> > items_type;
+
+    inline update(node_pointer & root,
+                  size_type & leafs_level,
+                  items_type const& items,
+                  parameters_type const& parameters,
+                  translator_type const& translator,
+                  allocators_type & allocators)
+        : m_items(items)
+        , m_parameters(parameters)
+        , m_translator(translator)
+        , m_allocators(allocators)
+        , m_root_node(root)
+        , m_leafs_level(leafs_level)
+        , m_is_found(items.size(), false)
+        , m_updated_count(0)
+        , m_parent(0)
+        , m_current_child_index(0)
+        , m_current_level(0)
+        , m_is_modified(false)
+    {
+        m_current_items.reserve(items.size());
+        for (std::size_t i = 0 ; i < items.size() ; ++i)
+        {
+            m_current_items.push_back(i);
+        }
+    }
+
+    inline void operator()(internal_node & n)
+    {
+        typedef typename rtree::elements_type<internal_node>::type children_type;
+        children_type & children = rtree::elements(n);
+
+        std::vector<std::size_t> const node_items = std::move(m_current_items);
+        std::vector<internal_size_type> modified_children;
+
+        // traverse children which boxes cover old values not found yet
+        for (internal_size_type i = 0 ; i < children.size() ; ++i)
+        {
+            m_current_items.clear();
+            for (std::size_t item : node_items)
+            {
+                if (! m_is_found[item]
+                 && index::detail::covered_by_bounds(m_translator(*m_items[item].first),
+                                                     children[i].first,
+                                                     index::detail::get_strategy(m_parameters)))
+                {
+                    m_current_items.push_back(item);                                                    // MAY THROW (alloc)
+                }
+            }
+
+            if (! m_current_items.empty())
+            {
+                traverse_apply_visitor(n, i);                                                           // MAY THROW (V, E: alloc, copy, N: alloc)
+
+                if (m_is_modified)
+                {
+                    modified_children.push_back(i);                                                     // MAY THROW (alloc)
+                }
+            }
+        }
+
+        m_is_modified = ! modified_children.empty();
+
+        // remove the underflowed children and update boxes of the rest,
+        // begin from the back to not invalidate the indexes of other children
+        size_type const relative_level = m_leafs_level - m_current_level;
+        for (auto it = modified_children.rbegin() ; it != modified_children.rend() ; ++it)
+        {
+            typename children_type::iterator const child_it = children.begin() + *it;
+            if (relative_level == 1)
+            {
+                typename rtree::elements_type<leaf>::type const& elements
+                    = rtree::elements(rtree::get<leaf>(*child_it->second));
+                if (elements.size() < m_parameters.get_min_elements())
+                {
+                    store_underflowed_node(children, child_it, relative_level);                         // MAY THROW (E: alloc, copy)
+                }
+                else
+                {
+                    child_it->first = rtree::values_box<box_type>(elements.begin(), elements.end(), m_translator,
+                                                                  index::detail::get_strategy(m_parameters));
+                }
+            }
+            else
+            {
+                children_type const& elements = rtree::elements(rtree::get<internal_node>(*child_it->second));
+                if (elements.size() < m_parameters.get_min_elements())
+                {
+                    store_underflowed_node(children, child_it, relative_level);                         // MAY THROW (E: alloc, copy)
+                }
+                else
+                {
+                    child_it->first = rtree::elements_box<box_type>(elements.begin(), elements.end(), m_translator,
+                                                                    index::detail::get_strategy(m_parameters));
+                }
+            }
+        }
+
+        // n is root node
+        if ( 0 == m_parent )
+        {
+            BOOST_GEOMETRY_INDEX_ASSERT(&n == &rtree::get<internal_node>(*m_root_node), "node must be the root");
+
+            // reinsert elements from removed nodes (underflows)
+            reinsert_removed_nodes_elements();                                                          // MAY THROW (V, E: alloc, copy, N: alloc)
+
+            // shorten the tree
+            while ( 0 < m_leafs_level
+                 && rtree::elements(rtree::get<internal_node>(*m_root_node)).size() <= 1 )
+            {
+                node_pointer root_to_destroy = m_root_node;
+                children_type & root_elements = rtree::elements(rtree::get<internal_node>(*m_root_node));
+                if ( root_elements.empty() )
+                {
+                    m_root_node = 0;
+                    m_leafs_level = 0;
+                }
+                else
+                {
+                    m_root_node = root_elements[0].second;
+                    --m_leafs_level;
+                }
+
+                rtree::destroy_node<allocators_type, internal_node>::apply(m_allocators, root_to_destroy);
+
+                if ( 0 == m_root_node )
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    inline void operator()(leaf & n)
+    {
+        typedef typename rtree::elements_type<leaf>::type elements_type;
+        elements_type & elements = rtree::elements(n);
+
+        // the root has no bounds
+        box_type const* const bounds = 0 != m_parent
+                                     ? &rtree::elements(*m_parent)[m_current_child_index].first
+                                     : 0;
+
+        m_is_modified = false;
+
+        for (std::size_t item : m_current_items)
+        {
+            if (m_is_found[item])
+            {
+                continue;
+            }
+
+            for (typename elements_type::iterator it = elements.begin() ; it != elements.end() ; ++it)
+            {
+                if ( m_translator.equals(*it, *m_items[item].first, index::detail::get_strategy(m_parameters)) )
+                {
+                    m_is_found[item] = true;
+                    ++m_updated_count;
+                    m_is_modified = true;
+
+                    if ( 0 == bounds
+                      || index::detail::covered_by_bounds(m_translator(*m_items[item].second), *bounds,
+                                                          index::detail::get_strategy(m_parameters)) )
+                    {
+                        // the new value stays in this leaf
+                        *it = *m_items[item].second;                                                    // MAY THROW (V: copy)
+                    }
+                    else
+                    {
+                        m_relocated.push_back(item);                                                    // MAY THROW (alloc)
+                        rtree::move_from_back(elements, it);                                            // MAY THROW (V: copy)
+                        elements.pop_back();
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    // The number of old values found in the tree
+    size_type updated_count() const
+    {
+        return m_updated_count;
+    }
+
+    // The items which old values were removed and new values should be inserted
+    std::vector<std::size_t> const& relocated() const
+    {
+        return m_relocated;
+    }
+
+private:
+
+    typedef std::vector< std::pair<size_type, node_pointer> > underflow_nodes;
+
+    void traverse_apply_visitor(internal_node &n, internal_size_type choosen_node_index)
+    {
+        // save previous traverse inputs and set new ones
+        internal_node_pointer parent_bckup = m_parent;
+        internal_size_type current_child_index_bckup = m_current_child_index;
+        size_type current_level_bckup = m_current_level;
+
+        m_parent = &n;
+        m_current_child_index = choosen_node_index;
+        ++m_current_level;
+
+        // next traversing step
+        rtree::apply_visitor(*this, *rtree::elements(n)[choosen_node_index].second);                    // MAY THROW (V, E: alloc, copy, N: alloc)
+
+        // restore previous traverse inputs
+        m_parent = parent_bckup;
+        m_current_child_index = current_child_index_bckup;
+        m_current_level = current_level_bckup;
+    }
+
+    void store_underflowed_node(
+            typename rtree::elements_type<internal_node>::type & elements,
+            typename rtree::elements_type<internal_node>::type::iterator underfl_el_it,
+            size_type relative_level)
+    {
+        // move node to the container - store node's relative level as well
+        m_underflowed_nodes.push_back(std::make_pair(relative_level, underfl_el_it->second));           // MAY THROW (E: alloc, copy)
+
+        BOOST_TRY
+        {
+            rtree::move_from_back(elements, underfl_el_it);                                             // MAY THROW (E: copy)
+            elements.pop_back();
+        }
+        BOOST_CATCH(...)
+        {
+            m_underflowed_nodes.pop_back();
+            BOOST_RETHROW                                                                                 // RETHROW
+        }
+        BOOST_CATCH_END
+    }
+
+    void reinsert_removed_nodes_elements()
+    {
+        typename underflow_nodes::reverse_iterator it = m_underflowed_nodes.rbegin();
+
+        BOOST_TRY
+        {
+            // reinsert elements from removed nodes
+            // begin with levels closer to the root
+            for ( ; it != m_underflowed_nodes.rend() ; ++it )
+            {
+                // it->first is an index of a level of a node, not children
+                // counted from the leafs level
+                if ( it->first == 1 )
+                {
+                    reinsert_node_elements(rtree::get<leaf>(*it->second), it->first);                        // MAY THROW (V, E: alloc, copy, N: alloc)
+
+                    rtree::destroy_node<allocators_type, leaf>::apply(m_allocators, it->second);
+                }
+                else
+                {
+                    reinsert_node_elements(rtree::get<internal_node>(*it->second), it->first);               // MAY THROW (V, E: alloc, copy, N: alloc)
+
+                    rtree::destroy_node<allocators_type, internal_node>::apply(m_allocators, it->second);
+                }
+            }
+        }
+        BOOST_CATCH(...)
+        {
+            // destroy current and remaining nodes
+            for ( ; it != m_underflowed_nodes.rend() ; ++it )
+            {
+                rtree::visitors::destroy<MembersHolder>::apply(it->second, m_allocators);
+            }
+
+            BOOST_RETHROW                                                                                      // RETHROW
+        }
+        BOOST_CATCH_END
+    }
+
+    template <typename Node>
+    void reinsert_node_elements(Node &n, size_type node_relative_level)
+    {
+        typedef typename rtree::elements_type<Node>::type elements_type;
+        elements_type & elements = rtree::elements(n);
+
+        typename elements_type::iterator it = elements.begin();
+        BOOST_TRY
+        {
+            for ( ; it != elements.end() ; ++it )
+            {
+                visitors::insert<typename elements_type::value_type, MembersHolder>
+                    insert_v(m_root_node, m_leafs_level, *it,
+                             m_parameters, m_translator, m_allocators,
+                             node_relative_level - 1);
+
+                rtree::apply_visitor(insert_v, *m_root_node);                                               // MAY THROW (V, E: alloc, copy, N: alloc)
+            }
+        }
+        BOOST_CATCH(...)
+        {
+            ++it;
+            rtree::destroy_elements<MembersHolder>::apply(it, elements.end(), m_allocators);
+            elements.clear();
+            BOOST_RETHROW                                                                                     // RETHROW
+        }
+        BOOST_CATCH_END
+    }
+
+    items_type const& m_items;
+    parameters_type const& m_parameters;
+    translator_type const& m_translator;
+    allocators_type & m_allocators;
+
+    node_pointer & m_root_node;
+    size_type & m_leafs_level;
+
+    std::vector<bool> m_is_found;
+    size_type m_updated_count;
+    std::vector<std::size_t> m_relocated;
+    underflow_nodes m_underflowed_nodes;
+
+    // traversing input parameters
+    std::vector<std::size_t> m_current_items;
+    internal_node_pointer m_parent;
+    internal_size_type m_current_child_index;
+    size_type m_current_level;
+
+    // traversing output parameters
+    bool m_is_modified;
+};
+
+}}} // namespace detail::rtree::visitors
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_UPDATE_HPP
@@ -0,0 +1,328 @@
+// Boost.Geometry Index
+//
+// Read-only view of the R-tree stored in the flat, pointer-free layout
+//
+// Copyright (c) 2026 Boost.Geometry contributors.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_FLAT_RTREE_VIEW_HPP
+#define BOOST_GEOMETRY_INDEX_FLAT_RTREE_VIEW_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <type_traits>
+
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/strategies/default_strategy.hpp>
+
+#include <boost/geometry/index/detail/rtree/flat/layout.hpp>
+#include <boost/geometry/index/detail/rtree/flat/query.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+/*!
+\brief The read-only view of the R-tree stored in the flat layout.
+
+The flat layout is a contiguous block of memory containing the nodes, the
+bounding boxes of the nodes and the values of the rtree. The coordinates of the
+boxes are stored as structure of arrays so for cartesian boxes with floating
+point coordinates the children of nodes with more than 8 children are checked
+in blocks by loops which may be vectorized by the compiler. This is done in
+query() for intersects() predicates with a Box and for nearest() predicates
+with a Point. The nodes refer to their children with indexes instead of
+pointers, so the data may be written to a file with write_flat() and then used
+directly, e.g. after mapping the file into memory. Constructing the view
+doesn't copy nor deserialize the data.
+
+The boxes of the nodes may be quantized by write_flat(), i.e. stored with
+8 or 16 bits per coordinate relative to the box of the parent node. The
+quantized boxes are rounded outward so they contain the original ones and
+the nodes are filtered with them while the values are always checked
+exactly, so the results of the queries are the same. Such data is smaller so
+more nodes fit in the cache at the cost of visiting some nodes which wouldn't
+be visited otherwise.
+
+The data is stored in the native representation so it may be used only on the
+platform with the same byte order and the same sizes of types as the one
+where it was written.
+
+\par Example
+\verbatim
+// write the rtree to the file
+std::ofstream ofs("tree.bin", std::ios::binary);
+bgi::write_flat(ofs, tree);
+ofs.close();
+
+// map the file into memory and query it
+namespace bip = boost::interprocess;
+bip::file_mapping file("tree.bin", bip::read_only);
+bip::mapped_region region(file, bip::read_only);
+bgi::flat_rtree_view<value_t> view(region.get_address(), region.get_size());
+view.query(bgi::intersects(box), std::back_inserter(result));
+\endverbatim
+
+\tparam Value           The type of objects stored in the view, it has to be trivially copy constructible and destructible.
+\tparam IndexableGetter The function object extracting Indexable from Value.
+\tparam Strategy        The strategy used in the queries.
+*/
+template
+<
+    typename Value,
+    typename IndexableGetter = index::indexable<Value>,
+    typename Strategy = default_strategy
+>
+class flat_rtree_view
+{
+    BOOST_GEOMETRY_STATIC_ASSERT((index::detail::rtree::flat::is_storable<Value>::value),
+        "Value has to be trivially copy constructible and destructible to be stored in the flat layout.",
+        Value);
+
+public:
+    /*! \brief The type of Value stored in the view. */
+    typedef Value value_type;
+    /*! \brief The function object extracting Indexable from Value. */
+    typedef IndexableGetter indexable_getter;
+    /*! \brief The strategy used in the queries. */
+    typedef Strategy strategy_type;
+
+    /*! \brief The Indexable type to which Value is translated. */
+    typedef typename index::detail::indexable_type<IndexableGetter>::type indexable_type;
+
+    /*! \brief The Box type used by the view. */
+    typedef geometry::model::box<
+                geometry::model::point<
+                    typename coordinate_type<indexable_type>::type,
+                    dimension<indexable_type>::value,
+                    typename coordinate_system<indexable_type>::type
+                >
+            >
+    bounds_type;
+
+    /*! \brief Type of reference to const Value. */
+    typedef Value const& const_reference;
+    /*! \brief Type of pointer to const Value. */
+    typedef Value const* const_pointer;
+    /*! \brief Type of difference type. */
+    typedef std::ptrdiff_t difference_type;
+    /*! \brief Unsigned integral type used by the view. */
+    typedef std::size_t size_type;
+
+private:
+    typedef index::detail::rtree::flat::members
+        <
+            Value, bounds_type, IndexableGetter, Strategy
+        > members_type;
+
+    template <typename Predicates>
+    using query_iterator_t = index::detail::rtree::flat::query_iterator
+        <
+            std::conditional_t
+                <
+                    index::detail::predicates_count_distance<Predicates>::value == 0,
+                    index::detail::rtree::flat::spatial_query_incremental<members_type, Predicates>,
+                    index::detail::rtree::flat::distance_query_incremental<members_type, Predicates>
+                >,
+            Value,
+            flat_rtree_view
+        >;
+
+public:
+    /*! \brief Type of const query iterator, category ForwardIterator. */
+    typedef index::detail::rtree::iterators::query_iterator
+        <
+            value_type, flat_rtree_view
+        > const_query_iterator;
+
+    /*!
+    \brief The constructor.
+
+    \param data     The pointer to the data written by write_flat(), aligned to 16 bytes.
+    \param size     The size of the data in bytes.
+    \param getter   The function object extracting Indexable from Value.
+    \param strategy The strategy used in the queries.
+
+    \par Throws
+    std::invalid_argument if the data is not valid or was written for different types.
+    The header and the ranges of children and values of all nodes are checked,
+    the boxes and the values are not.
+    */
+    flat_rtree_view(void const* data, std::size_t size,
+                    indexable_getter const& getter = indexable_getter(),
+                    strategy_type const& strategy = strategy_type())
+        : m_members(getter, strategy)
+    {
+        namespace flat = index::detail::rtree::flat;
+
+        flat::header const& h = flat::check_header<bounds_type, Value>(data, size);
+        flat::check_nodes(h, data);
+        const char * bytes = static_cast<const char *>(data);
+        m_members.nodes = reinterpret_cast<flat::node const*>(bytes + h.nodes_offset);
+        m_members.coordinates = reinterpret_cast<typename members_type::coordinate_type const*>(bytes + h.boxes_offset);
+        m_members.codes = bytes + h.codes_offset;
+        m_members.values = reinterpret_cast<Value const*>(bytes + h.values_offset);
+        m_members.nodes_count = static_cast<size_type>(h.nodes_count);
+        m_members.values_count = static_cast<size_type>(h.values_count);
+        m_members.leafs_level = static_cast<size_type>(h.leafs_level);
+        m_members.quantization_bits = h.quantization_bits;
+    }
+
+    /*!
+    \brief Finds values meeting passed predicates e.g. nearest to some Point and/or intersecting some Box.
+
+    The same predicates as in rtree::query() are supported.
+
+    \param predicates   Predicates.
+    \param out_it       The output iterator, e.g. generated by std::back_inserter().
+
+    \return             The number of values found.
+    */
+    template <typename Predicates, typename OutIter>
+    size_type query(Predicates const& predicates, OutIter out_it) const
+    {
+        return query_dispatch(predicates, out_it);
+    }
+
+    /*!
+    \brief Returns a query iterator pointing at the begin of the query range.
+
+    \param predicates   Predicates.
+
+    \return             The iterator pointing at the begin of the query range.
+    */
+    template <typename Predicates>
+    const_query_iterator qbegin(Predicates const& predicates) const
+    {
+        return const_query_iterator(qbegin_(predicates));
+    }
+
+    /*!
+    \brief Returns a query iterator pointing at the end of the query range.
+
+    \return             The iterator pointing at the end of the query range.
+    */
+    const_query_iterator qend() const
+    {
+        return const_query_iterator();
+    }
+
+    /*!
+    \brief Returns the number of stored values.
+    */
+    size_type size() const
+    {
+        return m_members.values_count;
+    }
+
+    /*!
+    \brief Query if the view is empty.
+    */
+    bool empty() const
+    {
+        return 0 == m_members.values_count;
+    }
+
+    /*!
+    \brief Returns the box able to contain all values stored in the view.
+
+    If the view is empty the result of geometry::assign_inverse() is returned.
+    */
+    bounds_type bounds() const
+    {
+        bounds_type result;
+        if (m_members.nodes_count > 0)
+        {
+            result = m_members.root_box();
+        }
+        else
+        {
+            geometry::assign_inverse(result);
+        }
+        return result;
+    }
+
+    /*!
+    \brief Returns the function object extracting Indexable from Value.
+    */
+    indexable_getter indexable_get() const
+    {
+        return m_members.getter;
+    }
+
+private:
+    template <typename Predicates>
+    query_iterator_t<Predicates> qbegin_(Predicates const& predicates) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT((index::detail::predicates_count_distance<Predicates>::value <= 1),
+            "Only one distance predicate can be passed.",
+            Predicates);
+
+        return query_iterator_t<Predicates>(m_members, predicates);
+    }
+
+    template
+    <
+        typename Predicates, typename OutIter,
+        std::enable_if_t<(index::detail::predicates_count_distance<Predicates>::value == 0), int> = 0
+    >
+    size_type query_dispatch(Predicates const& predicates, OutIter out_it) const
+    {
+        index::detail::rtree::flat::spatial_query<members_type, Predicates, OutIter>
+            query(m_members, predicates, out_it);
+        return query.apply();
+    }
+
+    template
+    <
+        typename Predicates, typename OutIter,
+        std::enable_if_t<(index::detail::predicates_count_distance<Predicates>::value > 0), int> = 0
+    >
+    size_type query_dispatch(Predicates const& predicates, OutIter out_it) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT((index::detail::predicates_count_distance<Predicates>::value == 1),
+            "Only one distance predicate can be passed.",
+            Predicates);
+
+        index::detail::rtree::flat::distance_query<members_type, Predicates>
+            query(m_members, predicates);
+        return query.apply(out_it);
+    }
+
+    members_type m_members;
+};
+
+/*!
+\brief Writes the rtree in the flat layout which may be used by flat_rtree_view.
+
+The nodes are stored level by level. Values are copied as raw bytes so Value
+has to be trivially copy constructible and destructible.
+
+\ingroup rtree_functions
+
+\param os                 The output stream, it should be opened in binary mode.
+\param tree               The spatial index.
+\param quantization_bits  The number of bits of the quantized coordinates of the
+                          boxes of the nodes, 8 or 16, or 0 if the boxes are not quantized.
+
+\return         The number of bytes written.
+
+\par Throws
+std::invalid_argument if quantization_bits is not 0, 8 nor 16.
+*/
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator>
+inline std::uint64_t write_flat(std::ostream & os,
+                                rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> const& tree,
+                                std::uint32_t quantization_bits = 0)
+{
+    return index::detail::rtree::flat::write(os, tree, quantization_bits);
+}
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_FLAT_RTREE_VIEW_HPP
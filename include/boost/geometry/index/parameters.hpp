@@ -150,12 +150,29 @@ struct rstar
     static size_t get_overlap_cost_threshold() { return OverlapCostThreshold; }
 };
 
-//template <size_t MaxElements, size_t MinElements>
-//struct kmeans
-//{
-//    static const size_t max_elements = MaxElements;
-//    static const size_t min_elements = MinElements;
-//};
+/*!
+\brief K-means r-tree creation algorithm parameters.
+
+The elements of an overflowing node are divided into two clusters of the
+centers of their bounding boxes with the 2-means algorithm.
+
+\tparam MaxElements     Maximum number of elements in nodes.
+\tparam MinElements     Minimum number of elements in nodes. Default: 0.3*Max.
+*/
+template <size_t MaxElements,
+          size_t MinElements = detail::default_min_elements_s<MaxElements>::value>
+struct kmeans
+{
+    BOOST_GEOMETRY_STATIC_ASSERT((0 < MinElements && 2*MinElements <= MaxElements+1),
+        "Invalid MaxElements or MinElements.",
+        std::integer_sequence<size_t, MaxElements, MinElements>);
+
+    static const size_t max_elements = MaxElements;
+    static const size_t min_elements = MinElements;
+
+    static size_t get_max_elements() { return MaxElements; }
+    static size_t get_min_elements() { return MinElements; }
+};
 
 /*!
 \brief Linear r-tree creation algorithm parameters - run-time version.
@@ -215,6 +232,35 @@ private:
     size_t m_min_elements;
 };
 
+/*!
+\brief K-means r-tree creation algorithm parameters - run-time version.
+*/
+class dynamic_kmeans
+{
+public:
+    /*!
+    \brief The constructor.
+
+    \param max_elements     Maximum number of elements in nodes.
+    \param min_elements     Minimum number of elements in nodes. Default: 0.3*Max.
+    */
+    explicit dynamic_kmeans(size_t max_elements,
+                            size_t min_elements = detail::default_min_elements_d())
+        : m_max_elements(max_elements)
+        , m_min_elements(detail::default_min_elements_d_calc(max_elements, min_elements))
+    {
+        if (!(0 < m_min_elements && 2*m_min_elements <= m_max_elements+1))
+            detail::throw_invalid_argument("invalid min or/and max parameters of dynamic_kmeans");
+    }
+
+    size_t get_max_elements() const { return m_max_elements; }
+    size_t get_min_elements() const { return m_min_elements; }
+
+private:
+    size_t m_max_elements;
+    size_t m_min_elements;
+};
+
 /*!
 \brief R*-tree creation algorithm parameters - run-time version.
 */
@@ -261,6 +307,86 @@ private:
 };
 
 
+/*!
+\brief The algorithm used to order the values when the rtree is packed.
+*/
+enum packing_algorithm
+{
+    /*!
+    The values are split recursively into halves along the longest edge of
+    the bounding box (the default).
+    */
+    packing_default,
+    /*!
+    Sort-Tile-Recursive. The children of each node are tiled into slabs
+    sorted by consecutive coordinates.
+    */
+    packing_str,
+    /*!
+    The values are sorted by the Hilbert curve index of their centroids.
+    */
+    packing_hilbert
+};
+
+
+/*!
+\brief R-tree packing algorithm parameters.
+
+These parameters may be passed to the packing constructors of the rtree.
+
+\par Algorithm
+All of the algorithms guarantee that the number of elements in the nodes is
+between Min and Max and that the nodes are packed as tightly as possible.
+They differ in the order of values and therefore in the overlap of nodes.
+Which one results in fewer visited nodes depends on the data and the queries,
+index/example/benchmark_pack.cpp may be used to compare them.
+
+\par Threads
+If the number of threads is greater than 1 the independent subtrees are
+created in parallel. The resulting tree is the same as the one created
+sequentially. In this case the rtree allocator must be safe to use
+concurrently from several threads.
+*/
+class packing_parameters
+{
+public:
+    /*!
+    \brief The constructor.
+
+    \param threads      The maximum number of threads used to create the tree.
+                        If 0 the number of threads is equal to the hardware
+                        concurrency. Default: 1.
+    \param algorithm    The algorithm used to order the values.
+                        Default: packing_default.
+    */
+    explicit packing_parameters(size_t threads = 1,
+                                packing_algorithm algorithm = packing_default)
+        : m_threads(threads)
+        , m_algorithm(algorithm)
+    {}
+
+    /*!
+    \brief The constructor.
+
+    \param algorithm    The algorithm used to order the values.
+    \param threads      The maximum number of threads used to create the tree.
+                        If 0 the number of threads is equal to the hardware
+                        concurrency. Default: 1.
+    */
+    explicit packing_parameters(packing_algorithm algorithm, size_t threads = 1)
+        : m_threads(threads)
+        , m_algorithm(algorithm)
+    {}
+
+    size_t get_threads() const { return m_threads; }
+    packing_algorithm get_algorithm() const { return m_algorithm; }
+
+private:
+    size_t m_threads;
+    packing_algorithm m_algorithm;
+};
+
+
 template <typename Parameters, typename Strategy>
 class parameters
     : public Parameters
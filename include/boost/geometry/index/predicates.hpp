@@ -381,6 +381,53 @@ path(SegmentOrLinestring const& linestring, std::size_t k)
 
 #endif // BOOST_GEOMETRY_INDEX_DETAIL_EXPERIMENTAL_PREDICATES
 
+/*!
+\brief Generate \c join_intersects() predicate.
+
+Generate a predicate defining the relationship of Values of two rtrees. With this
+predicate join returns pairs of Values which Indexables intersect.
+The pair is returned by the join if <tt>bg::intersects(Indexable1, Indexable2)</tt>
+returns <tt>true</tt>.
+
+\par Example
+\verbatim
+bgi::join(rtree1, rtree2, bgi::join_intersects(), std::back_inserter(result));
+\endverbatim
+
+\ingroup predicates
+*/
+inline detail::predicates::join_intersects
+join_intersects()
+{
+    return detail::predicates::join_intersects();
+}
+
+/*!
+\brief Generate \c join_within_distance() predicate.
+
+Generate a predicate defining the relationship of Values of two rtrees. With this
+predicate join returns pairs of Values which Indexables are not further from
+each other than the distance passed.
+The pair is returned by the join if <tt>bg::distance(Indexable1, Indexable2) <= distance</tt>.
+
+\par Example
+\verbatim
+bgi::join(rtree1, rtree2, bgi::join_within_distance(10.0), std::back_inserter(result));
+\endverbatim
+
+\ingroup predicates
+
+\tparam T           The type of the distance.
+
+\param distance     The maximum distance.
+*/
+template <typename T> inline
+detail::predicates::join_within_distance<T>
+join_within_distance(T const& distance)
+{
+    return detail::predicates::join_within_distance<T>(distance);
+}
+
 namespace detail { namespace predicates {
 
 // operator! generators
@@ -19,7 +19,11 @@
 
 // STD
 #include <algorithm>
+#include <iterator>
+#include <memory>
+#include <numeric>
 #include <type_traits>
+#include <vector>
 
 // Boost
 #include <boost/container/new_allocator.hpp>
@@ -68,6 +72,7 @@
 #include <boost/geometry/index/detail/rtree/visitors/insert.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/iterator.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/remove.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/update.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/copy.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/destroy.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/spatial_query.hpp>
@@ -78,9 +83,12 @@
 #include <boost/geometry/index/detail/rtree/linear/linear.hpp>
 #include <boost/geometry/index/detail/rtree/quadratic/quadratic.hpp>
 #include <boost/geometry/index/detail/rtree/rstar/rstar.hpp>
-//#include <boost/geometry/extensions/index/detail/rtree/kmeans/kmeans.hpp>
+#include <boost/geometry/index/detail/rtree/kmeans/kmeans.hpp>
 
 #include <boost/geometry/index/detail/rtree/pack_create.hpp>
+#include <boost/geometry/index/detail/rtree/query_batch.hpp>
+#include <boost/geometry/index/detail/rtree/join.hpp>
+#include <boost/geometry/index/detail/rtree/snapshot.hpp>
 
 #include <boost/geometry/index/inserter.hpp>
 
@@ -128,13 +136,15 @@ algorithm with specific parameters like min and max number of elements in node.
 Predefined algorithms with compile-time parameters are:
  \li <tt>boost::geometry::index::linear</tt>,
  \li <tt>boost::geometry::index::quadratic</tt>,
- \li <tt>boost::geometry::index::rstar</tt>.
+ \li <tt>boost::geometry::index::rstar</tt>,
+ \li <tt>boost::geometry::index::kmeans</tt>.
 
 \par
 Predefined algorithms with run-time parameters are:
  \li \c boost::geometry::index::dynamic_linear,
  \li \c boost::geometry::index::dynamic_quadratic,
- \li \c boost::geometry::index::dynamic_rstar.
+ \li \c boost::geometry::index::dynamic_rstar,
+ \li \c boost::geometry::index::dynamic_kmeans.
 
 \par IndexableGetter
 An object of IndexableGetter type translates from Value to Indexable each time
@@ -319,6 +329,10 @@ private:
     typedef typename members_holder::allocator_traits_type allocator_traits_type;
 
     friend class detail::rtree::utilities::view<rtree>;
+    friend class detail::rtree::snapshot::access<rtree>;
+
+    template <typename V, typename P, typename I, typename E, typename A>
+    friend class rtree;
 #ifdef BOOST_GEOMETRY_INDEX_DETAIL_EXPERIMENTAL_SERIALIZATION
     friend class detail::rtree::private_view<rtree>;
     friend class detail::rtree::const_private_view<rtree>;
@@ -504,6 +518,65 @@ public:
     /*!
     \brief The constructor.
 
+    The tree is created using packing algorithm with parameters of the packing algorithm.
+
+    \param first        The beginning of the range of Values.
+    \param last         The end of the range of Values.
+    \param packing      The parameters of the packing algorithm, e.g. the algorithm or the number of threads.
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    */
+    template<typename Iterator>
+    inline rtree(Iterator first, Iterator last,
+                 packing_parameters const& packing,
+                 parameters_type const& parameters = parameters_type(),
+                 indexable_getter const& getter = indexable_getter(),
+                 value_equal const& equal = value_equal(),
+                 allocator_type const& allocator = allocator_type())
+        : m_members(getter, equal, parameters, allocator)
+    {
+        pack_construct(first, last, boost::container::new_allocator<void>(), packing);
+    }
+
+    /*!
+    \brief The constructor.
+
+    The tree is created using packing algorithm with parameters of the packing algorithm.
+
+    \param rng          The range of Values.
+    \param packing      The parameters of the packing algorithm, e.g. the algorithm or the number of threads.
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    */
+    template<typename Range>
+    inline rtree(Range const& rng,
+                 packing_parameters const& packing,
+                 parameters_type const& parameters = parameters_type(),
+                 indexable_getter const& getter = indexable_getter(),
+                 value_equal const& equal = value_equal(),
+                 allocator_type const& allocator = allocator_type())
+        : m_members(getter, equal, parameters, allocator)
+    {
+        pack_construct(::boost::begin(rng), ::boost::end(rng), boost::container::new_allocator<void>(), packing);
+    }
+
+    /*!
+    \brief The constructor.
+
     The tree is created using packing algorithm and a temporary packing allocator.
 
     \param first        The beginning of the range of Values.
@@ -995,6 +1068,72 @@ public:
         return this->remove_dispatch(conv_or_rng, is_conv_t());
     }
 
+    /*!
+    \brief Replace a range of values with new values in one traversal.
+
+    The range contains pairs of the old and the new values, e.g.
+    <tt>std::pair<value_type, value_type></tt>. The old values are searched for
+    in one traversal of the tree for the whole batch. If a new value is covered
+    by the box of the leaf storing the old value it replaces the old value in
+    place. Otherwise the old value is removed and the new value is inserted
+    after all old values are processed. The boxes of nodes are updated and
+    underflowed nodes are handled once per node for the whole batch.
+    Similarly to the remove() only one value is replaced for each pair.
+    The new values of pairs which old values are not stored are not inserted.
+
+    \param first    The beginning of the range of pairs of values.
+    \param last     The end of the range of pairs of values.
+
+    \return         The number of replaced values.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \warning
+    This operation only guarantees that there will be no memory leaks.
+    After an exception is thrown the R-tree may be left in an inconsistent state,
+    elements must not be inserted or removed. Other operations are allowed however
+    some of them may return invalid data.
+    */
+    template <typename Iterator>
+    inline size_type update(Iterator first, Iterator last)
+    {
+        typedef detail::rtree::visitors::update<members_holder> update_v_type;
+
+        BOOST_GEOMETRY_STATIC_ASSERT(
+            (std::is_reference<typename std::iterator_traits<Iterator>::reference>::value),
+            "The Iterator has to reference the pairs of values stored in the range.",
+            Iterator);
+
+        if ( !m_members.root )
+            return 0;
+
+        typename update_v_type::items_type items;
+        for ( ; first != last ; ++first )
+            items.push_back(std::make_pair(std::addressof((*first).first),
+                                           std::addressof((*first).second)));
+
+        if ( items.empty() )
+            return 0;
+
+        update_v_type update_v(m_members.root, m_members.leafs_level, items,
+                               m_members.parameters(), m_members.translator(), m_members.allocators());
+
+        detail::rtree::apply_visitor(update_v, *m_members.root);
+
+        // If exception is thrown, m_values_count may be invalid
+        m_members.values_count -= update_v.relocated().size();
+
+        if ( !m_members.root )
+            this->raw_create();
+
+        for ( std::size_t i : update_v.relocated() )
+            this->raw_insert(*items[i].second);
+
+        return update_v.updated_count();
+    }
+
     /*!
     \brief Finds values meeting passed predicates e.g. nearest to some Point and/or intersecting some Box.
 
@@ -1091,6 +1230,146 @@ public:
              : 0;
     }
 
+    /*!
+    \brief Finds values meeting each of the predicates from the range of predicates.
+
+    This method performs one query for each element of the range of predicates
+    and stores the values found for the i-th element of this range in the i-th
+    container of the range of results. For the information about predicates
+    which may be passed to this method see query().
+
+    The queries are performed in the order of the locations of their geometries
+    (Z-order) rather than in the order of the range so consecutive queries
+    traverse the same nodes. Optionally the queries may be performed in parallel,
+    consecutive blocks of queries are then distributed among the threads.
+
+    \par Example
+    \verbatim
+    std::vector<decltype(bgi::intersects(box))> predicates;
+    // fill predicates
+    std::vector<std::vector<value_type>> results(predicates.size());
+    // results[i] contains values intersecting the i-th box
+    tree.query_batch(predicates, results);
+    // or using 4 threads
+    tree.query_batch(predicates, results, 4);
+    \endverbatim
+
+    \par Throws
+    If Value copy constructor or copy assignment throws.
+    If predicates copy throws.
+    If allocation throws.
+    std::invalid_argument if the range of results is smaller than the range of predicates.
+
+    \warning
+    If more than one thread is used the containers of results have to be distinct
+    objects and the function objects passed in satisfies() predicates are called
+    concurrently.
+
+    \param predicates   The random access range of predicates.
+    \param results      The random access range of containers supporting push_back(),
+                        values found for each predicate are added at the end of the container.
+    \param threads      The maximum number of threads, 0 means the hardware concurrency.
+
+    \return             The number of values found by all queries.
+    */
+    template <typename PredicatesRange, typename ResultsRange>
+    size_type query_batch(PredicatesRange const& predicates, ResultsRange & results,
+                          size_type threads = 1) const
+    {
+        size_type const count = boost::size(predicates);
+        if ( size_type(boost::size(results)) < count )
+        {
+            detail::throw_invalid_argument("the range of results is smaller than the range of predicates");
+        }
+
+        if ( !m_members.root || count == 0 )
+        {
+            return 0;
+        }
+
+        std::vector<std::size_t> order;
+        detail::rtree::query_batch::spatial_order(boost::begin(predicates), count,
+                                                  this->bounds(), order);
+
+        auto const predicates_first = boost::begin(predicates);
+        auto const results_first = boost::begin(results);
+
+        static const size_type block_size = 64;
+        size_type const blocks = (count + block_size - 1) / block_size;
+        std::vector<size_type> found(blocks, 0);
+
+        geometry::detail::parallel::for_each_index(blocks,
+            geometry::detail::parallel::threads_count(threads),
+            [&](std::size_t b)
+            {
+                size_type const last = (std::min)(count, (b + 1) * block_size);
+                for ( size_type i = b * block_size ; i < last ; ++i )
+                {
+                    std::size_t const q = order[i];
+                    found[b] += query_dispatch(*(predicates_first + q),
+                                               std::back_inserter(*(results_first + q)));
+                }
+            });
+
+        return std::accumulate(found.begin(), found.end(), size_type(0));
+    }
+
+    /*!
+    \brief Finds pairs of values of this rtree and other rtree meeting the predicate.
+
+    Both rtrees are traversed at the same time, the pairs of nodes which boxes
+    don't meet the predicate are skipped together with their children. So the
+    join is faster than querying one rtree for each value of the other one.
+    The pairs of values meeting the predicate are stored as std::pair of values
+    of this and the other rtree. Optionally the traversal may be performed in
+    parallel, the pairs of nodes at the top levels of the rtrees are then
+    distributed among the threads. The pairs of values are returned in
+    the same order regardless of the number of threads.
+
+    <b>Join predicates</b>
+
+    \li \c join_intersects() - pairs of values which indexables intersect,
+    \li \c join_within_distance() - pairs of values which indexables are not
+        further from each other than the distance passed.
+
+    The strategy of this rtree is used to check the predicate.
+
+    \par Example
+    \verbatim
+    std::vector<std::pair<value_type, other_value_type>> result;
+    tree.join(other_tree, bgi::join_intersects(), std::back_inserter(result));
+    tree.join(other_tree, bgi::join_within_distance(10.0), std::back_inserter(result));
+    // or using 4 threads
+    tree.join(other_tree, bgi::join_intersects(), std::back_inserter(result), 4);
+    \endverbatim
+
+    \par Throws
+    If Value copy constructor or copy assignment throws.
+    If allocation throws.
+
+    \param other        The other rtree.
+    \param predicate    The join predicate.
+    \param out_it       The output iterator of std::pair of values, e.g. generated by std::back_inserter().
+    \param threads      The maximum number of threads, 0 means the hardware concurrency.
+
+    \return             The number of pairs found.
+    */
+    template <typename V, typename P, typename I, typename E, typename A,
+              typename JoinPredicate, typename OutIter>
+    size_type join(rtree<V, P, I, E, A> const& other, JoinPredicate const& predicate,
+                   OutIter out_it, size_type threads = 1) const
+    {
+        if ( !m_members.root || !other.m_members.root )
+        {
+            return 0;
+        }
+
+        return detail::rtree::join::apply(m_members, this->bounds(),
+                                          other.m_members, other.bounds(),
+                                          predicate, out_it,
+                                          geometry::detail::parallel::threads_count(threads));
+    }
+
     /*!
     \brief Returns a query iterator pointing at the begin of the query range.
 
@@ -1923,6 +2202,7 @@ private:
     \param first             The beginning of the range of Values.
     \param last              The end of the range of Values.
     \param temp_allocator    The temporary allocator object to be used by the packing algorithm.
+    \param packing           The parameters of the packing algorithm.
 
     \par Throws
     \li If allocator copy constructor throws.
@@ -1930,13 +2210,14 @@ private:
     \li If allocation throws or returns invalid value.
     */
     template<typename Iterator, typename PackAlloc>
-    inline void pack_construct(Iterator first, Iterator last, PackAlloc const& temp_allocator)
+    inline void pack_construct(Iterator first, Iterator last, PackAlloc const& temp_allocator,
+                               packing_parameters const& packing = packing_parameters())
     {
         typedef detail::rtree::pack<members_holder> pack;
         size_type vc = 0, ll = 0;
         m_members.root = pack::apply(first, last, vc, ll,
                                      m_members.parameters(), m_members.translator(),
-                                     m_members.allocators(), temp_allocator);
+                                     m_members.allocators(), temp_allocator, packing);
         m_members.values_count = vc;
         m_members.leafs_level = ll;
     }
@@ -2074,6 +2355,28 @@ remove(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> & tree,
     return tree.remove(conv_or_rng);
 }
 
+/*!
+\brief Replace a range of values with new values in one traversal.
+
+It calls <tt>rtree::update(Iterator, Iterator)</tt>.
+
+\ingroup rtree_functions
+
+\param tree     The spatial index.
+\param first    The beginning of the range of pairs of the old and the new values.
+\param last     The end of the range of pairs of the old and the new values.
+
+\return         The number of replaced values.
+*/
+template<typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator,
+         typename Iterator>
+inline typename rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator>::size_type
+update(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> & tree,
+       Iterator first, Iterator last)
+{
+    return tree.update(first, last);
+}
+
 /*!
 \brief Finds values meeting passed predicates e.g. nearest to some Point and/or intersecting some Box.
 
@@ -2157,6 +2460,44 @@ query(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> const& tree,
     return tree.query(predicates, out_it);
 }
 
+/*!
+\brief Finds pairs of values of two rtrees meeting the predicate.
+
+It calls \c rtree::join(rtree const&, JoinPredicate const&, OutIter, size_type).
+
+\par Example
+\verbatim
+std::vector<std::pair<value1_type, value2_type>> result;
+bgi::join(tree1, tree2, bgi::join_intersects(), std::back_inserter(result));
+\endverbatim
+
+\par Throws
+If Value copy constructor or copy assignment throws.
+If allocation throws.
+
+\ingroup rtree_functions
+
+\param tree1        The first rtree.
+\param tree2        The second rtree.
+\param predicate    The join predicate.
+\param out_it       The output iterator of std::pair of values, e.g. generated by std::back_inserter().
+\param threads      The maximum number of threads, 0 means the hardware concurrency.
+
+\return             The number of pairs found.
+*/
+template <typename Value1, typename Parameters1, typename IndexableGetter1, typename EqualTo1, typename Allocator1,
+          typename Value2, typename Parameters2, typename IndexableGetter2, typename EqualTo2, typename Allocator2,
+          typename JoinPredicate, typename OutIter> inline
+typename rtree<Value1, Parameters1, IndexableGetter1, EqualTo1, Allocator1>::size_type
+join(rtree<Value1, Parameters1, IndexableGetter1, EqualTo1, Allocator1> const& tree1,
+     rtree<Value2, Parameters2, IndexableGetter2, EqualTo2, Allocator2> const& tree2,
+     JoinPredicate const& predicate,
+     OutIter out_it,
+     typename rtree<Value1, Parameters1, IndexableGetter1, EqualTo1, Allocator1>::size_type threads = 1)
+{
+    return tree1.join(tree2, predicate, out_it, threads);
+}
+
 /*!
 \brief Returns the query iterator pointing at the begin of the query range.
 
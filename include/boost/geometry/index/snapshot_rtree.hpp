@@ -0,0 +1,374 @@
+// Boost.Geometry Index
+//
+// R-tree with snapshot isolation of concurrent readers
+//
+// Copyright (c) 2026 Boost.Geometry contributors.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_SNAPSHOT_RTREE_HPP
+#define BOOST_GEOMETRY_INDEX_SNAPSHOT_RTREE_HPP
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/index/rtree.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+/*!
+\brief The R-tree which may be queried concurrently with modifications.
+
+Readers take an immutable snapshot of the R-tree which is not affected by
+subsequent modifications and query it as a regular <tt>rtree const</tt>.
+Taking a snapshot doesn't wait for writers.
+
+Each modification creates a new version of the R-tree. Nodes on the paths
+from the root to the modified leafs are copied and the rest of the nodes are
+shared with the previous version. The new version is published atomically
+after the modification is done. The nodes which are no longer used are
+destroyed when all snapshots of the versions using them are released.
+Modifications are serialized.
+
+The default insertion algorithm is used for all balancing algorithms, i.e.
+for the R*-tree the forced reinsertion is not performed. The Allocator
+objects must compare equal because nodes are destroyed by different
+versions than the ones which created them.
+
+\tparam Value           The type of objects stored in the container.
+\tparam Parameters      Compile-time parameters.
+\tparam IndexableGetter The function object extracting Indexable from Value.
+\tparam EqualTo         The function object comparing objects of type Value.
+\tparam Allocator       The allocator used to allocate/deallocate memory,
+                        construct/destroy nodes and Values.
+*/
+template
+<
+    typename Value,
+    typename Parameters,
+    typename IndexableGetter = index::indexable<Value>,
+    typename EqualTo = index::equal_to<Value>,
+    typename Allocator = boost::container::new_allocator<Value>
+>
+class snapshot_rtree
+{
+public:
+    /*! \brief The type of the R-tree accessed through snapshots. */
+    typedef index::rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> rtree_type;
+    /*! \brief The type of the immutable snapshot of the R-tree. */
+    typedef std::shared_ptr<rtree_type const> snapshot_type;
+
+    /*! \brief The type of Value stored in the container. */
+    typedef typename rtree_type::value_type value_type;
+    /*! \brief R-tree parameters type. */
+    typedef typename rtree_type::parameters_type parameters_type;
+    /*! \brief The function object extracting Indexable from Value. */
+    typedef typename rtree_type::indexable_getter indexable_getter;
+    /*! \brief The function object comparing objects of type Value. */
+    typedef typename rtree_type::value_equal value_equal;
+    /*! \brief The type of allocator used by the container. */
+    typedef typename rtree_type::allocator_type allocator_type;
+    /*! \brief Unsigned integral type used by the container. */
+    typedef typename rtree_type::size_type size_type;
+
+private:
+    typedef detail::rtree::snapshot::access<rtree_type> access;
+    typedef typename access::members_holder members_holder;
+    typedef detail::rtree::snapshot::writer<members_holder> writer_type;
+    typedef typename members_holder::node_pointer node_pointer;
+
+    // The version of the rtree. It keeps the newer version alive because
+    // the nodes replaced in the newer version are destroyed by this one.
+    struct version
+    {
+        version(parameters_type const& parameters, indexable_getter const& getter,
+                value_equal const& equal, allocator_type const& allocator)
+            : tree(parameters, getter, equal, allocator)
+            , shares_nodes(false)
+        {}
+
+        ~version()
+        {
+            if (shares_nodes)
+            {
+                members_holder & members = access::members(tree);
+                for (node_pointer n : replaced)
+                {
+                    detail::rtree::snapshot::destroy_node<members_holder>(n, members.allocators());
+                }
+                members.root = 0;
+            }
+
+            // release the chain of unused versions iteratively
+            std::shared_ptr<version> next = std::move(newer);
+            while (next && next.use_count() == 1)
+            {
+                std::shared_ptr<version> after = std::move(next->newer);
+                next.reset();
+                next = std::move(after);
+            }
+        }
+
+        rtree_type tree;
+        std::vector<node_pointer> replaced;
+        bool shares_nodes;
+        std::shared_ptr<version> newer;
+    };
+
+public:
+    /*!
+    \brief The constructor.
+
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    If allocator default constructor throws.
+    */
+    inline explicit snapshot_rtree(parameters_type const& parameters = parameters_type(),
+                                   indexable_getter const& getter = indexable_getter(),
+                                   value_equal const& equal = value_equal(),
+                                   allocator_type const& allocator = allocator_type())
+        : m_head(std::make_shared<version>(parameters, getter, equal, allocator))
+    {}
+
+    snapshot_rtree(snapshot_rtree const&) = delete;
+    snapshot_rtree & operator=(snapshot_rtree const&) = delete;
+
+    /*!
+    \brief Returns the snapshot of the current version of the R-tree.
+
+    The snapshot may be queried concurrently with modifications of this
+    container. It's not affected by modifications done after it was taken.
+
+    \return     The snapshot.
+
+    \par Throws
+    Nothing.
+    */
+    inline snapshot_type snapshot() const
+    {
+        std::shared_ptr<version> const head = this->load();
+        return snapshot_type(head, &head->tree);
+    }
+
+    /*!
+    \brief Insert a value to the index and publish the new version.
+
+    \param value    The value which will be stored in the container.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    The current version is not modified if an exception is thrown.
+    */
+    inline void insert(value_type const& value)
+    {
+        this->modify([&](writer_type & w)
+        {
+            w.insert(value);
+        });
+    }
+
+    /*!
+    \brief Insert a range of values to the index and publish the new version.
+
+    \param first    The beginning of the range of values.
+    \param last     The end of the range of values.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    The current version is not modified if an exception is thrown.
+    */
+    template <typename Iterator>
+    inline void insert(Iterator first, Iterator last)
+    {
+        this->modify([&](writer_type & w)
+        {
+            for ( ; first != last ; ++first)
+            {
+                w.insert(*first);
+            }
+        });
+    }
+
+    /*!
+    \brief Remove a value from the container and publish the new version.
+
+    \param value    The value which will be removed from the container.
+
+    \return         1 if the value was removed, 0 otherwise.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    The current version is not modified if an exception is thrown.
+    */
+    inline size_type remove(value_type const& value)
+    {
+        size_type result = 0;
+        this->modify([&](writer_type & w)
+        {
+            result = w.remove(value);
+        });
+        return result;
+    }
+
+    /*!
+    \brief Remove a range of values from the container and publish the new version.
+
+    \param first    The beginning of the range of values.
+    \param last     The end of the range of values.
+
+    \return         The number of removed values.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    The current version is not modified if an exception is thrown.
+    */
+    template <typename Iterator>
+    inline size_type remove(Iterator first, Iterator last)
+    {
+        size_type result = 0;
+        this->modify([&](writer_type & w)
+        {
+            for ( ; first != last ; ++first)
+            {
+                result += w.remove(*first);
+            }
+        });
+        return result;
+    }
+
+    /*!
+    \brief Publish the new empty version.
+
+    \par Throws
+    If allocator copy constructor throws.
+    */
+    inline void clear()
+    {
+        std::lock_guard<std::mutex> lock(m_write_mutex);
+
+        std::shared_ptr<version> const current = this->load();
+        std::shared_ptr<version> next = this->make_version(current->tree);
+
+        // all nodes of the current version are destroyed with it
+        current->newer = next;
+        this->store(std::move(next));
+    }
+
+    /*!
+    \brief Returns the number of stored values in the current version.
+
+    \return     The number of stored values.
+
+    \par Throws
+    Nothing.
+    */
+    inline size_type size() const
+    {
+        return this->load()->tree.size();
+    }
+
+    /*!
+    \brief Query if the current version is empty.
+
+    \return     true if the container is empty.
+
+    \par Throws
+    Nothing.
+    */
+    inline bool empty() const
+    {
+        return this->load()->tree.empty();
+    }
+
+private:
+    static std::shared_ptr<version> make_version(rtree_type const& tree)
+    {
+        return std::make_shared<version>(tree.parameters(), tree.indexable_get(),
+                                         tree.value_eq(), tree.get_allocator());
+    }
+
+    template <typename Modify>
+    void modify(Modify const& modify)
+    {
+        std::lock_guard<std::mutex> lock(m_write_mutex);
+
+        std::shared_ptr<version> const current = this->load();
+        std::shared_ptr<version> next = this->make_version(current->tree);
+
+        members_holder const& current_members = access::members(current->tree);
+        members_holder & next_members = access::members(next->tree);
+        next_members.root = current_members.root;
+        next_members.leafs_level = current_members.leafs_level;
+        next_members.values_count = current_members.values_count;
+
+        writer_type w(next_members);
+
+        BOOST_TRY
+        {
+            modify(w);                                                                      // MAY THROW (V, E: alloc, copy, N: alloc)
+        }
+        BOOST_CATCH(...)
+        {
+            w.rollback();
+            next_members.root = 0;
+            BOOST_RETHROW                                                                   // RETHROW
+        }
+        BOOST_CATCH_END
+
+        if (! w.modified())
+        {
+            next_members.root = 0;
+            return;
+        }
+
+        current->replaced.swap(w.replaced());
+        current->shares_nodes = true;
+        current->newer = next;
+        this->store(std::move(next));
+    }
+
+#ifdef __cpp_lib_atomic_shared_ptr
+    std::shared_ptr<version> load() const
+    {
+        return m_head.load(std::memory_order_acquire);
+    }
+
+    void store(std::shared_ptr<version> && v)
+    {
+        m_head.store(std::move(v), std::memory_order_release);
+    }
+
+    std::atomic<std::shared_ptr<version> > m_head;
+#else
+    std::shared_ptr<version> load() const
+    {
+        return std::atomic_load_explicit(&m_head, std::memory_order_acquire);
+    }
+
+    void store(std::shared_ptr<version> && v)
+    {
+        std::atomic_store_explicit(&m_head, std::move(v), std::memory_order_release);
+    }
+
+    std::shared_ptr<version> m_head;
+#endif
+
+    std::mutex m_write_mutex;
+};
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_SNAPSHOT_RTREE_HPP
@@ -0,0 +1,394 @@
+// Boost.Geometry
+//
+// Copyright (c) 2015 Mats Taraldsvik.
+//
+// This file was modified by Oracle on 2020.
+// Modifications copyright (c) 2020, Oracle and/or its affiliates.
+// Contributed and/or modified by Adam Wulkiewicz, on behalf of Oracle
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_DETAIL_WRITER_HPP
+#define BOOST_GEOMETRY_IO_WKB_DETAIL_WRITER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/static_assert.hpp>
+
+#include <boost/geometry/algorithms/num_interior_rings.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/io/wkb/detail/endian.hpp>
+#include <boost/geometry/io/wkb/detail/ogc.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+    template <typename OutputIterator>
+    inline void copy_bytes(uint8_t const* first, uint8_t const* last,
+                           OutputIterator& iter)
+    {
+        iter = std::copy(first, last, iter);
+    }
+
+    // The bytes are inserted at once into the container of back_inserter
+    template <typename Container>
+    struct back_insert_access
+        : std::back_insert_iterator<Container>
+    {
+        static Container& get(std::back_insert_iterator<Container>& iter)
+        {
+            Container* std::back_insert_iterator<Container>::* const member
+                = &back_insert_access::container;
+            return *(iter.*member);
+        }
+    };
+
+    template <typename Container>
+    inline void copy_bytes(uint8_t const* first, uint8_t const* last,
+                           std::back_insert_iterator<Container>& iter)
+    {
+        Container& container = back_insert_access<Container>::get(iter);
+        container.insert(container.end(), first, last);
+    }
+
+    template <typename T>
+    struct value_writer
+    {
+        typedef T value_type;
+
+        template <typename OutputIterator>
+        static bool write(T const& value,
+                          OutputIterator& iter,
+                          byte_order_type::enum_t byte_order)
+        {
+            endian::endian_value<T> parsed_value(value);
+
+// 				if (byte_order_type::xdr == byte_order)
+// 				{
+// 					parsed_value.template store<endian::big_endian_tag>(iter);
+// 				}
+// 				else if (byte_order_type::ndr == byte_order)
+// 				{
+// 					parsed_value.template store<endian::little_endian_tag>(iter);
+// 				}
+// 				else
+// 				{
+                parsed_value.template store<endian::native_endian_tag>(iter);
+// 				}
+
+            return true;
+        }
+    };
+
+    template
+    <
+        typename Point,
+        std::size_t I = 0,
+        std::size_t N = dimension<Point>::value
+    >
+    struct writer_assigner
+    {
+        template <typename OutputIterator>
+        static void run(Point const& point,
+                        OutputIterator& iter,
+                        byte_order_type::enum_t byte_order)
+        {
+            // NOTE: coordinates of any type are converted to double
+
+            value_writer<double>::write(geometry::get<I>(point),
+                                        iter,
+                                        byte_order);
+
+            writer_assigner<Point, I+1, N>::run(point, iter, byte_order);
+        }
+    };
+
+    template <typename Point, std::size_t N>
+    struct writer_assigner<Point, N, N>
+    {
+        template <typename OutputIterator>
+        static void run(Point const& /*point*/,
+                        OutputIterator& /*iter*/,
+                        byte_order_type::enum_t /*byte_order*/)
+        {
+            // terminate
+        }
+    };
+
+    template <typename Point>
+    struct point_writer
+    {
+        template <typename OutputIterator>
+        static bool write(Point const& point,
+                          OutputIterator& iter,
+                          byte_order_type::enum_t byte_order)
+        {
+            // write endian type
+            value_writer<uint8_t>::write(byte_order, iter, byte_order);
+
+            // write geometry type
+            uint32_t type = geometry_type<Point>::get();
+            value_writer<uint32_t>::write(type, iter, byte_order);
+
+            // write point's x, y, z
+            writer_assigner<Point>::run(point, iter, byte_order);
+
+            return true;
+        }
+    };
+
+    // Writes the number of points and the points of a linestring or a ring.
+    // The values are written in the native byte order so the coordinates
+    // of points in a contiguous container are copied at once if they are
+    // stored the same way as in WKB.
+    template <typename Range>
+    struct point_range_writer
+    {
+        typedef typename point_type<Range>::type point_type;
+
+        template <typename OutputIterator>
+        static void write(Range const& range,
+                          OutputIterator& iter,
+                          byte_order_type::enum_t byte_order)
+        {
+            // write num points
+            uint32_t num_points = boost::size(range);
+            value_writer<uint32_t>::write(num_points, iter, byte_order);
+
+            typedef std::integral_constant
+                <
+                    bool,
+                    is_wkb_layout<point_type>::value
+                 && is_vector<Range>::value
+                > is_bulk;
+
+            write_points(range, iter, byte_order, is_bulk());
+        }
+
+    private :
+        template <typename OutputIterator>
+        static void write_points(Range const& range,
+                                 OutputIterator& iter,
+                                 byte_order_type::enum_t byte_order,
+                                 std::false_type)
+        {
+            for(typename boost::range_iterator<Range const>::type
+                    point_iter = boost::begin(range);
+                point_iter != boost::end(range);
+                ++point_iter)
+            {
+                // write point's x, y, z
+                writer_assigner<point_type>::run(*point_iter, iter, byte_order);
+            }
+        }
+
+        template <typename OutputIterator>
+        static void write_points(Range const& range,
+                                 OutputIterator& iter,
+                                 byte_order_type::enum_t ,
+                                 std::true_type)
+        {
+            if (boost::size(range) > 0)
+            {
+                uint8_t const* const bytes
+                    = reinterpret_cast<uint8_t const*>(range.data());
+                copy_bytes(bytes, bytes + boost::size(range) * sizeof(point_type),
+                           iter);
+            }
+        }
+    };
+
+    template <typename Linestring>
+    struct linestring_writer
+    {
+        template <typename OutputIterator>
+        static bool write(Linestring const& linestring,
+                          OutputIterator& iter,
+                          byte_order_type::enum_t byte_order)
+        {
+            // write endian type
+            value_writer<uint8_t>::write(byte_order, iter, byte_order);
+
+            // write geometry type
+            uint32_t type = geometry_type<Linestring>::get();
+            value_writer<uint32_t>::write(type, iter, byte_order);
+
+            // write num points and points
+            point_range_writer<Linestring>::write(linestring, iter, byte_order);
+
+            return true;
+        }
+    };
+
+    template <typename Polygon>
+    struct polygon_writer
+    {
+        template <typename OutputIterator>
+        static bool write(Polygon const& polygon,
+                          OutputIterator& iter,
+                          byte_order_type::enum_t byte_order)
+        {
+            // write endian type
+            value_writer<uint8_t>::write(byte_order, iter, byte_order);
+
+            // write geometry type
+            uint32_t type = geometry_type<Polygon>::get();
+            value_writer<uint32_t>::write(type, iter, byte_order);
+
+            // write num rings
+            uint32_t num_rings = 1 + geometry::num_interior_rings(polygon);
+            value_writer<uint32_t>::write(num_rings, iter, byte_order);
+
+            // write exterior ring
+            typedef typename geometry::ring_type<Polygon const>::type
+                ring_type;
+
+            point_range_writer<ring_type>::write(geometry::exterior_ring(polygon),
+                                                 iter,
+                                                 byte_order);
+
+            // write interor rings
+            typedef typename geometry::interior_type<Polygon const>::type
+                interior_rings_type;
+
+            typename geometry::interior_return_type<Polygon const>::type
+                interior_rings = geometry::interior_rings(polygon);
+
+            for(typename boost::range_iterator<interior_rings_type const>::type
+                    ring_iter = boost::begin(interior_rings);
+                ring_iter != boost::end(interior_rings);
+                ++ring_iter)
+            {
+                point_range_writer<ring_type>::write(*ring_iter, iter, byte_order);
+            }
+
+            return true;
+        }
+    };
+
+    template <typename MultiPoint>
+    struct multipoint_writer
+    {
+        template <typename OutputIterator>
+        static bool write(MultiPoint const& multipoint,
+                          OutputIterator& iter,
+                          byte_order_type::enum_t byte_order)
+        {
+            // write endian type
+            value_writer<uint8_t>::write(byte_order, iter, byte_order);
+
+            // write geometry type
+            uint32_t type = geometry_type<MultiPoint>::get();
+            value_writer<uint32_t>::write(type, iter, byte_order);
+
+            // write num points
+            uint32_t num_points = boost::size(multipoint);
+            value_writer<uint32_t>::write(num_points, iter, byte_order);
+
+            typedef typename point_type<MultiPoint>::type point_type;
+
+            for(typename boost::range_iterator<MultiPoint const>::type
+                    point_iter = boost::begin(multipoint);
+                point_iter != boost::end(multipoint);
+                ++point_iter)
+            {
+                detail::wkb::point_writer<point_type>::write(*point_iter, iter, byte_order);
+            }
+
+            return true;
+        }
+    };
+
+    template <typename MultiLinestring>
+    struct multilinestring_writer
+    {
+        template <typename OutputIterator>
+        static bool write(MultiLinestring const& multilinestring,
+                          OutputIterator& iter,
+                          byte_order_type::enum_t byte_order)
+        {
+            // write endian type
+            value_writer<uint8_t>::write(byte_order, iter, byte_order);
+
+            // write geometry type
+            uint32_t type = geometry_type<MultiLinestring>::get();
+            value_writer<uint32_t>::write(type, iter, byte_order);
+
+            // write num linestrings
+            uint32_t num_linestrings = boost::size(multilinestring);
+            value_writer<uint32_t>::write(num_linestrings, iter, byte_order);
+
+            typedef typename boost::range_value<MultiLinestring>::type linestring_type;
+
+            for(typename boost::range_iterator<MultiLinestring const>::type
+                    linestring_iter = boost::begin(multilinestring);
+                linestring_iter != boost::end(multilinestring);
+                ++linestring_iter)
+            {
+                detail::wkb::linestring_writer<linestring_type>::write(*linestring_iter, iter, byte_order);
+            }
+
+            return true;
+        }
+    };
+
+    template <typename MultiPolygon>
+    struct multipolygon_writer
+    {
+        template <typename OutputIterator>
+        static bool write(MultiPolygon const& multipolygon,
+                          OutputIterator& iter,
+                          byte_order_type::enum_t byte_order)
+        {
+            // write endian type
+            value_writer<uint8_t>::write(byte_order, iter, byte_order);
+
+            // write geometry type
+            uint32_t type = geometry_type<MultiPolygon>::get();
+            value_writer<uint32_t>::write(type, iter, byte_order);
+
+            // write num polygons
+            uint32_t num_polygons = boost::size(multipolygon);
+            value_writer<uint32_t>::write(num_polygons, iter, byte_order);
+
+            typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+
+            for(typename boost::range_iterator<MultiPolygon const>::type
+                    polygon_iter = boost::begin(multipolygon);
+                polygon_iter != boost::end(multipolygon);
+                ++polygon_iter)
+            {
+                detail::wkb::polygon_writer<polygon_type>::write(*polygon_iter, iter, byte_order);
+            }
+
+            return true;
+        }
+    };
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_IMPL
+
+}} // namespace boost::geometry
+#endif // BOOST_GEOMETRY_IO_WKB_DETAIL_WRITER_HPP
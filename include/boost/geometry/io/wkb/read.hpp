@@ -0,0 +1,222 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2009-2012 Mateusz Loskot, London, UK.
+
+// This file was modified by Oracle on 2020.
+// Modifications copyright (c) 2020, Oracle and/or its affiliates.
+// Contributed and/or modified by Adam Wulkiewicz, on behalf of Oracle
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_READ_HPP
+#define BOOST_GEOMETRY_IO_WKB_READ_HPP
+
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <boost/static_assert.hpp>
+
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/io/wkb/detail/parser.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Tag, typename G>
+struct read_wkb {};
+
+template <typename Geometry>
+struct read_wkb<point_tag, Geometry>
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
+        detail::wkb::byte_order_type::enum_t order)
+    {
+        return detail::wkb::point_parser<Geometry>::parse(it, end, geometry, order);
+    }
+};
+
+template <typename Geometry>
+struct read_wkb<linestring_tag, Geometry>
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
+        detail::wkb::byte_order_type::enum_t order)
+    {
+        geometry::clear(geometry);
+        return detail::wkb::linestring_parser<Geometry>::parse(it, end, geometry, order);
+    }
+};
+
+template <typename Geometry>
+struct read_wkb<polygon_tag, Geometry>
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
+        detail::wkb::byte_order_type::enum_t order)
+    {
+        geometry::clear(geometry);
+        return detail::wkb::polygon_parser<Geometry>::parse(it, end, geometry, order);
+    }
+};
+
+template <typename Geometry>
+struct read_wkb<multi_point_tag, Geometry>
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
+        detail::wkb::byte_order_type::enum_t order)
+    {
+        geometry::clear(geometry);
+        return detail::wkb::multipoint_parser<Geometry>::parse(it, end, geometry, order);
+    }
+};
+
+template <typename Geometry>
+struct read_wkb<multi_linestring_tag, Geometry>
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
+        detail::wkb::byte_order_type::enum_t order)
+    {
+        geometry::clear(geometry);
+        return detail::wkb::multilinestring_parser<Geometry>::parse(it, end, geometry, order);
+    }
+};
+
+template <typename Geometry>
+struct read_wkb<multi_polygon_tag, Geometry>
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
+        detail::wkb::byte_order_type::enum_t order)
+    {
+        geometry::clear(geometry);
+        return detail::wkb::multipolygon_parser<Geometry>::parse(it, end, geometry, order);
+    }
+};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// Iterators of the containers storing the bytes contiguously, they are
+// replaced with pointers so the coordinates can be copied at once
+template <typename Iterator>
+struct is_contiguous_iterator
+{
+    typedef typename std::iterator_traits<Iterator>::value_type value_type;
+
+    static const bool value
+        = std::is_same<Iterator, typename std::vector<value_type>::iterator>::value
+       || std::is_same<Iterator, typename std::vector<value_type>::const_iterator>::value
+       || std::is_same<Iterator, typename std::basic_string<value_type>::iterator>::value
+       || std::is_same<Iterator, typename std::basic_string<value_type>::const_iterator>::value;
+};
+
+template <typename Iterator, typename Geometry>
+inline bool read_wkb(Iterator begin, Iterator end, Geometry& geometry)
+{
+    byte_order_type::enum_t byte_order;
+    if (byte_order_parser::parse(begin, end, byte_order))
+    {
+        return dispatch::read_wkb
+            <
+            typename tag<Geometry>::type,
+            Geometry
+            >::parse(begin, end, geometry, byte_order);
+    }
+
+    return false;
+}
+
+template <typename Iterator, typename Geometry>
+inline bool read_wkb(Iterator begin, Iterator end, Geometry& geometry,
+                     std::true_type /*contiguous*/)
+{
+    if (begin == end)
+    {
+        return false;
+    }
+
+    typedef typename std::iterator_traits<Iterator>::value_type byte_type;
+    byte_type const* const first = std::addressof(*begin);
+    return detail::wkb::read_wkb(first, first + (end - begin), geometry);
+}
+
+template <typename Iterator, typename Geometry>
+inline bool read_wkb(Iterator begin, Iterator end, Geometry& geometry,
+                     std::false_type /*contiguous*/)
+{
+    return detail::wkb::read_wkb(begin, end, geometry);
+}
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Parses a geometry from the Well-Known Binary representation
+\ingroup wkb
+\details The byte order is read from the WKB. If the points of a linestring
+    or a ring store double coordinates the same way as WKB and are stored
+    contiguously (e.g. model::linestring<model::point<double, 2, cs>>), the
+    coordinates are copied at once from pointers and iterators of vectors
+    and strings.
+\tparam Iterator \tparam_iterator, random access iterator of bytes
+\tparam Geometry \tparam_geometry
+\param begin iterator to the first byte
+\param end iterator past the last byte
+\param geometry \param_geometry which will be cleared and filled
+\return true if the geometry was read
+*/
+template <typename Iterator, typename Geometry>
+inline bool read_wkb(Iterator begin, Iterator end, Geometry& geometry)
+{
+    // Stream of bytes can only be parsed using random access iterator.
+    BOOST_STATIC_ASSERT((
+        std::is_convertible
+        <
+            typename std::iterator_traits<Iterator>::iterator_category,
+            const std::random_access_iterator_tag&
+        >::value));
+
+    return detail::wkb::read_wkb(begin, end, geometry,
+                                 std::integral_constant
+                                    <
+                                        bool,
+                                        detail::wkb::is_contiguous_iterator<Iterator>::value
+                                    >());
+}
+
+template <typename ByteType, typename Geometry>
+inline bool read_wkb(ByteType const* bytes, std::size_t length, Geometry& geometry)
+{
+    BOOST_STATIC_ASSERT((std::is_integral<ByteType>::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+
+    ByteType const* begin = bytes;
+    ByteType const* const end = bytes + length;
+
+    return read_wkb(begin, end, geometry);
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_READ_HPP
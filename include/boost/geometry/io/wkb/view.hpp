@@ -0,0 +1,435 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_VIEW_HPP
+#define BOOST_GEOMETRY_IO_WKB_VIEW_HPP
+
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/static_assert.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/io/wkb/detail/endian.hpp>
+#include <boost/geometry/io/wkb/detail/ogc.hpp>
+#include <boost/geometry/io/wkb/detail/parser.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+template
+<
+    typename Point,
+    std::size_t I = 0,
+    std::size_t N = dimension<Point>::value
+>
+struct point_loader
+{
+    static inline void apply(unsigned char const* bytes, bool swap, Point& point)
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+
+        set<I>(point, static_cast<coordinate_type>(
+                    endian::load_double(bytes + I * sizeof(double), swap)));
+
+        point_loader<Point, I + 1, N>::apply(bytes, swap, point);
+    }
+};
+
+template <typename Point, std::size_t N>
+struct point_loader<Point, N, N>
+{
+    static inline void apply(unsigned char const*, bool, Point&)
+    {}
+};
+
+// Iterates the coordinates stored in WKB and returns the points by value.
+// The bytes are not aligned so the coordinates are copied into the points.
+template <typename Point>
+class point_iterator
+    : public boost::iterator_facade
+        <
+            point_iterator<Point>,
+            Point const,
+            boost::random_access_traversal_tag,
+            Point
+        >
+{
+public:
+    static const std::size_t point_size = dimension<Point>::value * sizeof(double);
+
+    point_iterator()
+        : m_bytes(nullptr), m_swap(false)
+    {}
+
+    point_iterator(unsigned char const* bytes, bool swap)
+        : m_bytes(bytes), m_swap(swap)
+    {}
+
+private:
+    friend class boost::iterator_core_access;
+
+    Point dereference() const
+    {
+        Point point;
+        point_loader<Point>::apply(m_bytes, m_swap, point);
+        return point;
+    }
+
+    bool equal(point_iterator const& other) const
+    {
+        return m_bytes == other.m_bytes;
+    }
+
+    void increment() { m_bytes += point_size; }
+    void decrement() { m_bytes -= point_size; }
+
+    void advance(std::ptrdiff_t n)
+    {
+        m_bytes += n * std::ptrdiff_t(point_size);
+    }
+
+    std::ptrdiff_t distance_to(point_iterator const& other) const
+    {
+        return (other.m_bytes - m_bytes) / std::ptrdiff_t(point_size);
+    }
+
+    unsigned char const* m_bytes;
+    bool m_swap;
+};
+
+// The number of points followed by the points, not owning the bytes
+template <typename Point>
+class point_range_view
+{
+public:
+    typedef point_iterator<Point> iterator;
+    typedef point_iterator<Point> const_iterator;
+
+    point_range_view()
+        : m_first(nullptr), m_size(0), m_swap(false)
+    {}
+
+    iterator begin() const
+    {
+        return iterator(m_first, m_swap);
+    }
+
+    iterator end() const
+    {
+        return iterator(m_first + m_size * iterator::point_size, m_swap);
+    }
+
+    std::size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+protected:
+    // Refers to the points at it and moves it past the points
+    void assign(unsigned char const*& it, unsigned char const* end,
+                byte_order_type::enum_t order)
+    {
+        boost::uint32_t num_points = 0;
+        if (! value_parser<boost::uint32_t>::parse(it, end, num_points, order)
+            || std::size_t(end - it) / iterator::point_size < num_points)
+        {
+            throw read_wkb_exception();
+        }
+
+        m_first = it;
+        m_size = num_points;
+        m_swap = is_swapped(order);
+        it += m_size * iterator::point_size;
+    }
+
+private:
+    unsigned char const* m_first;
+    std::size_t m_size;
+    bool m_swap;
+};
+
+// Reads the byte order and checks the type of the geometry
+template <typename Geometry>
+inline byte_order_type::enum_t parse_header(unsigned char const*& it,
+                                            unsigned char const* end)
+{
+    byte_order_type::enum_t order = byte_order_type::unknown;
+    if (! byte_order_parser::parse(it, end, order)
+        || ! geometry_type_parser<Geometry>::parse(it, end, order))
+    {
+        throw read_wkb_exception();
+    }
+    return order;
+}
+
+template <typename ByteType>
+inline unsigned char const* as_bytes(ByteType const* bytes)
+{
+    BOOST_STATIC_ASSERT((std::is_integral<ByteType>::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+
+    return reinterpret_cast<unsigned char const*>(bytes);
+}
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Makes WKB linestring behave like a linestring
+\details Refers to the points of a linestring stored in Well-Known Binary
+    without copying them. The coordinates are read when the points are
+    accessed, in the byte order of the WKB. The bytes have to outlive the
+    view. The view is registered as a LineString Concept and can be passed
+    to algorithms not modifying the geometry.
+\tparam Point \tparam_point
+\ingroup wkb
+*/
+template <typename Point>
+class wkb_linestring_view
+    : public detail::wkb::point_range_view<Point>
+{
+public:
+    /// Constructor accepting the bytes, throws read_wkb_exception if the
+    /// bytes do not contain a linestring with the dimension of the Point
+    template <typename ByteType>
+    wkb_linestring_view(ByteType const* bytes, std::size_t length)
+    {
+        unsigned char const* it = detail::wkb::as_bytes(bytes);
+        unsigned char const* const end = it + length;
+        detail::wkb::byte_order_type::enum_t const order
+            = detail::wkb::parse_header<wkb_linestring_view>(it, end);
+        this->assign(it, end, order);
+    }
+};
+
+
+template <typename Point, bool ClockWise, bool Closed>
+class wkb_polygon_view;
+
+/*!
+\brief Makes a ring of WKB polygon behave like a ring
+\details Refers to the points of a ring of a polygon stored in Well-Known
+    Binary without copying them. The bytes have to outlive the view. The
+    view is registered as a Ring Concept.
+\tparam Point \tparam_point
+\tparam ClockWise true for clockwise direction of the ring
+\tparam Closed true if the ring is closed
+\ingroup wkb
+*/
+template <typename Point, bool ClockWise = true, bool Closed = true>
+class wkb_ring_view
+    : public detail::wkb::point_range_view<Point>
+{
+    typedef wkb_polygon_view<Point, ClockWise, Closed> polygon_view_type;
+
+public:
+    /// Constructor accepting the bytes of a polygon and the index of the
+    /// ring, 0 for the exterior ring. Throws read_wkb_exception if the
+    /// bytes do not contain a polygon with such ring.
+    template <typename ByteType>
+    wkb_ring_view(ByteType const* bytes, std::size_t length,
+                  std::size_t ring_index = 0)
+    {
+        unsigned char const* it = detail::wkb::as_bytes(bytes);
+        unsigned char const* const end = it + length;
+        detail::wkb::byte_order_type::enum_t const order
+            = detail::wkb::parse_header<polygon_view_type>(it, end);
+
+        boost::uint32_t num_rings = 0;
+        if (! detail::wkb::value_parser<boost::uint32_t>::parse(it, end, num_rings, order)
+            || ring_index >= num_rings)
+        {
+            throw read_wkb_exception();
+        }
+
+        for (std::size_t i = 0; i <= ring_index; ++i)
+        {
+            this->assign(it, end, order);
+        }
+    }
+
+    /// Constructor of the empty ring
+    wkb_ring_view() {}
+
+private:
+    friend class wkb_polygon_view<Point, ClockWise, Closed>;
+};
+
+
+/*!
+\brief Makes WKB polygon behave like a polygon
+\details Refers to the points of the rings of a polygon stored in Well-Known
+    Binary without copying them. Only the views of the rings are stored.
+    The bytes have to outlive the view. The view is registered as a Polygon
+    Concept and can be passed to algorithms not modifying the geometry.
+\tparam Point \tparam_point
+\tparam ClockWise true for clockwise direction of the rings
+\tparam Closed true if the rings are closed
+\ingroup wkb
+*/
+template <typename Point, bool ClockWise = true, bool Closed = true>
+class wkb_polygon_view
+{
+public:
+    typedef wkb_ring_view<Point, ClockWise, Closed> ring_type;
+    typedef std::vector<ring_type> inner_container_type;
+
+    /// Constructor accepting the bytes, throws read_wkb_exception if the
+    /// bytes do not contain a polygon with the dimension of the Point
+    template <typename ByteType>
+    wkb_polygon_view(ByteType const* bytes, std::size_t length)
+    {
+        unsigned char const* it = detail::wkb::as_bytes(bytes);
+        unsigned char const* const end = it + length;
+        detail::wkb::byte_order_type::enum_t const order
+            = detail::wkb::parse_header<wkb_polygon_view>(it, end);
+
+        // Each ring has at least the number of its points
+        boost::uint32_t num_rings = 0;
+        if (! detail::wkb::value_parser<boost::uint32_t>::parse(it, end, num_rings, order)
+            || std::size_t(end - it) / sizeof(boost::uint32_t) < num_rings)
+        {
+            throw read_wkb_exception();
+        }
+
+        if (num_rings > 0)
+        {
+            m_outer.assign(it, end, order);
+            m_inners.resize(num_rings - 1);
+            for (ring_type& inner : m_inners)
+            {
+                inner.assign(it, end, order);
+            }
+        }
+    }
+
+    ring_type const& outer() const { return m_outer; }
+    inner_container_type const& inners() const { return m_inners; }
+
+private:
+    ring_type m_outer;
+    inner_container_type m_inners;
+};
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <typename Point>
+struct tag<wkb_linestring_view<Point> >
+{
+    typedef linestring_tag type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct tag<wkb_ring_view<Point, ClockWise, Closed> >
+{
+    typedef ring_tag type;
+};
+
+template <typename Point, bool Closed>
+struct point_order<wkb_ring_view<Point, false, Closed> >
+{
+    static const order_selector value = counterclockwise;
+};
+
+template <typename Point, bool Closed>
+struct point_order<wkb_ring_view<Point, true, Closed> >
+{
+    static const order_selector value = clockwise;
+};
+
+template <typename Point, bool ClockWise>
+struct closure<wkb_ring_view<Point, ClockWise, true> >
+{
+    static const closure_selector value = closed;
+};
+
+template <typename Point, bool ClockWise>
+struct closure<wkb_ring_view<Point, ClockWise, false> >
+{
+    static const closure_selector value = open;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct tag<wkb_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef polygon_tag type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct ring_const_type<wkb_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef wkb_ring_view<Point, ClockWise, Closed> const& type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct ring_mutable_type<wkb_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef wkb_ring_view<Point, ClockWise, Closed> const& type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct interior_const_type<wkb_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef std::vector<wkb_ring_view<Point, ClockWise, Closed> > const& type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct interior_mutable_type<wkb_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef std::vector<wkb_ring_view<Point, ClockWise, Closed> > const& type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct exterior_ring<wkb_polygon_view<Point, ClockWise, Closed> >
+{
+    static inline wkb_ring_view<Point, ClockWise, Closed> const&
+        get(wkb_polygon_view<Point, ClockWise, Closed> const& p)
+    {
+        return p.outer();
+    }
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct interior_rings<wkb_polygon_view<Point, ClockWise, Closed> >
+{
+    static inline std::vector<wkb_ring_view<Point, ClockWise, Closed> > const&
+        get(wkb_polygon_view<Point, ClockWise, Closed> const& p)
+    {
+        return p.inners();
+    }
+};
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_WKB_VIEW_HPP
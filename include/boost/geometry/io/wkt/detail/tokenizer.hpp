@@ -0,0 +1,288 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
+#define BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
+
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+#include <boost/config.hpp>
+#include <boost/lexical_cast/try_lexical_convert.hpp>
+
+#include <boost/geometry/util/coordinate_cast.hpp>
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#  if __has_include(<charconv>)
+#    include <charconv>
+#  endif
+#endif
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#  define BOOST_GEOMETRY_WKT_USE_FROM_CHARS
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+// The text being parsed, not owned. It is converted to std::string
+// only to create the message of an exception, which contains at most
+// the first 100 characters so the rest is not copied.
+struct wkt_text
+{
+    static const std::size_t max_message_size = 100;
+
+    wkt_text(char const* first, char const* last)
+        : first(first), last(last)
+    {}
+
+    wkt_text(std::string const& wkt)
+        : first(wkt.data()), last(wkt.data() + wkt.size())
+    {}
+
+    operator std::string() const
+    {
+        std::size_t const size = std::size_t(last - first);
+        return std::string(first, size < max_message_size ? size : max_message_size);
+    }
+
+    char const* first;
+    char const* last;
+};
+
+// A token referring to a part of the text
+class wkt_token
+{
+public:
+    typedef char const* iterator;
+    typedef char const* const_iterator;
+    typedef std::size_t size_type;
+
+    wkt_token()
+        : m_first(nullptr), m_last(nullptr)
+    {}
+
+    wkt_token(char const* first, char const* last)
+        : m_first(first), m_last(last)
+    {}
+
+    char const* begin() const { return m_first; }
+    char const* end() const { return m_last; }
+    std::size_t size() const { return std::size_t(m_last - m_first); }
+    bool empty() const { return m_first == m_last; }
+
+    std::string str() const { return std::string(m_first, m_last); }
+
+    friend inline bool operator==(wkt_token const& token, char const* s)
+    {
+        std::size_t const n = std::strlen(s);
+        return token.size() == n && std::memcmp(token.m_first, s, n) == 0;
+    }
+    friend inline bool operator!=(wkt_token const& token, char const* s)
+    {
+        return ! (token == s);
+    }
+    friend inline bool operator==(wkt_token const& token, std::string const& s)
+    {
+        return token.size() == s.size()
+            && std::memcmp(token.m_first, s.data(), s.size()) == 0;
+    }
+    friend inline bool operator!=(wkt_token const& token, std::string const& s)
+    {
+        return ! (token == s);
+    }
+
+private:
+    char const* m_first;
+    char const* m_last;
+};
+
+// Splits the text the same way as boost::tokenizer with
+// char_separator(" \n\t\r", ",()") but without copying the tokens
+class wkt_tokenizer
+{
+public:
+    class const_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef wkt_token value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef wkt_token const* pointer;
+        typedef wkt_token const& reference;
+
+        const_iterator()
+            : m_base(nullptr), m_last(nullptr)
+        {}
+
+        const_iterator(char const* base, char const* first, char const* last)
+            : m_base(base), m_last(last)
+        {
+            find_token(first);
+        }
+
+        wkt_token const& operator*() const { return m_token; }
+        wkt_token const* operator->() const { return &m_token; }
+
+        const_iterator& operator++()
+        {
+            find_token(m_token.end());
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator result = *this;
+            ++*this;
+            return result;
+        }
+
+        // Offset of the token (or the end) in bytes from the begin of the text
+        std::size_t offset() const
+        {
+            return std::size_t(m_token.begin() - m_base);
+        }
+
+        friend inline bool operator==(const_iterator const& l, const_iterator const& r)
+        {
+            return l.m_token.begin() == r.m_token.begin();
+        }
+        friend inline bool operator!=(const_iterator const& l, const_iterator const& r)
+        {
+            return ! (l == r);
+        }
+
+    private:
+        static inline bool is_dropped(char c)
+        {
+            return c == ' ' || c == '\n' || c == '\t' || c == '\r';
+        }
+
+        static inline bool is_kept(char c)
+        {
+            return c == ',' || c == '(' || c == ')';
+        }
+
+        void find_token(char const* it)
+        {
+            while (it != m_last && is_dropped(*it))
+            {
+                ++it;
+            }
+
+            char const* first = it;
+            if (it != m_last)
+            {
+                if (is_kept(*it))
+                {
+                    ++it;
+                }
+                else
+                {
+                    while (it != m_last && ! is_dropped(*it) && ! is_kept(*it))
+                    {
+                        ++it;
+                    }
+                }
+            }
+            m_token = wkt_token(first, it);
+        }
+
+        char const* m_base;
+        char const* m_last;
+        wkt_token m_token;
+    };
+
+    typedef const_iterator iterator;
+
+    wkt_tokenizer(char const* first, char const* last)
+        : m_first(first), m_last(last)
+    {}
+
+    const_iterator begin() const { return const_iterator(m_first, m_first, m_last); }
+    const_iterator end() const { return const_iterator(m_first, m_last, m_last); }
+
+private:
+    char const* m_first;
+    char const* m_last;
+};
+
+inline wkt_tokenizer make_tokenizer(wkt_text const& wkt)
+{
+    return wkt_tokenizer(wkt.first, wkt.last);
+}
+
+template <typename Iterator>
+inline std::size_t token_offset(Iterator const& )
+{
+    return std::string::npos;
+}
+
+inline std::size_t token_offset(wkt_tokenizer::const_iterator const& it)
+{
+    return it.offset();
+}
+
+
+// Converts a token into a coordinate. Numbers are converted without
+// allocations, with std::from_chars if it's available.
+template
+<
+    typename CoordinateType,
+    bool IsArithmetic = std::is_arithmetic<CoordinateType>::value
+>
+struct coordinate_parser
+{
+    static inline bool apply(wkt_token const& token, CoordinateType& value)
+    {
+        value = coordinate_cast<CoordinateType>::apply(token.str());
+        return true;
+    }
+};
+
+template <typename CoordinateType>
+struct coordinate_parser<CoordinateType, true>
+{
+    static inline bool apply(wkt_token const& token, CoordinateType& value)
+    {
+#if defined(BOOST_GEOMETRY_NO_LEXICAL_CAST)
+        value = coordinate_cast<CoordinateType>::apply(token.str());
+        return true;
+#elif defined(BOOST_GEOMETRY_WKT_USE_FROM_CHARS)
+        char const* first = token.begin();
+        char const* const last = token.end();
+        // from_chars doesn't accept the plus sign
+        if (first != last && *first == '+' && first + 1 != last && first[1] != '-')
+        {
+            ++first;
+        }
+        auto const result = std::from_chars(first, last, value);
+        return result.ec == std::errc() && result.ptr == last;
+#else
+        return boost::conversion::try_lexical_convert(token.begin(), token.size(), value);
+#endif
+    }
+};
+
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
@@ -22,10 +22,10 @@
 #define BOOST_GEOMETRY_IO_WKT_READ_HPP
 
 #include <cstddef>
+#include <iterator>
 #include <string>
 
 #include <boost/lexical_cast.hpp>
-#include <boost/tokenizer.hpp>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/range/begin.hpp>
@@ -55,6 +55,7 @@
 #include <boost/geometry/geometries/concepts/check.hpp>
 
 #include <boost/geometry/io/wkt/detail/prefix.hpp>
+#include <boost/geometry/io/wkt/detail/tokenizer.hpp>
 
 #include <boost/geometry/strategies/io/cartesian.hpp>
 #include <boost/geometry/strategies/io/geographic.hpp>
@@ -81,11 +82,12 @@ struct read_wkt_exception : public geometry::exception
                        std::string const& wkt)
         : message(msg)
         , wkt(wkt)
+        , m_offset(detail::wkt::token_offset(it))
     {
         if (it != end)
         {
             source = " at '";
-            source += it->c_str();
+            source += std::string(boost::begin(*it), boost::end(*it));
             source += "'";
         }
         complete = message + source + " in '" + wkt.substr(0, 100) + "'";
@@ -94,6 +96,7 @@ struct read_wkt_exception : public geometry::exception
     read_wkt_exception(std::string const& msg, std::string const& wkt)
         : message(msg)
         , wkt(wkt)
+        , m_offset(std::string::npos)
     {
         complete = message + "' in (" + wkt.substr(0, 100) + ")";
     }
@@ -104,11 +107,23 @@ struct read_wkt_exception : public geometry::exception
     {
         return complete.c_str();
     }
+
+    /*!
+    \brief Returns the offset in bytes of the token at which the error was
+        detected, from the begin of the parsed WKT, or std::string::npos
+        if it's unknown
+    */
+    std::size_t offset() const
+    {
+        return m_offset;
+    }
+
 private :
     std::string source;
     std::string message;
     std::string wkt;
     std::string complete;
+    std::size_t m_offset;
 };
 
 
@@ -117,14 +132,6 @@ private :
 namespace detail { namespace wkt
 {
 
-inline auto make_tokenizer(std::string const& wkt)
-{
-    using separator = boost::char_separator<char>;
-    using tokenizer = boost::tokenizer<separator>;
-    const tokenizer tokens(wkt, separator(" \n\t\r", ",()"));
-    return tokens;
-}
-
 template <typename Point,
           std::size_t Dimension = 0,
           std::size_t DimensionCount = geometry::dimension<Point>::value>
@@ -134,38 +141,48 @@ struct parsing_assigner
     static inline void apply(TokenizerIterator& it,
                              TokenizerIterator const& end,
                              Point& point,
-                             std::string const& wkt)
+                             wkt_text const& wkt)
     {
         using coordinate_type = typename coordinate_type<Point>::type;
 
         // Stop at end of tokens, or at "," ot ")"
         bool finished = (it == end || *it == "," || *it == ")");
 
-        try
-        {
-            // Initialize missing coordinates to default constructor (zero)
-            // OR
-            // Use lexical_cast for conversion to double/int
-            // Note that it is much slower than atof. However, it is more standard
-            // and in parsing the change in performance falls probably away against
-            // the tokenizing
-            set<Dimension>(point, finished
-                    ? coordinate_type()
-                    : coordinate_cast<coordinate_type>::apply(*it));
-        }
-        catch(boost::bad_lexical_cast const& blc)
-        {
-            BOOST_THROW_EXCEPTION(read_wkt_exception(blc.what(), it, end, wkt));
-        }
-        catch(std::exception const& e)
-        {
-            BOOST_THROW_EXCEPTION(read_wkt_exception(e.what(), it, end, wkt));
-        }
-        catch(...)
+        // Initialize missing coordinates to default constructor (zero)
+        coordinate_type value = coordinate_type();
+
+        if (! finished)
         {
-            BOOST_THROW_EXCEPTION(read_wkt_exception("", it, end, wkt));
+            bool parsed = false;
+            try
+            {
+                // Numbers are converted directly from the characters of
+                // the token, other types by coordinate_cast
+                parsed = coordinate_parser<coordinate_type>::apply(*it, value);
+            }
+            catch(boost::bad_lexical_cast const& blc)
+            {
+                BOOST_THROW_EXCEPTION(read_wkt_exception(blc.what(), it, end, wkt));
+            }
+            catch(std::exception const& e)
+            {
+                BOOST_THROW_EXCEPTION(read_wkt_exception(e.what(), it, end, wkt));
+            }
+            catch(...)
+            {
+                BOOST_THROW_EXCEPTION(read_wkt_exception("", it, end, wkt));
+            }
+
+            if (! parsed)
+            {
+                BOOST_THROW_EXCEPTION(read_wkt_exception(
+                    "bad lexical cast: source type value could not be interpreted as target",
+                    it, end, wkt));
+            }
         }
 
+        set<Dimension>(point, value);
+
         parsing_assigner<Point, Dimension + 1, DimensionCount>::apply(
                         (finished ? it : ++it), end, point, wkt);
     }
@@ -188,7 +205,7 @@ struct parsing_assigner<Point, DimensionCount, DimensionCount>
 template <typename Iterator>
 inline void handle_open_parenthesis(Iterator& it,
                                     Iterator const& end,
-                                    std::string const& wkt)
+                                    wkt_text const& wkt)
 {
     if (it == end || *it != "(")
     {
@@ -201,7 +218,7 @@ inline void handle_open_parenthesis(Iterator& it,
 template <typename Iterator>
 inline void handle_close_parenthesis(Iterator& it,
                                      Iterator const& end,
-                                     std::string const& wkt)
+                                     wkt_text const& wkt)
 {
     if (it != end && *it == ")")
     {
@@ -216,7 +233,7 @@ inline void handle_close_parenthesis(Iterator& it,
 template <typename Iterator>
 inline void check_end(Iterator& it,
                       Iterator const& end,
-                      std::string const& wkt)
+                      wkt_text const& wkt)
 {
     if (it != end)
     {
@@ -237,7 +254,7 @@ struct container_inserter
     template <typename TokenizerIterator, typename OutputIterator>
     static inline void apply(TokenizerIterator& it,
                              TokenizerIterator const& end,
-                             std::string const& wkt,
+                             wkt_text const& wkt,
                              OutputIterator out)
     {
         handle_open_parenthesis(it, end, wkt);
@@ -338,7 +355,7 @@ struct container_appender
     template <typename TokenizerIterator>
     static inline void apply(TokenizerIterator& it,
                              TokenizerIterator const& end,
-                             std::string const& wkt,
+                             wkt_text const& wkt,
                              Geometry out)
     {
         handle_open_parenthesis(it, end, wkt);
@@ -376,7 +393,7 @@ struct point_parser
     template <typename TokenizerIterator>
     static inline void apply(TokenizerIterator& it,
                              TokenizerIterator const& end,
-                             std::string const& wkt,
+                             wkt_text const& wkt,
                              P& point)
     {
         handle_open_parenthesis(it, end, wkt);
@@ -392,9 +409,11 @@ struct linestring_parser
     template <typename TokenizerIterator>
     static inline void apply(TokenizerIterator& it,
                              TokenizerIterator const& end,
-                             std::string const& wkt,
+                             wkt_text const& wkt,
                              Geometry& geometry)
     {
+        // The geometry may be reused
+        geometry::clear(geometry);
         container_appender<Geometry&>::apply(it, end, wkt, geometry);
     }
 };
@@ -406,13 +425,14 @@ struct ring_parser
     template <typename TokenizerIterator>
     static inline void apply(TokenizerIterator& it,
                              TokenizerIterator const& end,
-                             std::string const& wkt,
+                             wkt_text const& wkt,
                              Ring& ring)
     {
         // A ring should look like polygon((x y,x y,x y...))
         // So handle the extra opening/closing parentheses
         // and in between parse using the container-inserter
         handle_open_parenthesis(it, end, wkt);
+        geometry::clear(ring);
         container_appender<Ring&>::apply(it, end, wkt, ring);
         handle_close_parenthesis(it, end, wkt);
     }
@@ -432,28 +452,39 @@ struct polygon_parser
     template <typename TokenizerIterator>
     static inline void apply(TokenizerIterator& it,
                              TokenizerIterator const& end,
-                             std::string const& wkt,
+                             wkt_text const& wkt,
                              Polygon& poly)
     {
 
         handle_open_parenthesis(it, end, wkt);
 
-        int n = -1;
+        // The rings of the polygon are reused if it's not empty
+        auto&& interiors = geometry::interior_rings(poly);
+        range::clear(exterior_ring(poly));
+
+        std::size_t n = 0;
 
         // Stop at ")"
         while (it != end && *it != ")")
         {
             // Parse ring
-            if (++n == 0)
+            if (n == 0)
             {
                 appender::apply(it, end, wkt, exterior_ring(poly));
             }
+            else if (n <= boost::size(interiors))
+            {
+                ring_return_type ring = range::at(interiors, n - 1);
+                range::clear(ring);
+                appender::apply(it, end, wkt, ring);
+            }
             else
             {
                 typename ring_type<Polygon>::type ring;
                 appender::apply(it, end, wkt, ring);
-                range::push_back(geometry::interior_rings(poly), std::move(ring));
+                range::push_back(interiors, std::move(ring));
             }
+            ++n;
 
             if (it != end && *it == ",")
             {
@@ -462,6 +493,13 @@ struct polygon_parser
             }
         }
 
+        // Remove the interior rings which were not parsed
+        std::size_t const interiors_count = n > 0 ? n - 1 : 0;
+        if (boost::size(interiors) > interiors_count)
+        {
+            range::resize(interiors, interiors_count);
+        }
+
         handle_close_parenthesis(it, end, wkt);
     }
 };
@@ -551,13 +589,14 @@ struct dimension<Geometry, geometry_collection_tag>
 template <typename Geometry, typename TokenizerIterator>
 inline bool initialize(TokenizerIterator& it,
                        TokenizerIterator const& end,
-                       std::string const& wkt,
+                       wkt_text const& wkt,
                        std::string const& geometry_name)
 {
-    if (it == end || ! boost::iequals(*it++, geometry_name))
+    if (it == end || ! boost::iequals(*it, geometry_name))
     {
-        BOOST_THROW_EXCEPTION(read_wkt_exception(std::string("Should start with '") + geometry_name + "'", wkt));
+        BOOST_THROW_EXCEPTION(read_wkt_exception(std::string("Should start with '") + geometry_name + "'", it, end, wkt));
     }
+    ++it;
 
     bool has_empty, has_z, has_m;
 
@@ -588,10 +627,21 @@ inline bool initialize(TokenizerIterator& it,
 }
 
 
+// Removes the elements of the reused geometry which were not parsed
+template <typename MultiGeometry>
+inline void resize_down(MultiGeometry& geometry, std::size_t size)
+{
+    if (boost::size(geometry) > size)
+    {
+        traits::resize<MultiGeometry>::apply(geometry, size);
+    }
+}
+
+
 template <typename Geometry, template<typename> class Parser, typename PrefixPolicy>
 struct geometry_parser
 {
-    static inline void apply(std::string const& wkt, Geometry& geometry)
+    static inline void apply(wkt_text const& wkt, Geometry& geometry)
     {
         geometry::clear(geometry);
 
@@ -607,13 +657,17 @@ struct geometry_parser
     template <typename TokenizerIterator>
     static inline void apply(TokenizerIterator& it,
                              TokenizerIterator const& end,
-                             std::string const& wkt,
+                             wkt_text const& wkt,
                              Geometry& geometry)
     {
         if (initialize<Geometry>(it, end, wkt, PrefixPolicy::apply()))
         {
             Parser<Geometry>::apply(it, end, wkt, geometry);
         }
+        else
+        {
+            geometry::clear(geometry);
+        }
     }
 };
 
@@ -621,7 +675,7 @@ struct geometry_parser
 template <typename MultiGeometry, template<typename> class Parser, typename PrefixPolicy>
 struct multi_parser
 {
-    static inline void apply(std::string const& wkt, MultiGeometry& geometry)
+    static inline void apply(wkt_text const& wkt, MultiGeometry& geometry)
     {
         traits::clear<MultiGeometry>::apply(geometry);
 
@@ -637,21 +691,26 @@ struct multi_parser
     template <typename TokenizerIterator>
     static inline void apply(TokenizerIterator& it,
                              TokenizerIterator const& end,
-                             std::string const& wkt,
+                             wkt_text const& wkt,
                              MultiGeometry& geometry)
     {
         if (initialize<MultiGeometry>(it, end, wkt, PrefixPolicy::apply()))
         {
             handle_open_parenthesis(it, end, wkt);
 
-            // Parse sub-geometries
+            // Parse sub-geometries, the existing ones are reused
+            std::size_t n = 0;
             while(it != end && *it != ")")
             {
-                traits::resize<MultiGeometry>::apply(geometry, boost::size(geometry) + 1);
+                if (n >= boost::size(geometry))
+                {
+                    traits::resize<MultiGeometry>::apply(geometry, n + 1);
+                }
                 Parser
                     <
                         typename boost::range_value<MultiGeometry>::type
-                    >::apply(it, end, wkt, *(boost::end(geometry) - 1));
+                    >::apply(it, end, wkt, range::at(geometry, n));
+                ++n;
                 if (it != end && *it == ",")
                 {
                     // Skip "," after multi-element is parsed
@@ -659,8 +718,14 @@ struct multi_parser
                 }
             }
 
+            resize_down(geometry, n);
+
             handle_close_parenthesis(it, end, wkt);
         }
+        else
+        {
+            traits::clear<MultiGeometry>::apply(geometry);
+        }
     }
 };
 
@@ -670,7 +735,7 @@ struct noparenthesis_point_parser
     template <typename TokenizerIterator>
     static inline void apply(TokenizerIterator& it,
                              TokenizerIterator const& end,
-                             std::string const& wkt,
+                             wkt_text const& wkt,
                              P& point)
     {
         parsing_assigner<P>::apply(it, end, point, wkt);
@@ -680,7 +745,7 @@ struct noparenthesis_point_parser
 template <typename MultiGeometry, typename PrefixPolicy>
 struct multi_point_parser
 {
-    static inline void apply(std::string const& wkt, MultiGeometry& geometry)
+    static inline void apply(wkt_text const& wkt, MultiGeometry& geometry)
     {
         traits::clear<MultiGeometry>::apply(geometry);
 
@@ -696,7 +761,7 @@ struct multi_point_parser
     template <typename TokenizerIterator>
     static inline void apply(TokenizerIterator& it,
                              TokenizerIterator const& end,
-                             std::string const& wkt,
+                             wkt_text const& wkt,
                              MultiGeometry& geometry)
     {
         if (initialize<MultiGeometry>(it, end, wkt, PrefixPolicy::apply()))
@@ -707,24 +772,29 @@ struct multi_point_parser
             // otherwise as "x y"
             bool using_brackets = (it != end && *it == "(");
 
+            std::size_t n = 0;
             while(it != end && *it != ")")
             {
-                traits::resize<MultiGeometry>::apply(geometry, boost::size(geometry) + 1);
+                if (n >= boost::size(geometry))
+                {
+                    traits::resize<MultiGeometry>::apply(geometry, n + 1);
+                }
 
                 if (using_brackets)
                 {
                     point_parser
                         <
                             typename boost::range_value<MultiGeometry>::type
-                        >::apply(it, end, wkt, *(boost::end(geometry) - 1));
+                        >::apply(it, end, wkt, range::at(geometry, n));
                 }
                 else
                 {
                     noparenthesis_point_parser
                         <
                             typename boost::range_value<MultiGeometry>::type
-                        >::apply(it, end, wkt, *(boost::end(geometry) - 1));
+                        >::apply(it, end, wkt, range::at(geometry, n));
                 }
+                ++n;
 
                 if (it != end && *it == ",")
                 {
@@ -733,9 +803,40 @@ struct multi_point_parser
                 }
             }
 
+            resize_down(geometry, n);
+
             handle_close_parenthesis(it, end, wkt);
         }
+        else
+        {
+            traits::clear<MultiGeometry>::apply(geometry);
+        }
+    }
+};
+
+
+// Stores a few points parsed by container_inserter without allocations
+template <typename Point, std::size_t Capacity>
+struct points_buffer
+{
+    typedef Point value_type;
+    typedef Point const& const_reference;
+
+    points_buffer()
+        : count(0)
+    {}
+
+    void push_back(Point const& point)
+    {
+        if (count < Capacity)
+        {
+            points[count] = point;
+        }
+        ++count;
     }
+
+    Point points[Capacity];
+    std::size_t count;
 };
 
 
@@ -750,7 +851,7 @@ struct multi_point_parser
 template <typename Box>
 struct box_parser
 {
-    static inline void apply(std::string const& wkt, Box& box)
+    static inline void apply(wkt_text const& wkt, Box& box)
     {
         auto const tokens{make_tokenizer(wkt)};
         auto it = tokens.begin();
@@ -764,7 +865,7 @@ struct box_parser
     template <typename TokenizerIterator>
     static inline void apply(TokenizerIterator& it,
                              TokenizerIterator const& end,
-                             std::string const& wkt,
+                             wkt_text const& wkt,
                              Box& box)
     {
         bool should_close = false;
@@ -791,7 +892,7 @@ struct box_parser
         }
 
         using point_type = typename point_type<Box>::type;
-        std::vector<point_type> points;
+        points_buffer<point_type, 5> points;
         container_inserter<point_type>::apply(it, end, wkt, std::back_inserter(points));
 
         if (should_close)
@@ -800,7 +901,7 @@ struct box_parser
         }
 
         unsigned int index = 0;
-        std::size_t n = boost::size(points);
+        std::size_t n = points.count;
         if (n == 2)
         {
             index = 1;
@@ -816,8 +917,8 @@ struct box_parser
             BOOST_THROW_EXCEPTION(read_wkt_exception("Box should have 2,4 or 5 points", wkt));
         }
 
-        geometry::detail::assign_point_to_index<min_corner>(points.front(), box);
-        geometry::detail::assign_point_to_index<max_corner>(points[index], box);
+        geometry::detail::assign_point_to_index<min_corner>(points.points[0], box);
+        geometry::detail::assign_point_to_index<max_corner>(points.points[index], box);
     }
 };
 
@@ -831,7 +932,7 @@ struct box_parser
 template <typename Segment>
 struct segment_parser
 {
-    static inline void apply(std::string const& wkt, Segment& segment)
+    static inline void apply(wkt_text const& wkt, Segment& segment)
     {
         auto const tokens{make_tokenizer(wkt)};
         auto it = tokens.begin();
@@ -845,7 +946,7 @@ struct segment_parser
     template <typename TokenizerIterator>
     static inline void apply(TokenizerIterator& it,
                              TokenizerIterator const& end,
-                             std::string const& wkt,
+                             wkt_text const& wkt,
                              Segment& segment)
     {
         if (it != end
@@ -860,13 +961,13 @@ struct segment_parser
         }
 
         using point_type = typename point_type<Segment>::type;
-        std::vector<point_type> points;
+        points_buffer<point_type, 2> points;
         container_inserter<point_type>::apply(it, end, wkt, std::back_inserter(points));
 
-        if (boost::size(points) == 2)
+        if (points.count == 2)
         {
-            geometry::detail::assign_point_to_index<0>(points.front(), segment);
-            geometry::detail::assign_point_to_index<1>(points.back(), segment);
+            geometry::detail::assign_point_to_index<0>(points.points[0], segment);
+            geometry::detail::assign_point_to_index<1>(points.points[1], segment);
         }
         else
         {
@@ -905,7 +1006,7 @@ struct dynamic_readwkt_caller
     template <typename TokenizerIterator>
     static inline void apply(TokenizerIterator& it,
                              TokenizerIterator const& end,
-                             std::string const& wkt,
+                             wkt_text const& wkt,
                              Geometry& geometry)
     {
         static const char* tag_point = prefix_point::apply();
@@ -981,7 +1082,7 @@ private:
     static bool parse_geometry(const char * ,
                                TokenizerIterator& it,
                                TokenizerIterator const& end,
-                               std::string const& wkt,
+                               wkt_text const& wkt,
                                Geometry& geometry,
                                bool = true)
     {
@@ -1004,7 +1105,7 @@ private:
     static bool parse_geometry(const char * name,
                                TokenizerIterator& ,
                                TokenizerIterator const& ,
-                               std::string const& wkt,
+                               wkt_text const& wkt,
                                Geometry& ,
                                bool throw_on_misfit = true)
     {
@@ -1123,6 +1224,18 @@ struct read_wkt<DynamicGeometry, dynamic_geometry_tag>
         auto tokens{detail::wkt::make_tokenizer(wkt)};
         auto it = tokens.begin();
         auto end = tokens.end();
+
+        apply(it, end, wkt, dynamic_geometry);
+
+        detail::wkt::check_end(it, end, wkt);
+    }
+
+    template <typename TokenizerIterator>
+    static inline void apply(TokenizerIterator& it,
+                             TokenizerIterator const& end,
+                             detail::wkt::wkt_text const& wkt,
+                             DynamicGeometry& dynamic_geometry)
+    {
         if (it == end)
         {
             BOOST_THROW_EXCEPTION(read_wkt_exception(
@@ -1134,8 +1247,6 @@ struct read_wkt<DynamicGeometry, dynamic_geometry_tag>
             <
                 DynamicGeometry, dispatch::read_wkt, detail::wkt::dynamic_move_assign
             >::apply(it, end, wkt, dynamic_geometry);
-
-        detail::wkt::check_end(it, end, wkt);
     }
 };
 
@@ -1159,9 +1270,11 @@ struct read_wkt<Geometry, geometry_collection_tag>
     template <typename TokenizerIterator>
     static inline void apply(TokenizerIterator& it,
                              TokenizerIterator const& end,
-                             std::string const& wkt,
+                             detail::wkt::wkt_text const& wkt,
                              Geometry& geometry)
     {
+        range::clear(geometry);
+
         if (detail::wkt::initialize<Geometry>(it, end, wkt,
                 detail::wkt::prefix_geometrycollection::apply()))
         {
@@ -1224,6 +1337,77 @@ inline Geometry from_wkt(std::string const& wkt)
     return geometry;
 }
 
+/*!
+\brief Reads consecutive geometries stored as OGC Well-Known Text (\ref WKT)
+    in a range of characters
+\details The text is not copied and the tokens are not allocated. Numbers are
+    converted with std::from_chars if it's available. The geometries in the
+    text have to be separated by whitespace characters, e.g. newlines. The
+    storage of the geometry passed to read() is reused if possible. The
+    exception thrown for invalid text contains the offset of the error in
+    bytes from the beginning of the whole text.
+\note The text has to outlive the reader.
+\ingroup wkt
+*/
+class wkt_reader
+{
+    typedef detail::wkt::wkt_tokenizer tokenizer_type;
+
+public:
+    /*!
+    \brief Constructs the reader reading characters in range [first, last)
+    */
+    wkt_reader(char const* first, char const* last)
+        : m_tokenizer(first, last)
+        , m_it(m_tokenizer.begin())
+        , m_end(m_tokenizer.end())
+    {}
+
+    /*!
+    \brief Constructs the reader reading a contiguous range of characters,
+        e.g. std::string or std::string_view
+    */
+    template <typename Text>
+    explicit wkt_reader(Text const& text)
+        : wkt_reader(text.data(), text.data() + text.size())
+    {}
+
+    /*!
+    \brief Reads the next geometry
+    \tparam Geometry \tparam_geometry
+    \param geometry \param_geometry output geometry
+    \return false if there are no more geometries in the text
+    */
+    template <typename Geometry>
+    bool read(Geometry& geometry)
+    {
+        geometry::concepts::check<Geometry>();
+
+        if (m_it == m_end)
+        {
+            return false;
+        }
+
+        // The text of the current geometry is used in the error messages
+        detail::wkt::wkt_text const wkt(m_it->begin(), m_end->begin());
+        dispatch::read_wkt<Geometry>::apply(m_it, m_end, wkt, geometry);
+        return true;
+    }
+
+    /*!
+    \brief Returns the offset in bytes of the next geometry
+    */
+    std::size_t offset() const
+    {
+        return m_it.offset();
+    }
+
+private:
+    tokenizer_type m_tokenizer;
+    tokenizer_type::const_iterator m_it;
+    tokenizer_type::const_iterator m_end;
+};
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_IO_WKT_READ_HPP
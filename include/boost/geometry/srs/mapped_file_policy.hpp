@@ -0,0 +1,160 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_SRS_MAPPED_FILE_POLICY_HPP
+#define BOOST_GEOMETRY_SRS_MAPPED_FILE_POLICY_HPP
+
+
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <ios>
+#include <string>
+
+
+namespace boost { namespace geometry
+{
+
+namespace srs
+{
+
+namespace detail
+{
+
+// Input stream reading the memory mapped file. It implements the part of
+// the interface of std::istream used to load the grids so the data is
+// copied from the mapping instead of being read with system calls.
+class mapped_istream
+{
+public:
+    mapped_istream()
+        : m_data(nullptr)
+        , m_size(0)
+        , m_pos(0)
+        , m_gcount(0)
+        , m_fail(false)
+    {}
+
+    void open(std::string const& filename)
+    {
+        try
+        {
+            interprocess::file_mapping file(filename.c_str(), interprocess::read_only);
+            interprocess::mapped_region region(file, interprocess::read_only);
+            m_region.swap(region);
+        }
+        catch (interprocess::interprocess_exception const&)
+        {
+            m_fail = true;
+            return;
+        }
+
+        m_data = static_cast<char const*>(m_region.get_address());
+        m_size = static_cast<std::streamoff>(m_region.get_size());
+        m_pos = 0;
+        m_fail = false;
+    }
+
+    bool is_open() const
+    {
+        return m_data != nullptr;
+    }
+
+    bool fail() const
+    {
+        return m_fail;
+    }
+
+    std::streamsize gcount() const
+    {
+        return m_gcount;
+    }
+
+    std::streamoff tellg() const
+    {
+        return m_fail ? std::streamoff(-1) : m_pos;
+    }
+
+    mapped_istream & seekg(std::streamoff pos)
+    {
+        return seekg(pos, std::ios::beg);
+    }
+
+    mapped_istream & seekg(std::streamoff off, std::ios_base::seekdir dir)
+    {
+        if (! m_fail)
+        {
+            std::streamoff const pos = dir == std::ios::beg ? off
+                                     : dir == std::ios::cur ? m_pos + off
+                                     : m_size + off;
+            if (pos < 0)
+            {
+                m_fail = true;
+            }
+            else
+            {
+                m_pos = pos;
+            }
+        }
+        return *this;
+    }
+
+    mapped_istream & read(char * s, std::streamsize n)
+    {
+        m_gcount = 0;
+        if (! m_fail)
+        {
+            std::streamoff const available = m_pos < m_size ? m_size - m_pos : 0;
+            m_gcount = static_cast<std::streamsize>((std::min)(std::streamoff(n), available));
+            if (m_gcount > 0)
+            {
+                std::memcpy(s, m_data + m_pos, static_cast<std::size_t>(m_gcount));
+            }
+            m_pos += m_gcount;
+            m_fail = m_gcount != n;
+        }
+        return *this;
+    }
+
+private:
+    interprocess::mapped_region m_region;
+    char const* m_data;
+    std::streamoff m_size;
+    std::streamoff m_pos;
+    std::streamsize m_gcount;
+    bool m_fail;
+};
+
+} // namespace detail
+
+/*!
+\brief Stream policy loading the grids from memory mapped files.
+\details The pages of the files are shared between the processes through
+    the page cache and the grids are loaded without a system call per row.
+*/
+struct mapped_file_policy
+{
+    typedef detail::mapped_istream stream_type;
+
+    static inline void open(stream_type & is, std::string const& gridname)
+    {
+        is.open(gridname);
+    }
+};
+
+
+} // namespace srs
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_SRS_MAPPED_FILE_POLICY_HPP
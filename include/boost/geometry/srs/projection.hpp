@@ -14,6 +14,10 @@
 #define BOOST_GEOMETRY_SRS_PROJECTION_HPP
 
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
 #include <string>
 #include <type_traits>
 
@@ -24,6 +28,7 @@
 #include <boost/geometry/algorithms/detail/convert_point_to_point.hpp>
 
 #include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/core/static_assert.hpp>
 
 #include <boost/geometry/srs/projections/dpar.hpp>
@@ -36,6 +41,9 @@
 #include <boost/geometry/srs/projections/proj4.hpp>
 #include <boost/geometry/srs/projections/spar.hpp>
 
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/parallel.hpp>
+
 #include <boost/geometry/views/detail/indexed_point_view.hpp>
 
 
@@ -286,6 +294,40 @@ struct project_geometry<MultiPolygon, PointPolicy, multi_polygon_tag>
 {};
 
 
+
+
+// Factor converting angles in Units into radians
+template <typename Units, typename T>
+inline T units_to_radian()
+{
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (std::is_same<Units, geometry::degree>::value
+      || std::is_same<Units, geometry::radian>::value),
+        "Units have to be degree or radian.",
+        Units);
+
+    return std::is_same<Units, geometry::degree>::value
+         ? geometry::math::d2r<T>()
+         : T(1);
+}
+
+// Calls f(first, count) for consecutive parts of points in [0, count),
+// in parallel if threads is different than 1, 0 means hardware concurrency.
+template <typename Function>
+inline void for_each_batch(std::size_t count, std::size_t threads, Function const& f)
+{
+    static const std::size_t part_size = 16 * pj_batch_size;
+
+    geometry::detail::parallel::for_each_index(
+        (count + part_size - 1) / part_size,
+        geometry::detail::parallel::threads_count(threads),
+        [&](std::size_t part)
+        {
+            std::size_t const first = part * part_size;
+            f(first, (std::min)(part_size, count - first));
+        });
+}
+
 } // namespace detail
 #endif // DOXYGEN_NO_DETAIL
 
@@ -490,6 +532,181 @@ public:
                     projections::detail::inverse_point_projection_policy
                 >::apply(xy, ll, base_t::proj());
     }
+
+    /// Forward projection of count points stored in separate arrays,
+    /// longitudes and latitudes are expressed in Units (degree or radian).
+    /// Points which can't be projected are set to HUGE_VAL and false is
+    /// returned. If threads is different than 1 the points are projected
+    /// in parallel, 0 means the number of hardware threads.
+    template <typename Units = geometry::degree, typename T>
+    inline bool forward(T const* lon, T const* lat, T* x, T* y,
+                        std::size_t count, std::size_t threads = 1) const
+    {
+        typedef typename projections::detail::promote_to_double<CT>::type calc_t;
+
+        calc_t const to_radian = projections::detail::units_to_radian<Units, calc_t>();
+        auto const& prj = base_t::proj();
+        std::atomic<bool> result(true);
+
+        projections::detail::for_each_batch(count, threads,
+            [&](std::size_t first, std::size_t n)
+            {
+                projections::detail::pj_fwd_n(prj, prj.params(), n,
+                    [&](std::size_t i, calc_t& lp_lon, calc_t& lp_lat)
+                    {
+                        lp_lon = lon[first + i] * to_radian;
+                        lp_lat = lat[first + i] * to_radian;
+                        return true;
+                    },
+                    [&](std::size_t i, calc_t const& res0, calc_t const& res1, int error)
+                    {
+                        if (error == 0)
+                        {
+                            x[first + i] = res0;
+                            y[first + i] = res1;
+                        }
+                        else
+                        {
+                            x[first + i] = HUGE_VAL;
+                            y[first + i] = HUGE_VAL;
+                            result = false;
+                        }
+                    });
+            });
+
+        return result;
+    }
+
+    /// Forward projection of count points stored in an array,
+    /// from Latitude-Longitude to Cartesian, see forward() for arrays
+    /// of coordinates.
+    template <typename LL, typename XY>
+    inline bool forward(LL const* ll, XY* xy,
+                        std::size_t count, std::size_t threads = 1) const
+    {
+        concepts::check_concepts_and_equal_dimensions<LL const, XY>();
+
+        typedef typename projections::detail::promote_to_double<CT>::type calc_t;
+
+        auto const& prj = base_t::proj();
+        std::atomic<bool> result(true);
+
+        projections::detail::for_each_batch(count, threads,
+            [&](std::size_t first, std::size_t n)
+            {
+                projections::detail::pj_fwd_n(prj, prj.params(), n,
+                    [&](std::size_t i, calc_t& lp_lon, calc_t& lp_lat)
+                    {
+                        lp_lon = geometry::get_as_radian<0>(ll[first + i]);
+                        lp_lat = geometry::get_as_radian<1>(ll[first + i]);
+                        return true;
+                    },
+                    [&](std::size_t i, calc_t const& res0, calc_t const& res1, int error)
+                    {
+                        XY& p = xy[first + i];
+                        projections::detail::copy_higher_dimensions<2>(ll[first + i], p);
+                        if (error == 0)
+                        {
+                            geometry::set<0>(p, res0);
+                            geometry::set<1>(p, res1);
+                        }
+                        else
+                        {
+                            set_invalid_point(p);
+                            result = false;
+                        }
+                    });
+            });
+
+        return result;
+    }
+
+    /// Inverse projection of count points stored in separate arrays,
+    /// longitudes and latitudes are expressed in Units (degree or radian),
+    /// invalid input points (HUGE_VAL) are not projected, see forward() for
+    /// arrays of coordinates.
+    template <typename Units = geometry::degree, typename T>
+    inline bool inverse(T const* x, T const* y, T* lon, T* lat,
+                        std::size_t count, std::size_t threads = 1) const
+    {
+        typedef typename projections::detail::promote_to_double<CT>::type calc_t;
+
+        calc_t const from_radian = calc_t(1) / projections::detail::units_to_radian<Units, calc_t>();
+        auto const& prj = base_t::proj();
+        std::atomic<bool> result(true);
+
+        projections::detail::for_each_batch(count, threads,
+            [&](std::size_t first, std::size_t n)
+            {
+                projections::detail::pj_inv_n(prj, prj.params(), n,
+                    [&](std::size_t i, calc_t& v0, calc_t& v1)
+                    {
+                        v0 = x[first + i];
+                        v1 = y[first + i];
+                        return v0 != HUGE_VAL;
+                    },
+                    [&](std::size_t i, calc_t const& lp_lon, calc_t const& lp_lat, int error)
+                    {
+                        if (error == 0)
+                        {
+                            lon[first + i] = lp_lon * from_radian;
+                            lat[first + i] = lp_lat * from_radian;
+                        }
+                        else
+                        {
+                            lon[first + i] = HUGE_VAL;
+                            lat[first + i] = HUGE_VAL;
+                            result = false;
+                        }
+                    });
+            });
+
+        return result;
+    }
+
+    /// Inverse projection of count points stored in an array,
+    /// from Cartesian to Latitude-Longitude, see forward() for arrays
+    /// of coordinates.
+    template <typename XY, typename LL>
+    inline bool inverse(XY const* xy, LL* ll,
+                        std::size_t count, std::size_t threads = 1) const
+    {
+        concepts::check_concepts_and_equal_dimensions<XY const, LL>();
+
+        typedef typename projections::detail::promote_to_double<CT>::type calc_t;
+
+        auto const& prj = base_t::proj();
+        std::atomic<bool> result(true);
+
+        projections::detail::for_each_batch(count, threads,
+            [&](std::size_t first, std::size_t n)
+            {
+                projections::detail::pj_inv_n(prj, prj.params(), n,
+                    [&](std::size_t i, calc_t& v0, calc_t& v1)
+                    {
+                        v0 = geometry::get<0>(xy[first + i]);
+                        v1 = geometry::get<1>(xy[first + i]);
+                        return ! is_invalid_point(xy[first + i]);
+                    },
+                    [&](std::size_t i, calc_t const& lp_lon, calc_t const& lp_lat, int error)
+                    {
+                        LL& p = ll[first + i];
+                        projections::detail::copy_higher_dimensions<2>(xy[first + i], p);
+                        if (error == 0)
+                        {
+                            geometry::set_from_radian<0>(p, lp_lon);
+                            geometry::set_from_radian<1>(p, lp_lat);
+                        }
+                        else
+                        {
+                            set_invalid_point(p);
+                            result = false;
+                        }
+                    });
+            });
+
+        return result;
+    }
 };
 
 } // namespace projections
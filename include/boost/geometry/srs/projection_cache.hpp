@@ -0,0 +1,250 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_SRS_PROJECTION_CACHE_HPP
+#define BOOST_GEOMETRY_SRS_PROJECTION_CACHE_HPP
+
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/srs/projection.hpp>
+#include <boost/geometry/srs/projections/epsg_params.hpp>
+#include <boost/geometry/srs/projections/esri_params.hpp>
+#include <boost/geometry/srs/projections/iau2000_params.hpp>
+#include <boost/geometry/srs/projections/proj4.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace srs
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+struct proj4_cache_token
+{
+    char const* first;
+    char const* name_last;
+    char const* last;
+};
+
+// The parameters sorted by name, the order of parameters with the same name
+// is kept because the first one is used. The parameters are separated the
+// same way as in proj4_parameters but without copying them.
+inline std::string projection_cache_key(srs::proj4 const& params)
+{
+    std::string const& str = params.str();
+    char const* it = str.data();
+    char const* const end = it + str.size();
+
+    std::vector<proj4_cache_token> tokens;
+    while (it != end)
+    {
+        while (it != end && (*it == '+' || std::isspace(static_cast<unsigned char>(*it))))
+        {
+            ++it;
+        }
+
+        proj4_cache_token token;
+        token.first = it;
+        token.name_last = nullptr;
+        for ( ; it != end && ! (*it == ' ' && it + 1 != end && *(it + 1) == '+') ; ++it)
+        {
+            if (*it == '=' && token.name_last == nullptr)
+            {
+                token.name_last = it;
+            }
+        }
+        token.last = it;
+        while (token.last != token.first
+            && std::isspace(static_cast<unsigned char>(*(token.last - 1))))
+        {
+            --token.last;
+        }
+        if (token.name_last == nullptr || token.name_last > token.last)
+        {
+            token.name_last = token.last;
+        }
+
+        if (token.first != token.last)
+        {
+            tokens.push_back(token);
+        }
+    }
+
+    std::stable_sort(tokens.begin(), tokens.end(),
+                     [](proj4_cache_token const& l, proj4_cache_token const& r)
+                     {
+                         return std::lexicographical_compare(l.first, l.name_last,
+                                                             r.first, r.name_last);
+                     });
+
+    std::string result;
+    result.reserve(str.size() + tokens.size() * 2);
+    for (proj4_cache_token const& token : tokens)
+    {
+        result += '+';
+        result.append(token.first, token.last);
+        result += ' ';
+    }
+    return result;
+}
+
+inline std::string projection_cache_key(srs::epsg const& params)
+{
+    return "EPSG:" + std::to_string(params.code);
+}
+
+inline std::string projection_cache_key(srs::esri const& params)
+{
+    return "ESRI:" + std::to_string(params.code);
+}
+
+inline std::string projection_cache_key(srs::iau2000 const& params)
+{
+    return "IAU2000:" + std::to_string(params.code);
+}
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+    \brief Bounded cache of initialized dynamic projections
+    \details Projections are identified by proj4 definitions, normalized
+        so the order of parameters doesn't matter, or by srs::epsg,
+        srs::esri and srs::iau2000 codes. For the codes the corresponding
+        header (e.g. srs/epsg.hpp) has to be included. The returned
+        projections share the initialized state with the cached ones
+        so they are cheap to copy and may be used concurrently.
+        If the cache is full, the least recently used projection is removed.
+        All member functions are thread-safe.
+    \ingroup projection
+    \tparam CT calculation type used internally
+*/
+template <typename CT = double>
+class projection_cache
+{
+public:
+    typedef srs::projection<srs::dynamic, CT> projection_type;
+
+    explicit projection_cache(std::size_t max_size = 256)
+        : m_max_size(max_size)
+    {}
+
+    projection_cache(projection_cache const&) = delete;
+    projection_cache& operator=(projection_cache const&) = delete;
+
+    /// Returns the cached projection or initializes it and adds it
+    /// to the cache. Throws the same exceptions as srs::projection.
+    template <typename Params>
+    projection_type get(Params const& params)
+    {
+        std::string key = detail::projection_cache_key(params);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            projection_type const* found = find(key);
+            if (found != nullptr)
+            {
+                return *found;
+            }
+        }
+
+        // Initialized outside of the lock, if the same projection was added
+        // by another thread in the meantime the one from the cache is used.
+        projection_type proj(params);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        projection_type const* found = find(key);
+        if (found != nullptr)
+        {
+            return *found;
+        }
+
+        m_list.emplace_front(key, proj);
+        try
+        {
+            m_map.emplace(std::move(key), m_list.begin());
+        }
+        catch (...)
+        {
+            m_list.pop_front();
+            throw;
+        }
+
+        while (m_list.size() > m_max_size)
+        {
+            m_map.erase(m_list.back().first);
+            m_list.pop_back();
+        }
+
+        return proj;
+    }
+
+    std::size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_list.size();
+    }
+
+    std::size_t max_size() const
+    {
+        return m_max_size;
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_map.clear();
+        m_list.clear();
+    }
+
+private:
+    typedef std::list<std::pair<std::string, projection_type> > list_type;
+    typedef std::unordered_map<std::string, typename list_type::iterator> map_type;
+
+    // Has to be called with the mutex locked
+    projection_type const* find(std::string const& key)
+    {
+        typename map_type::iterator it = m_map.find(key);
+        if (it == m_map.end())
+        {
+            return nullptr;
+        }
+
+        // Move to the front of the list, the most recently used
+        m_list.splice(m_list.begin(), m_list, it->second);
+        return &(it->second->second);
+    }
+
+    std::size_t const m_max_size;
+    mutable std::mutex m_mutex;
+    list_type m_list;
+    map_type m_map;
+};
+
+
+} // namespace srs
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_SRS_PROJECTION_CACHE_HPP
@@ -32,6 +32,7 @@
 #include <boost/range/size.hpp>
 #include <boost/range/value_type.hpp>
 #include <boost/tuple/tuple.hpp>
+#include <boost/variant/get.hpp>
 #include <boost/variant/variant.hpp>
 
 
@@ -27,6 +27,7 @@ namespace projections { namespace detail
 
 struct grids_tag {};
 struct shared_grids_tag {};
+struct lockfree_grids_tag {};
 
 
 }} // namespace projections::detail
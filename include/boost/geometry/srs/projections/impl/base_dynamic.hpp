@@ -13,9 +13,12 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_IMPL_BASE_DYNAMIC_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_IMPL_BASE_DYNAMIC_HPP
 
+#include <cstddef>
 #include <string>
 
 #include <boost/geometry/srs/projections/exception.hpp>
+#include <boost/geometry/srs/projections/impl/pj_fwd.hpp>
+#include <boost/geometry/srs/projections/impl/pj_inv.hpp>
 #include <boost/geometry/srs/projections/impl/projects.hpp>
 
 namespace boost { namespace geometry { namespace projections
@@ -48,6 +51,20 @@ public :
     /// Inverse projection using x / y and lon / lat
     virtual void inv(P const& par, CT const& xy_x, CT const& xy_y, CT& lp_lon, CT& lp_lat) const = 0;
 
+    /// Forward projection of count points skipping the ones with non-zero errors
+    virtual void fwd_n(P const& par, CT const* lp_lon, CT const* lp_lat, CT* xy_x, CT* xy_y,
+                       int* errors, std::size_t count) const
+    {
+        pj_fwd_kernel_n(*this, par, lp_lon, lp_lat, xy_x, xy_y, errors, count);
+    }
+
+    /// Inverse projection of count points skipping the ones with non-zero errors
+    virtual void inv_n(P const& par, CT const* xy_x, CT const* xy_y, CT* lp_lon, CT* lp_lat,
+                       int* errors, std::size_t count) const
+    {
+        pj_inv_kernel_n(*this, par, xy_x, xy_y, lp_lon, lp_lat, errors, count);
+    }
+
     /// Forward projection, from Latitude-Longitude to Cartesian
     template <typename LL, typename XY>
     inline bool forward(LL const& lp, XY& xy) const
@@ -121,6 +138,12 @@ public:
         prj().fwd(par, lp_lon, lp_lat, xy_x, xy_y);
     }
 
+    virtual void fwd_n(P const& par, CT const* lp_lon, CT const* lp_lat, CT* xy_x, CT* xy_y,
+                       int* errors, std::size_t count) const
+    {
+        pj_fwd_kernel_n(prj(), par, lp_lon, lp_lat, xy_x, xy_y, errors, count);
+    }
+
     virtual void inv(P const& , CT const& , CT const& , CT& , CT& ) const
     {
         BOOST_THROW_EXCEPTION(projection_not_invertible_exception(this->name()));
@@ -151,6 +174,12 @@ public:
     {
         this->prj().inv(par, xy_x, xy_y, lp_lon, lp_lat);
     }
+
+    virtual void inv_n(P const& par, CT const* xy_x, CT const* xy_y, CT* lp_lon, CT* lp_lat,
+                       int* errors, std::size_t count) const
+    {
+        pj_inv_kernel_n(this->prj(), par, xy_x, xy_y, lp_lon, lp_lat, errors, count);
+    }
 };
 
 } // namespace detail
@@ -19,6 +19,7 @@
 #endif // defined(_MSC_VER)
 
 
+#include <cstddef>
 #include <string>
 
 #include <boost/geometry/core/assert.hpp>
@@ -133,6 +134,22 @@ public:
             Prj);
         return false;
     }
+
+    template <typename CT>
+    inline void fwd_n(P const& par, CT const* lp_lon, CT const* lp_lat, CT* xy_x, CT* xy_y,
+                      int* errors, std::size_t count) const
+    {
+        pj_fwd_kernel_n(static_cast<Prj const&>(*this), par,
+                        lp_lon, lp_lat, xy_x, xy_y, errors, count);
+    }
+
+    template <typename CT>
+    inline void inv_n(P const&, CT const*, CT const*, CT*, CT*, int*, std::size_t) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT_FALSE(
+            "This projection is not invertable.",
+            Prj);
+    }
 };
 
 // Forward/inverse
@@ -159,6 +176,14 @@ public:
             return false;
         }
     }
+
+    template <typename CT>
+    inline void inv_n(P const& par, CT const* xy_x, CT const* xy_y, CT* lp_lon, CT* lp_lat,
+                      int* errors, std::size_t count) const
+    {
+        pj_inv_kernel_n(static_cast<Prj const&>(*this), par,
+                        xy_x, xy_y, lp_lon, lp_lat, errors, count);
+    }
 };
 
 } // namespace detail
@@ -265,10 +265,10 @@ inline pj_gi * find_grid(T const& lam,
     return gip;
 }
 
-template <typename T>
+template <typename T, typename GridInfo>
 inline pj_gi * find_grid(T const& lam,
                          T const& phi,
-                         pj_gridinfo & grids,
+                         GridInfo & grids,
                          std::vector<std::size_t> const& gridindexes)
 {
     pj_gi * gip = NULL;
@@ -480,6 +480,78 @@ inline bool pj_apply_gridshift_3(StreamPolicy const& stream_policy,
     return true;
 }
 
+// Generic stream policy and lock-free shared grids
+template <bool Inverse, typename CalcT, typename StreamPolicy, typename Range, typename LockFreeGrids>
+inline bool pj_apply_gridshift_3(StreamPolicy const& stream_policy,
+                                 Range & range,
+                                 LockFreeGrids & grids,
+                                 std::vector<std::size_t> const& gridindexes,
+                                 lockfree_grids_tag)
+{
+    typedef typename boost::range_size<Range>::type size_type;
+
+    // If the grids are empty the indexes are as well
+    if (gridindexes.empty())
+    {
+        //pj_ctx_set_errno(ctx, PJD_ERR_FAILED_TO_LOAD_GRID);
+        //return PJD_ERR_FAILED_TO_LOAD_GRID;
+        return false;
+    }
+
+    // The published grids are never modified, only the conversion matrices
+    // are loaded once, so no lock is needed after that.
+    typename LockFreeGrids::published_type const& gridinfo = grids.published();
+
+    size_type point_count = boost::size(range);
+
+    for (size_type i = 0 ; i < point_count ; ++i)
+    {
+        typename boost::range_reference<Range>::type
+            point = range::at(range, i);
+
+        CalcT in_lon = geometry::get_as_radian<0>(point);
+        CalcT in_lat = geometry::get_as_radian<1>(point);
+
+        pj_gi * gip = find_grid(in_lon, in_lat, gridinfo, gridindexes);
+
+        if (gip == NULL)
+        {
+            continue;
+        }
+
+        if (! gip->loaded.get())
+        {
+            typename LockFreeGrids::write_locked lck_grids(grids);
+
+            // check again in case other thread already loaded the grid.
+            if (! gip->loaded.get())
+            {
+                if (! load_grid(stream_policy, *gip))
+                {
+                    continue;
+                }
+
+                gip->loaded.set();
+            }
+        }
+
+        // TODO: use set_invalid_point() or similar mechanism
+        CalcT out_lon = HUGE_VAL;
+        CalcT out_lat = HUGE_VAL;
+
+        nad_cvt<Inverse>(in_lon, in_lat, out_lon, out_lat, *gip);
+
+        // TODO: check differently
+        if (out_lon != HUGE_VAL)
+        {
+            geometry::set_from_radian<0>(point, out_lon);
+            geometry::set_from_radian<1>(point, out_lat);
+        }
+    }
+
+    return true;
+}
+
 
 /************************************************************************/
 /*                        pj_apply_gridshift_2()                        */
@@ -39,10 +39,17 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_IMPL_PJ_FWD_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_IMPL_PJ_FWD_HPP
 
+#include <algorithm>
+#include <cstddef>
+
+#include <boost/core/no_exceptions_support.hpp>
+
 #include <boost/geometry/core/radian_access.hpp>
 #include <boost/geometry/util/math.hpp>
 
+#include <boost/geometry/srs/projections/exception.hpp>
 #include <boost/geometry/srs/projections/impl/adjlon.hpp>
+#include <boost/geometry/srs/projections/impl/pj_strerrno.hpp>
 #include <boost/geometry/srs/projections/impl/projects.hpp>
 
 #include <boost/math/constants/constants.hpp>
@@ -53,28 +60,25 @@ namespace boost { namespace geometry { namespace projections {
 
 namespace detail {
 
-/* forward projection entry */
-template <typename Prj, typename LL, typename XY, typename P>
-inline void pj_fwd(Prj const& prj, P const& par, LL const& ll, XY& xy)
+// Checks and adjusts the longitude and latitude in radians before they are
+// passed into the projection. Returns the error code or 0 if the point can
+// be projected.
+template <typename P, typename T>
+inline int pj_fwd_prepare(P const& par, T& lp_lon, T& lp_lat)
 {
-    typedef typename P::type calc_t;
-    static const calc_t EPS = 1.0e-12;
+    static const T EPS = 1.0e-12;
 
-    using namespace detail;
-
-    calc_t lp_lon = geometry::get_as_radian<0>(ll);
-    calc_t lp_lat = geometry::get_as_radian<1>(ll);
-    calc_t const t = geometry::math::abs(lp_lat) - geometry::math::half_pi<calc_t>();
+    T const t = geometry::math::abs(lp_lat) - geometry::math::half_pi<T>();
 
     /* check for forward and latitude or longitude overange */
     if (t > EPS || geometry::math::abs(lp_lon) > 10.)
     {
-        BOOST_THROW_EXCEPTION( projection_exception(error_lat_or_lon_exceed_limit) );
+        return error_lat_or_lon_exceed_limit;
     }
 
     if (geometry::math::abs(t) <= EPS)
     {
-        lp_lat = lp_lat < 0. ? -geometry::math::half_pi<calc_t>() : geometry::math::half_pi<calc_t>();
+        lp_lat = lp_lat < 0. ? -geometry::math::half_pi<T>() : geometry::math::half_pi<T>();
     }
     else if (par.geoc)
     {
@@ -87,18 +91,134 @@ inline void pj_fwd(Prj const& prj, P const& par, LL const& ll, XY& xy)
         lp_lon = adjlon(lp_lon); /* post_forward del longitude */
     }
 
+    return 0;
+}
+
+// Scales, offsets and orders the coordinates calculated by the projection.
+template <typename P, typename T>
+inline void pj_fwd_finish(P const& par, T const& x, T const& y, T& res0, T& res1)
+{
+    if (par.axis[0] == 0)
+    {
+        res0 = par.sign[0] * par.fr_meter * (par.a * x + par.x0);
+        res1 = par.sign[1] * par.fr_meter * (par.a * y + par.y0);
+    } else {
+        res1 = par.sign[1] * par.fr_meter * (par.a * x + par.x0);
+        res0 = par.sign[0] * par.fr_meter * (par.a * y + par.y0);
+    }
+}
+
+/* forward projection entry */
+template <typename Prj, typename LL, typename XY, typename P>
+inline void pj_fwd(Prj const& prj, P const& par, LL const& ll, XY& xy)
+{
+    typedef typename P::type calc_t;
+
+    using namespace detail;
+
+    calc_t lp_lon = geometry::get_as_radian<0>(ll);
+    calc_t lp_lat = geometry::get_as_radian<1>(ll);
+
+    int const error = pj_fwd_prepare(par, lp_lon, lp_lat);
+    if (error != 0)
+    {
+        BOOST_THROW_EXCEPTION( projection_exception(error) );
+    }
+
     calc_t x = 0;
     calc_t y = 0;
 
     prj.fwd(par, lp_lon, lp_lat, x, y);
 
-    if (par.axis[0] == 0)
+    calc_t res0 = 0;
+    calc_t res1 = 0;
+    pj_fwd_finish(par, x, y, res0, res1);
+
+    geometry::set<0>(xy, res0);
+    geometry::set<1>(xy, res1);
+}
+
+// Number of points passed into the projection at once by the batch entries
+static const std::size_t pj_batch_size = 64;
+
+// Calls the forward projection for count points, skipping the ones with
+// non-zero error codes. The error codes of points which couldn't be
+// projected are stored in errors and the rest of the points is processed.
+// Exceptions without error code are propagated.
+template <typename Prj, typename P, typename T>
+inline void pj_fwd_kernel_n(Prj const& prj, P const& par,
+                            T const* lp_lon, T const* lp_lat,
+                            T* xy_x, T* xy_y,
+                            int* errors, std::size_t count)
+{
+    std::size_t i = 0;
+    while (i < count)
     {
-        geometry::set<0>(xy, par.sign[0] * par.fr_meter * (par.a * x + par.x0));
-        geometry::set<1>(xy, par.sign[1] * par.fr_meter * (par.a * y + par.y0));
-    } else {
-        geometry::set<1>(xy, par.sign[1] * par.fr_meter * (par.a * x + par.x0));
-        geometry::set<0>(xy, par.sign[0] * par.fr_meter * (par.a * y + par.y0));
+        try
+        {
+            for ( ; i < count ; ++i)
+            {
+                if (errors[i] == 0)
+                {
+                    prj.fwd(par, lp_lon[i], lp_lat[i], xy_x[i], xy_y[i]);
+                }
+            }
+        }
+        catch (projection_exception const& e)
+        {
+            if (e.code() == 0)
+            {
+                BOOST_RETHROW
+            }
+            errors[i++] = e.code();
+        }
+    }
+}
+
+/* batch forward projection entry */
+// The longitude and latitude in radians of the point with index i
+// in [0, count) are read by load(i, lon, lat) which returns false if the
+// point should not be projected. The results are passed into
+// store(i, x, y, error) where error is 0 if the point was projected.
+// The points are passed into the projection in blocks, so in case of
+// dynamic projections a virtual function is called once per block.
+template <typename Prj, typename P, typename Load, typename Store>
+inline void pj_fwd_n(Prj const& prj, P const& par, std::size_t count,
+                     Load && load, Store && store)
+{
+    typedef typename P::type calc_t;
+
+    calc_t lp_lon[pj_batch_size];
+    calc_t lp_lat[pj_batch_size];
+    calc_t xy_x[pj_batch_size];
+    calc_t xy_y[pj_batch_size];
+    int errors[pj_batch_size];
+
+    for (std::size_t first = 0 ; first < count ; first += pj_batch_size)
+    {
+        std::size_t const n = (std::min)(pj_batch_size, count - first);
+
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            errors[i] = load(first + i, lp_lon[i], lp_lat[i])
+                      ? pj_fwd_prepare(par, lp_lon[i], lp_lat[i])
+                      : int(error_lat_or_lon_exceed_limit);
+            xy_x[i] = 0;
+            xy_y[i] = 0;
+        }
+
+        prj.fwd_n(par, lp_lon, lp_lat, xy_x, xy_y, errors, n);
+
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            calc_t res0 = 0;
+            calc_t res1 = 0;
+            if (errors[i] == 0)
+            {
+                pj_fwd_finish(par, xy_x[i], xy_y[i], res0, res1);
+            }
+            store(first + i, res0, res1, errors[i]);
+        }
     }
 }
 
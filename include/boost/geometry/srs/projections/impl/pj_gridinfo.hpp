@@ -49,6 +49,7 @@
 #include <boost/cstdint.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -122,6 +123,45 @@ struct pj_ctable
     }
 };
 
+// Flag set after the conversion matrix of a grid is loaded. It is used to
+// publish the loaded grid to other threads without locking the readers.
+struct pj_gi_loaded_flag
+{
+    pj_gi_loaded_flag()
+        : value(false)
+    {}
+
+    pj_gi_loaded_flag(pj_gi_loaded_flag const& r)
+        : value(r.value.load(std::memory_order_relaxed))
+    {}
+
+    pj_gi_loaded_flag & operator=(pj_gi_loaded_flag const& r)
+    {
+        value.store(r.value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return *this;
+    }
+
+    bool get() const
+    {
+        return value.load(std::memory_order_acquire);
+    }
+
+    void set()
+    {
+        value.store(true, std::memory_order_release);
+    }
+
+    void swap(pj_gi_loaded_flag & r)
+    {
+        bool const v = value.load(std::memory_order_relaxed);
+        value.store(r.value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        r.value.store(v, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<bool> value;
+};
+
 struct pj_gi_load
 {
     enum format_t { missing = 0, ntv1, ntv2, gtx, ctable, ctable2 };
@@ -146,6 +186,8 @@ struct pj_gi_load
 
     pj_ctable ct;
 
+    pj_gi_loaded_flag loaded; // only set by the lock-free shared grids
+
     inline void swap(pj_gi_load & r)
     {
         gridname.swap(r.gridname);
@@ -153,6 +195,7 @@ struct pj_gi_load
         std::swap(grid_offset, r.grid_offset);
         std::swap(must_swap, r.must_swap);
         ct.swap(r.ct);
+        loaded.swap(r.loaded);
     }
 
 };
@@ -64,8 +64,9 @@ namespace detail
 // Originally one function, here divided into several functions
 // with overloads for various types of grids and stream policies
 
+template <typename GridInfo>
 inline bool pj_gridlist_find_all(std::string const& gridname,
-                                 pj_gridinfo const& grids,
+                                 GridInfo const& grids,
                                  std::vector<std::size_t> & gridindexes)
 {
     bool result = false;
@@ -178,6 +179,54 @@ inline bool pj_gridlist_merge_gridfile(std::string const& gridname,
 }
 
 
+// Generic stream policy and lock-free shared grids
+template <typename StreamPolicy, typename LockFreeGrids>
+inline bool pj_gridlist_merge_gridfile(std::string const& gridname,
+                                       StreamPolicy const& stream_policy,
+                                       LockFreeGrids & grids,
+                                       std::vector<std::size_t> & gridindexes,
+                                       lockfree_grids_tag)
+{
+    // Try to find in the published list of loaded grids.  Add all
+    // matching grids as with NTv2 we can get many grids from one
+    // file (one shared gridname).
+    if (pj_gridlist_find_all(gridname, grids.published(), gridindexes))
+        return true;
+
+    // Try to load the named grid.
+    typename StreamPolicy::stream_type is;
+    stream_policy.open(is, gridname);
+
+    pj_gridinfo new_grids;
+
+    if (! pj_gridinfo_init(gridname, is, new_grids))
+    {
+        return false;
+    }
+
+    // Publish the grid now that it is loaded.
+
+    std::size_t orig_size = 0;
+    std::size_t new_size = 0;
+
+    {
+        typename LockFreeGrids::write_locked lck_grids(grids);
+
+        // Try to find in the published list of loaded grids again
+        // in case other thread already added it.
+        if (pj_gridlist_find_all(gridname, lck_grids.published(), gridindexes))
+            return true;
+
+        orig_size = lck_grids.published().size();
+        lck_grids.publish(new_grids);
+        new_size = lck_grids.published().size();
+    }
+
+    pj_gridlist_add_seq_inc(gridindexes, orig_size, new_size);
+
+    return true;
+}
+
 /************************************************************************/
 /*                     pj_gridlist_from_nadgrids()                      */
 /*                                                                      */
@@ -41,7 +41,15 @@
 
 
 
+#include <algorithm>
+#include <cstddef>
+
+#include <boost/core/no_exceptions_support.hpp>
+
+#include <boost/geometry/srs/projections/exception.hpp>
 #include <boost/geometry/srs/projections/impl/adjlon.hpp>
+#include <boost/geometry/srs/projections/impl/pj_fwd.hpp>
+#include <boost/geometry/srs/projections/impl/pj_strerrno.hpp>
 #include <boost/geometry/core/radian_access.hpp>
 #include <boost/geometry/util/math.hpp>
 
@@ -53,41 +61,142 @@ namespace boost { namespace geometry { namespace projections
 namespace detail
 {
 
+// Descales and de-offsets the coordinates before they are passed into
+// the inverse projection.
+template <typename PAR, typename T>
+inline void pj_inv_prepare(PAR const& par, T const& v0, T const& v1, T& xy_x, T& xy_y)
+{
+    /* can't do as much preliminary checking as with forward */
+    /* descale and de-offset */
+    if (par.axis[0] == 1)
+    {
+        xy_x = (v1 * par.to_meter * par.sign[1] - par.x0) * par.ra;
+        xy_y = (v0 * par.to_meter * par.sign[0] - par.y0) * par.ra;
+    } else {
+        xy_x = (v0 * par.to_meter * par.sign[0] - par.x0) * par.ra;
+        xy_y = (v1 * par.to_meter * par.sign[1] - par.y0) * par.ra;
+    }
+}
+
+// Adjusts the longitude and latitude in radians calculated by the projection.
+template <typename PAR, typename T>
+inline void pj_inv_finish(PAR const& par, T& lon, T& lat)
+{
+    static const T EPS = 1.0e-12;
+
+    lon += par.lam0; /* reduce from del lp.lam */
+    if (!par.over)
+        lon = adjlon(lon); /* adjust longitude to CM */
+    if (par.geoc && geometry::math::abs(geometry::math::abs(lat)-geometry::math::half_pi<T>()) > EPS)
+        lat = atan(par.one_es * tan(lat));
+}
+
  /* inverse projection entry */
 template <typename PRJ, typename LL, typename XY, typename PAR>
 inline void pj_inv(PRJ const& prj, PAR const& par, XY const& xy, LL& ll)
 {
     typedef typename PAR::type calc_t;
-    static const calc_t EPS = 1.0e-12;
 
-    /* can't do as much preliminary checking as with forward */
-    /* descale and de-offset */
     calc_t lon = 0;
     calc_t lat = 0;
     calc_t xy_x = 0;
     calc_t xy_y = 0;
 
-    if (par.axis[0] == 1)
-    {
-        xy_x = (geometry::get<1>(xy) * par.to_meter * par.sign[1] - par.x0) * par.ra;
-        xy_y = (geometry::get<0>(xy) * par.to_meter * par.sign[0] - par.y0) * par.ra;
-    } else {
-        xy_x = (geometry::get<0>(xy) * par.to_meter * par.sign[0] - par.x0) * par.ra;
-        xy_y = (geometry::get<1>(xy) * par.to_meter * par.sign[1] - par.y0) * par.ra;
-    }
+    pj_inv_prepare(par, calc_t(geometry::get<0>(xy)), calc_t(geometry::get<1>(xy)),
+                   xy_x, xy_y);
 
     prj.inv(par, xy_x, xy_y, lon, lat); /* inverse project */
 
-    lon += par.lam0; /* reduce from del lp.lam */
-    if (!par.over)
-        lon = adjlon(lon); /* adjust longitude to CM */
-    if (par.geoc && geometry::math::abs(geometry::math::abs(lat)-geometry::math::half_pi<calc_t>()) > EPS)
-        lat = atan(par.one_es * tan(lat));
+    pj_inv_finish(par, lon, lat);
 
     geometry::set_from_radian<0>(ll, lon);
     geometry::set_from_radian<1>(ll, lat);
 }
 
+// Calls the inverse projection for count points, skipping the ones with
+// non-zero error codes. The error codes of points which couldn't be
+// projected are stored in errors and the rest of the points is processed.
+// Exceptions without error code and the exception thrown if the projection
+// is not invertible are propagated.
+template <typename PRJ, typename PAR, typename T>
+inline void pj_inv_kernel_n(PRJ const& prj, PAR const& par,
+                            T const* xy_x, T const* xy_y,
+                            T* lp_lon, T* lp_lat,
+                            int* errors, std::size_t count)
+{
+    std::size_t i = 0;
+    while (i < count)
+    {
+        try
+        {
+            for ( ; i < count ; ++i)
+            {
+                if (errors[i] == 0)
+                {
+                    prj.inv(par, xy_x[i], xy_y[i], lp_lon[i], lp_lat[i]);
+                }
+            }
+        }
+        catch (projection_not_invertible_exception const&)
+        {
+            BOOST_RETHROW
+        }
+        catch (projection_exception const& e)
+        {
+            if (e.code() == 0)
+            {
+                BOOST_RETHROW
+            }
+            errors[i++] = e.code();
+        }
+    }
+}
+
+/* batch inverse projection entry */
+// The coordinates of the point with index i in [0, count) are read by
+// load(i, v0, v1) which returns false if the point should not be
+// projected. The longitude and latitude in radians are passed into
+// store(i, lon, lat, error) where error is 0 if the point was projected.
+// The points are passed into the projection in blocks, see pj_fwd_n().
+template <typename PRJ, typename PAR, typename Load, typename Store>
+inline void pj_inv_n(PRJ const& prj, PAR const& par, std::size_t count,
+                     Load && load, Store && store)
+{
+    typedef typename PAR::type calc_t;
+
+    calc_t xy_x[pj_batch_size];
+    calc_t xy_y[pj_batch_size];
+    calc_t lp_lon[pj_batch_size];
+    calc_t lp_lat[pj_batch_size];
+    int errors[pj_batch_size];
+
+    for (std::size_t first = 0 ; first < count ; first += pj_batch_size)
+    {
+        std::size_t const n = (std::min)(pj_batch_size, count - first);
+
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            calc_t v0 = 0;
+            calc_t v1 = 0;
+            errors[i] = load(first + i, v0, v1) ? 0 : int(error_invalid_x_or_y);
+            pj_inv_prepare(par, v0, v1, xy_x[i], xy_y[i]);
+            lp_lon[i] = 0;
+            lp_lat[i] = 0;
+        }
+
+        prj.inv_n(par, xy_x, xy_y, lp_lon, lp_lat, errors, n);
+
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            if (errors[i] == 0)
+            {
+                pj_inv_finish(par, lp_lon[i], lp_lat[i]);
+            }
+            store(first + i, lp_lon[i], lp_lat[i], errors[i]);
+        }
+    }
+}
+
 } // namespace detail
 }}} // namespace boost::geometry::projections
 
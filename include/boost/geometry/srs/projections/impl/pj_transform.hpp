@@ -46,6 +46,8 @@
 
 #include <boost/geometry/srs/projections/impl/geocent.hpp>
 #include <boost/geometry/srs/projections/impl/pj_apply_gridshift.hpp>
+#include <boost/geometry/srs/projections/impl/pj_fwd.hpp>
+#include <boost/geometry/srs/projections/impl/pj_inv.hpp>
 #include <boost/geometry/srs/projections/impl/projects.hpp>
 #include <boost/geometry/srs/projections/invalid_point.hpp>
 
@@ -204,6 +206,27 @@ static const int transient_error[60] = {
     /* 50 to 59 */ 1, 0, 1, 0, 1, 1, 1, 1, 0, 0 };
 
 
+// Returns true if the error of a point is not critical so the point
+// should be set as invalid instead of failing the whole transformation
+inline bool pj_is_transient_error(int code)
+{
+    return (code == 33 /*EDOM*/ || code == 34 /*ERANGE*/)
+        || (code <= 0
+            && code >= -44
+            && transient_error[-code] != 0);
+}
+
+template <typename Point>
+inline void pj_transform_point_error(Point & point, int code)
+{
+    if (! pj_is_transient_error(code))
+    {
+        BOOST_THROW_EXCEPTION( projection_exception(code) );
+    }
+    set_invalid_point(point);
+}
+
+
 template <typename T, typename Range>
 inline int pj_geocentric_to_geodetic( T const& a, T const& es,
                                       Range & range );
@@ -236,6 +259,7 @@ inline bool pj_transform(SrcPrj const& srcprj, Par const& srcdefn,
 {
     typedef typename boost::range_value<Range>::type point_type;
     typedef typename coordinate_type<point_type>::type coord_t;
+    typedef typename Par::type calc_t;
     static const std::size_t dimension = geometry::dimension<point_type>::value;
     std::size_t point_count = boost::size(range);
     bool result = true;
@@ -357,33 +381,47 @@ inline bool pj_transform(SrcPrj const& srcprj, Par const& srcdefn,
         //else
         {
             /* Fallback to the original PROJ.4 API 2d inversion - inv */
-            for( std::size_t i = 0; i < point_count; i++ )
+            try
             {
-                point_type & point = range::at(range, i);
-
-                if( is_invalid_point(point) )
-                    continue;
-
-                try
+                pj_inv_n(srcprj, srcdefn, point_count,
+                    [&](std::size_t i, calc_t& v0, calc_t& v1)
+                    {
+                        point_type const& point = range::at(range, i);
+                        v0 = geometry::get<0>(point);
+                        v1 = geometry::get<1>(point);
+                        return ! is_invalid_point(point);
+                    },
+                    [&](std::size_t i, calc_t const& lon, calc_t const& lat, int error)
+                    {
+                        point_type & point = range::at(range, i);
+                        if (error == 0)
+                        {
+                            geometry::set_from_radian<0>(point, lon);
+                            geometry::set_from_radian<1>(point, lat);
+                        }
+                        else if (! is_invalid_point(point))
+                        {
+                            pj_transform_point_error(point, error);
+                            result = false;
+                        }
+                    });
+            }
+            catch (projection_exception const& e)
+            {
+                // e.g. thrown for all points if the projection is not invertible
+                if (! pj_is_transient_error(e.code()))
                 {
-                    pj_inv(srcprj, srcdefn, point, point);
+                    BOOST_RETHROW
                 }
-                catch(projection_exception const& e)
+                for (std::size_t i = 0; i < point_count; i++)
                 {
-                    if( (e.code() != 33 /*EDOM*/
-                        && e.code() != 34 /*ERANGE*/ )
-                        && (e.code() > 0
-                            || e.code() < -44 /*|| point_count == 1*/
-                            || transient_error[-e.code()] == 0) ) {
-                        BOOST_RETHROW
-                    } else {
-                        set_invalid_point(point);
-                        result = false;
-                        if (point_count == 1)
-                            return result;
-                    }
+                    set_invalid_point(range::at(range, i));
                 }
+                result = false;
             }
+
+            if (! result && point_count == 1)
+                return result;
         }
     }
 
@@ -531,31 +569,31 @@ inline bool pj_transform(SrcPrj const& srcprj, Par const& srcdefn,
         //}
         //else
         {
-            for(std::size_t i = 0; i < point_count; i++ )
-            {
-                point_type & point = range::at(range, i);
-
-                if( is_invalid_point(point) )
-                    continue;
-
-                try {
-                    pj_fwd(dstprj, dstdefn, point, point);
-                } catch (projection_exception const& e) {
-
-                    if( (e.code() != 33 /*EDOM*/
-                         && e.code() != 34 /*ERANGE*/ )
-                        && (e.code() > 0
-                            || e.code() < -44 /*|| point_count == 1*/
-                            || transient_error[-e.code()] == 0) ) {
-                        BOOST_RETHROW
-                    } else {
-                        set_invalid_point(point);
+            pj_fwd_n(dstprj, dstdefn, point_count,
+                [&](std::size_t i, calc_t& lon, calc_t& lat)
+                {
+                    point_type const& point = range::at(range, i);
+                    lon = geometry::get_as_radian<0>(point);
+                    lat = geometry::get_as_radian<1>(point);
+                    return ! is_invalid_point(point);
+                },
+                [&](std::size_t i, calc_t const& x, calc_t const& y, int error)
+                {
+                    point_type & point = range::at(range, i);
+                    if (error == 0)
+                    {
+                        geometry::set<0>(point, x);
+                        geometry::set<1>(point, y);
+                    }
+                    else if (! is_invalid_point(point))
+                    {
+                        pj_transform_point_error(point, error);
                         result = false;
-                        if (point_count == 1)
-                            return result;
                     }
-                }
-            }
+                });
+
+            if (! result && point_count == 1)
+                return result;
         }
     }
 
@@ -0,0 +1,140 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_SRS_SHARED_GRIDS_LOCKFREE_HPP
+#define BOOST_GEOMETRY_SRS_SHARED_GRIDS_LOCKFREE_HPP
+
+
+#include <boost/geometry/srs/projections/grids.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+namespace boost { namespace geometry
+{
+
+namespace srs
+{
+
+/*!
+\brief Grids shared between threads, the lookups do not lock.
+\details The list of grids is published as an immutable snapshot which is
+    replaced when the grids of a new file are added. The conversion matrix
+    of each grid is loaded when it is needed for the first time and then
+    published with an atomic flag. Only adding files and loading the
+    matrices are serialized by a mutex.
+*/
+class shared_grids_lockfree
+{
+public:
+    // Immutable list of grids, the conversion matrices of the grids are
+    // only modified when they are loaded.
+    class published_type
+    {
+        friend class shared_grids_lockfree;
+
+    public:
+        std::size_t size() const
+        {
+            return m_grids.size();
+        }
+
+        bool empty() const
+        {
+            return m_grids.empty();
+        }
+
+        projections::detail::pj_gi & operator[](std::size_t i) const
+        {
+            return *m_grids[i];
+        }
+
+    private:
+        std::vector<projections::detail::pj_gi *> m_grids;
+    };
+
+    shared_grids_lockfree()
+        : m_published(nullptr)
+    {
+        m_snapshots.emplace_back(new published_type());
+        m_published.store(m_snapshots.back().get(), std::memory_order_release);
+    }
+
+    shared_grids_lockfree(shared_grids_lockfree const&) = delete;
+    shared_grids_lockfree & operator=(shared_grids_lockfree const&) = delete;
+
+    std::size_t size() const
+    {
+        return published().size();
+    }
+
+    bool empty() const
+    {
+        return published().empty();
+    }
+
+    typedef projections::detail::lockfree_grids_tag tag;
+
+    published_type const& published() const
+    {
+        return *m_published.load(std::memory_order_acquire);
+    }
+
+    struct write_locked
+    {
+        write_locked(shared_grids_lockfree & g)
+            : grids(g)
+            , lock(g.m_mutex)
+        {}
+
+        published_type const& published() const
+        {
+            return grids.published();
+        }
+
+        // Moves the grids to the storage and publishes the new snapshot.
+        // The previous snapshots are kept because they may still be used.
+        void publish(projections::detail::pj_gridinfo & new_grids)
+        {
+            std::unique_ptr<published_type> snapshot(new published_type(published()));
+            for (std::size_t i = 0 ; i < new_grids.size() ; ++i)
+            {
+                grids.m_grids.emplace_back(new projections::detail::pj_gi());
+                new_grids[i].swap(*grids.m_grids.back());
+                snapshot->m_grids.push_back(grids.m_grids.back().get());
+            }
+
+            grids.m_snapshots.push_back(std::move(snapshot));
+            grids.m_published.store(grids.m_snapshots.back().get(),
+                                    std::memory_order_release);
+        }
+
+    private:
+        shared_grids_lockfree & grids;
+        std::unique_lock<std::mutex> lock;
+    };
+
+private:
+    std::atomic<published_type const*> m_published;
+    std::vector<std::unique_ptr<projections::detail::pj_gi> > m_grids;
+    std::vector<std::unique_ptr<published_type> > m_snapshots;
+    std::mutex m_mutex;
+};
+
+
+} // namespace srs
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_SRS_SHARED_GRIDS_LOCKFREE_HPP
@@ -0,0 +1,112 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_PARALLEL_HPP
+#define BOOST_GEOMETRY_STRATEGIES_PARALLEL_HPP
+
+
+#include <cstddef>
+
+#include <boost/geometry/util/parallel.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategies
+{
+
+
+/*!
+\brief Umbrella strategy wrapper enabling parallel execution of the parts
+    of algorithms which support it.
+\details The wrapper is derived from the wrapped umbrella strategy so it can
+    be passed wherever the wrapped strategy is expected. Algorithms not
+    supporting parallel execution ignore the number of threads. The results
+    are the same as the results of the sequential execution.
+\tparam Strategy umbrella strategy, e.g. strategies::relate::cartesian<>
+\ingroup strategies
+*/
+template <typename Strategy>
+class parallel
+    : public Strategy
+{
+public:
+    /*!
+    \brief Constructs the strategy.
+    \param threads The number of threads. 0 means hardware concurrency.
+    */
+    explicit parallel(std::size_t threads = 0)
+        : m_threads(threads)
+    {}
+
+    /*!
+    \brief Constructs the strategy.
+    \param strategy The wrapped strategy.
+    \param threads The number of threads. 0 means hardware concurrency.
+    */
+    explicit parallel(Strategy const& strategy, std::size_t threads = 0)
+        : Strategy(strategy)
+        , m_threads(threads)
+    {}
+
+    /*!
+    \brief Returns the number of threads which should be used.
+    */
+    std::size_t threads() const
+    {
+        return geometry::detail::parallel::threads_count(m_threads);
+    }
+
+private:
+    std::size_t m_threads;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Returns the number of threads which should be used by an algorithm called
+// with the strategy. Only the parallel wrapper defines more than one.
+template <typename Strategy>
+inline std::size_t threads(Strategy const&)
+{
+    return 1;
+}
+
+template <typename Strategy>
+inline std::size_t threads(strategies::parallel<Strategy> const& strategy)
+{
+    return strategy.threads();
+}
+
+// Returns the strategy which should be passed into the parts of an algorithm
+// which are already executed in parallel, i.e. the wrapped strategy.
+template <typename Strategy>
+inline Strategy const& sequential(Strategy const& strategy)
+{
+    return strategy;
+}
+
+template <typename Strategy>
+inline Strategy const& sequential(strategies::parallel<Strategy> const& strategy)
+{
+    return strategy;
+}
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+} // namespace strategies
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGIES_PARALLEL_HPP
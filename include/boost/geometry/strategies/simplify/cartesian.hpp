@@ -22,6 +22,7 @@
 #include <boost/geometry/strategies/simplify/services.hpp>
 
 #include <boost/geometry/strategy/cartesian/area.hpp>
+#include <boost/geometry/strategy/cartesian/side_by_triangle.hpp>
 
 #include <boost/geometry/util/type_traits.hpp>
 
@@ -63,6 +64,15 @@ struct cartesian
             >();
     }
 
+    // For visvalingam_whyatt
+    static auto side()
+    {
+        using side_strategy_type
+            = typename strategy::side::services::default_strategy
+                <cartesian_tag, CalculationType>::type;
+        return side_strategy_type();
+    }
+
     // For equals()
     template <typename Geometry1, typename Geometry2>
     static auto relate(Geometry1 const&, Geometry2 const&,
@@ -17,6 +17,7 @@
 
 #include <boost/geometry/strategies/agnostic/simplify_douglas_peucker.hpp>
 #include <boost/geometry/strategies/geographic/distance_cross_track.hpp>
+#include <boost/geometry/strategies/geographic/side.hpp>
 #include <boost/geometry/strategies/spherical/point_in_point.hpp>
 
 #include <boost/geometry/strategy/geographic/area.hpp>
@@ -81,6 +82,15 @@ public:
             >(base_t::m_spheroid);
     }
 
+    // For visvalingam_whyatt
+    auto side() const
+    {
+        return strategy::side::geographic
+            <
+                FormulaPolicy, Spheroid, CalculationType
+            >(base_t::m_spheroid);
+    }
+
     // For equals()
     template <typename Geometry1, typename Geometry2>
     static auto relate(Geometry1 const&, Geometry2 const&,
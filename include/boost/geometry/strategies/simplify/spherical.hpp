@@ -20,6 +20,7 @@
 #include <boost/geometry/strategies/spherical/distance_haversine.hpp>
 #include <boost/geometry/strategies/spherical/distance_cross_track.hpp>
 #include <boost/geometry/strategies/spherical/point_in_point.hpp>
+#include <boost/geometry/strategies/spherical/ssf.hpp>
 
 #include <boost/geometry/strategy/spherical/area.hpp>
 
@@ -81,6 +82,12 @@ public:
             >(base_t::radius());
     }
 
+    // For visvalingam_whyatt
+    static auto side()
+    {
+        return strategy::side::spherical_side_formula<CalculationType>();
+    }
+
     // For equals()
     template <typename Geometry1, typename Geometry2>
     static auto relate(Geometry1 const&, Geometry2 const&,
@@ -0,0 +1,72 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_SIMPLIFY_VISVALINGAM_WHYATT_HPP
+#define BOOST_GEOMETRY_STRATEGIES_SIMPLIFY_VISVALINGAM_WHYATT_HPP
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategies { namespace simplify
+{
+
+
+/*!
+\brief Umbrella strategy wrapper selecting the Visvalingam-Whyatt algorithm
+    for simplify.
+\details The vertices with the smallest effective area, the area of the
+    triangle formed with their neighbours, are removed first. The distance
+    passed into simplify is interpreted as the minimal effective area of
+    the vertices which are kept. If topology is preserved the vertices
+    are not removed if it would create an intersection with any other
+    segment of the geometry, including the segments of other rings
+    of a polygon or a multi_polygon, and the rings are not collapsed.
+\tparam Strategies simplify umbrella strategy, e.g. strategies::simplify::cartesian<>
+\ingroup strategies
+*/
+template <typename Strategies>
+class visvalingam_whyatt
+    : public Strategies
+{
+public:
+    /*!
+    \brief Constructs the strategy.
+    \param preserve_topology Prevents creating intersections and collapsing rings.
+    */
+    explicit visvalingam_whyatt(bool preserve_topology = false)
+        : m_preserve_topology(preserve_topology)
+    {}
+
+    /*!
+    \brief Constructs the strategy.
+    \param strategies The wrapped strategy.
+    \param preserve_topology Prevents creating intersections and collapsing rings.
+    */
+    explicit visvalingam_whyatt(Strategies const& strategies,
+                                bool preserve_topology = false)
+        : Strategies(strategies)
+        , m_preserve_topology(preserve_topology)
+    {}
+
+    bool preserve_topology() const
+    {
+        return m_preserve_topology;
+    }
+
+private:
+    bool m_preserve_topology;
+};
+
+
+}} // namespace strategies::simplify
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGIES_SIMPLIFY_VISVALINGAM_WHYATT_HPP
@@ -0,0 +1,267 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_UTIL_PARALLEL_HPP
+#define BOOST_GEOMETRY_UTIL_PARALLEL_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/core/ignore_unused.hpp>
+
+// Threads are used only if they are supported by the standard library.
+// BOOST_GEOMETRY_NO_THREADS may be defined to force the sequential fallback.
+#if !defined(BOOST_GEOMETRY_NO_THREADS) && defined(BOOST_NO_CXX11_HDR_THREAD)
+#define BOOST_GEOMETRY_NO_THREADS
+#endif
+
+#ifndef BOOST_GEOMETRY_NO_THREADS
+#include <atomic>
+#include <thread>
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace parallel
+{
+
+// Returns the number of threads which should be used if the user requested
+// the number of threads equal to requested. 0 means hardware concurrency.
+inline std::size_t threads_count(std::size_t requested)
+{
+#ifndef BOOST_GEOMETRY_NO_THREADS
+    if (requested == 0)
+    {
+        std::size_t const hc = std::thread::hardware_concurrency();
+        return hc > 0 ? hc : 1;
+    }
+    return requested;
+#else
+    boost::ignore_unused(requested);
+    return 1;
+#endif
+}
+
+// Calls f1() and f2(). If parallel is true f1() is called in a separate thread.
+// Both functions are always called, an exception thrown by any of them
+// is rethrown after both are finished, the one thrown by f1() first.
+template <typename Function1, typename Function2>
+inline void fork_join(Function1 && f1, Function2 && f2, bool parallel)
+{
+#ifndef BOOST_GEOMETRY_NO_THREADS
+    std::thread t;
+    std::exception_ptr e1, e2;
+    if (parallel)
+    {
+        try
+        {
+            t = std::thread([&]()
+            {
+                try { f1(); } catch (...) { e1 = std::current_exception(); }
+            });
+        }
+        catch (...)
+        {
+            // Not possible to create a thread, fall back to sequential calls.
+        }
+    }
+
+    if (t.joinable())
+    {
+        try { f2(); } catch (...) { e2 = std::current_exception(); }
+
+        t.join();
+
+        if (e1) { std::rethrow_exception(e1); }
+        if (e2) { std::rethrow_exception(e2); }
+        return;
+    }
+#else
+    boost::ignore_unused(parallel);
+    std::exception_ptr e1;
+#endif
+
+    try { f1(); } catch (...) { e1 = std::current_exception(); }
+    f2();
+    if (e1) { std::rethrow_exception(e1); }
+}
+
+// Calls f(i) for each i in [0, count) using at most threads threads.
+// Indexes are distributed dynamically so the order of calls is unspecified.
+// After the first exception no more indexes are processed and the exception
+// is rethrown after all threads are finished.
+template <typename Function>
+inline void for_each_index(std::size_t count, std::size_t threads, Function && f)
+{
+#ifndef BOOST_GEOMETRY_NO_THREADS
+    if (threads > count)
+    {
+        threads = count;
+    }
+
+    if (threads > 1)
+    {
+        std::atomic<std::size_t> next(0);
+        std::atomic<bool> failed(false);
+        std::vector<std::exception_ptr> errors(threads);
+
+        auto worker = [&](std::size_t t)
+        {
+            try
+            {
+                for (std::size_t i = next++ ; i < count && ! failed ; i = next++)
+                {
+                    f(i);
+                }
+            }
+            catch (...)
+            {
+                errors[t] = std::current_exception();
+                failed = true;
+            }
+        };
+
+        std::vector<std::thread> workers;
+        try
+        {
+            workers.reserve(threads - 1);
+            for (std::size_t t = 1 ; t < threads ; ++t)
+            {
+                workers.emplace_back(worker, t);
+            }
+        }
+        catch (...)
+        {
+            // Not possible to create more threads, work with the ones
+            // that were created.
+        }
+
+        worker(0);
+
+        for (std::thread & w : workers)
+        {
+            w.join();
+        }
+
+        for (std::exception_ptr const& e : errors)
+        {
+            if (e) { std::rethrow_exception(e); }
+        }
+        return;
+    }
+#else
+    boost::ignore_unused(threads);
+#endif
+
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        f(i);
+    }
+}
+
+// Calls f(i) for i in [0, count) using at most threads threads until f
+// returns false. Returns the smallest i for which f(i) returned false or count.
+// f is called for all indexes smaller than the returned one and possibly
+// for some greater ones. Indexes greater than any index for which f returned
+// false are not processed anymore.
+template <typename Function>
+inline std::size_t find_first_false(std::size_t count, std::size_t threads,
+                                    Function && f)
+{
+#ifndef BOOST_GEOMETRY_NO_THREADS
+    if (threads > 1 && count > 1)
+    {
+        std::atomic<std::size_t> found(count);
+
+        for_each_index(count, threads, [&](std::size_t i)
+        {
+            if (i < found && ! f(i))
+            {
+                std::size_t current = found;
+                while (i < current && ! found.compare_exchange_weak(current, i))
+                {}
+            }
+        });
+
+        return found;
+    }
+#else
+    boost::ignore_unused(threads);
+#endif
+
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        if (! f(i))
+        {
+            return i;
+        }
+    }
+    return count;
+}
+
+// Sorts [first, last) using at most threads threads. The chunks of the range
+// are sorted in parallel and then merged pairwise. Elements which are
+// equivalent can be placed in a different order than by std::sort.
+template <typename RandomIterator, typename Less>
+inline void sort(RandomIterator first, RandomIterator last, Less const& less,
+                 std::size_t threads)
+{
+    std::size_t const min_chunk_size = 4096;
+
+    std::size_t const count = std::distance(first, last);
+    std::size_t const chunks = (std::min)(threads, count / min_chunk_size);
+    if (chunks <= 1)
+    {
+        std::sort(first, last, less);
+        return;
+    }
+
+    std::vector<std::size_t> bounds(chunks + 1);
+    for (std::size_t c = 0 ; c <= chunks ; ++c)
+    {
+        bounds[c] = count * c / chunks;
+    }
+
+    for_each_index(chunks, threads, [&](std::size_t c)
+    {
+        std::sort(first + bounds[c], first + bounds[c + 1], less);
+    });
+
+    for (std::size_t width = 1 ; width < chunks ; width *= 2)
+    {
+        std::size_t const merges = (chunks + 2 * width - 1) / (2 * width);
+        for_each_index(merges, threads, [&](std::size_t m)
+        {
+            std::size_t const lo = m * 2 * width;
+            std::size_t const mid = (std::min)(lo + width, chunks);
+            std::size_t const hi = (std::min)(lo + 2 * width, chunks);
+            if (mid < hi)
+            {
+                std::inplace_merge(first + bounds[lo], first + bounds[mid],
+                                   first + bounds[hi], less);
+            }
+        });
+    }
+}
+
+}} // namespace detail::parallel
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_UTIL_PARALLEL_HPP
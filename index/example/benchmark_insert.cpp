@@ -77,6 +77,72 @@ void test_queries(RT const& t, std::vector< std::pair<float, float> > const& coo
     std::cout << time.count() << " " << temp << '\n';
 }
 
+// Inserts the values one by one and then performs the queries
+template <typename RT>
+void test_inserts(const char * name, std::vector<V> const& values,
+                  std::vector< std::pair<float, float> > const& coords, size_t queries_count)
+{
+    typedef boost::chrono::thread_clock clock_t;
+    typedef boost::chrono::duration<float> dur_t;
+
+    clock_t::time_point start = clock_t::now();
+
+    RT t;
+    for ( size_t i = 0 ; i < values.size() ; ++i )
+    {
+        t.insert(values[i]);
+    }
+
+    BOOST_ASSERT(bgi::detail::rtree::utilities::are_boxes_ok(t));
+    BOOST_ASSERT(bgi::detail::rtree::utilities::are_counts_ok(t));
+    BOOST_ASSERT(bgi::detail::rtree::utilities::are_levels_ok(t));
+
+    dur_t time = clock_t::now() - start;
+    std::cout << name << " insert(" << values.size() << ") - " << time.count() << ", ";
+
+    test_queries(t, coords, queries_count);
+}
+
+// Compares the split algorithms for values inserted in clusters
+void test_clustered_inserts(size_t values_count, size_t queries_count)
+{
+    size_t clusters_count = 100;
+    float max_val = static_cast<float>(values_count / 2);
+    std::vector< std::pair<float, float> > coords;
+    std::vector<V> values;
+
+    {
+        boost::mt19937 rng;
+        boost::uniform_real<float> range(-max_val, max_val);
+        boost::variate_generator<boost::mt19937&, boost::uniform_real<float> > rnd(rng, range);
+        boost::normal_distribution<float> spread(0, max_val / 100);
+        boost::variate_generator<boost::mt19937&, boost::normal_distribution<float> > nrnd(rng, spread);
+
+        std::vector< std::pair<float, float> > centers;
+        for ( size_t i = 0 ; i < clusters_count ; ++i )
+        {
+            centers.push_back(std::make_pair(rnd(), rnd()));
+        }
+
+        // the values of a cluster are inserted one after another
+        coords.reserve(values_count);
+        for ( size_t i = 0 ; i < values_count ; ++i )
+        {
+            std::pair<float, float> const& c = centers[i * clusters_count / values_count];
+            float x = c.first + nrnd();
+            float y = c.second + nrnd();
+            coords.push_back(std::make_pair(x, y));
+            values.push_back(generate_value<V>::apply(x, y));
+        }
+    }
+
+    std::cout << "clustered\n";
+    test_inserts< bgi::rtree<V, bgi::rstar<8, 2> > >("rstar", values, coords, queries_count);
+    test_inserts< bgi::rtree<V, bgi::quadratic<8, 2> > >("quadratic", values, coords, queries_count);
+    test_inserts< bgi::rtree<V, bgi::kmeans<8, 2> > >("kmeans", values, coords, queries_count);
+    std::cout << "------------------------------------------------\n";
+}
+
 //#define BOOST_GEOMETRY_INDEX_BENCHMARK_DEBUG
 
 int main()
@@ -84,6 +150,7 @@ int main()
     //typedef bgi::rtree<V, bgi::linear<4, 2> > RT;
     //typedef bgi::rtree<V, bgi::linear<16, 4> > RT;
     //typedef bgi::rtree<V, bgi::quadratic<4, 2> > RT;
+    //typedef bgi::rtree<V, bgi::kmeans<8, 2> > RT;
     typedef bgi::rtree<V, bgi::rstar<8, 2> > RT;
 
     typedef boost::chrono::thread_clock clock_t;
@@ -127,6 +194,8 @@ int main()
         std::cout << "randomized\n";
     }
 
+    test_clustered_inserts(values_count, queries_count);
+
     for (;;)
     {
         // packing test
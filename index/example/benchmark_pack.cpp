@@ -0,0 +1,173 @@
+// Boost.Geometry Index
+// Additional tests
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the packing algorithms by the time of packing, the time of
+// queries and the number of nodes visited by the queries.
+
+#include <iostream>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+namespace bg = boost::geometry;
+namespace bgi = bg::index;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+typedef bg::model::box<P> B;
+typedef bgi::rtree<B, bgi::rstar<16, 4> > RT;
+
+// Counts the nodes visited by the intersects(B) query
+template <typename MembersHolder>
+struct count_visited
+    : public MembersHolder::visitor_const
+{
+    typedef typename MembersHolder::internal_node internal_node;
+    typedef typename MembersHolder::leaf leaf;
+
+    explicit count_visited(B const& b) : box(b), nodes(0), leafs(0) {}
+
+    void operator()(internal_node const& n)
+    {
+        ++nodes;
+        for (auto const& e : bgi::detail::rtree::elements(n))
+        {
+            if (bg::intersects(e.first, box))
+            {
+                bgi::detail::rtree::apply_visitor(*this, *e.second);
+            }
+        }
+    }
+
+    void operator()(leaf const& )
+    {
+        ++nodes;
+        ++leafs;
+    }
+
+    B box;
+    size_t nodes;
+    size_t leafs;
+};
+
+void test(std::vector< std::pair<float, float> > const& coords, size_t queries_count,
+          bgi::packing_algorithm algorithm, const char * name)
+{
+    typedef boost::chrono::thread_clock clock_t;
+    typedef boost::chrono::duration<float> dur_t;
+    typedef bgi::detail::rtree::utilities::view<RT> RTV;
+
+    std::vector<B> values;
+    values.reserve(coords.size());
+    for (size_t i = 0 ; i < coords.size() ; ++i)
+    {
+        float x = coords[i].first;
+        float y = coords[i].second;
+        values.push_back(B(P(x - 0.5f, y - 0.5f), P(x + 0.5f, y + 0.5f)));
+    }
+
+    clock_t::time_point start = clock_t::now();
+    RT t(values, bgi::packing_parameters(algorithm));
+    dur_t time = clock_t::now() - start;
+    std::cout << name << '\n';
+    std::cout << time << " - pack " << values.size() << '\n';
+
+    std::vector<B> result;
+    result.reserve(100);
+
+    start = clock_t::now();
+    size_t temp = 0;
+    for (size_t i = 0 ; i < queries_count ; ++i)
+    {
+        float x = coords[i].first;
+        float y = coords[i].second;
+        result.clear();
+        t.query(bgi::intersects(B(P(x - 10, y - 10), P(x + 10, y + 10))), std::back_inserter(result));
+        temp += result.size();
+    }
+    time = clock_t::now() - start;
+    std::cout << time << " - query(B) " << queries_count << " found " << temp << '\n';
+
+    size_t nodes = 0, leafs = 0;
+    RTV rtv(t);
+    for (size_t i = 0 ; i < queries_count ; ++i)
+    {
+        float x = coords[i].first;
+        float y = coords[i].second;
+        count_visited<RTV::members_holder> v(B(P(x - 10, y - 10), P(x + 10, y + 10)));
+        rtv.apply_visitor(v);
+        nodes += v.nodes;
+        leafs += v.leafs;
+    }
+    std::cout << "visited nodes " << nodes << " leafs " << leafs << '\n';
+}
+
+void test_all(std::vector< std::pair<float, float> > const& coords, size_t queries_count)
+{
+    test(coords, queries_count, bgi::packing_default, "default");
+    test(coords, queries_count, bgi::packing_str, "str");
+    test(coords, queries_count, bgi::packing_hilbert, "hilbert");
+    std::cout << "------------------------------------------------\n";
+}
+
+int main()
+{
+    size_t values_count = 1000000;
+    size_t queries_count = 100000;
+    size_t clusters_count = 100;
+
+    std::vector< std::pair<float, float> > coords;
+    coords.reserve(values_count);
+
+    boost::mt19937 rng;
+    float max_val = static_cast<float>(values_count / 2);
+
+    // uniformly distributed values as in the other benchmarks
+    {
+        boost::uniform_real<float> range(-max_val, max_val);
+        boost::variate_generator<boost::mt19937&, boost::uniform_real<float> > rnd(rng, range);
+
+        for (size_t i = 0 ; i < values_count ; ++i)
+        {
+            coords.push_back(std::make_pair(rnd(), rnd()));
+        }
+    }
+
+    std::cout << "uniform\n";
+    test_all(coords, queries_count);
+
+    // values clustered around randomly placed centers, e.g. cities
+    {
+        boost::uniform_real<float> range(-max_val, max_val);
+        boost::variate_generator<boost::mt19937&, boost::uniform_real<float> > rnd(rng, range);
+        boost::normal_distribution<float> spread(0, max_val / 100);
+        boost::variate_generator<boost::mt19937&, boost::normal_distribution<float> > nrnd(rng, spread);
+
+        std::vector< std::pair<float, float> > centers;
+        for (size_t i = 0 ; i < clusters_count ; ++i)
+        {
+            centers.push_back(std::make_pair(rnd(), rnd()));
+        }
+
+        coords.clear();
+        for (size_t i = 0 ; i < values_count ; ++i)
+        {
+            std::pair<float, float> const& c = centers[i % clusters_count];
+            coords.push_back(std::make_pair(c.first + nrnd(), c.second + nrnd()));
+        }
+    }
+
+    std::cout << "clustered\n";
+    test_all(coords, queries_count);
+
+    return 0;
+}
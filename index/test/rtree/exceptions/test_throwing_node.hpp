@@ -32,6 +32,9 @@ struct linear_throwing : public linear<MaxElements, MinElements> {};
 template <size_t MaxElements, size_t MinElements>
 struct quadratic_throwing : public quadratic<MaxElements, MinElements> {};
 
+template <size_t MaxElements, size_t MinElements>
+struct kmeans_throwing : public kmeans<MaxElements, MinElements> {};
+
 template <size_t MaxElements, size_t MinElements, size_t OverlapCostThreshold = 0, size_t ReinsertedElements = detail::default_rstar_reinserted_elements_s<MaxElements>::value>
 struct rstar_throwing : public rstar<MaxElements, MinElements, OverlapCostThreshold, ReinsertedElements> {};
 
@@ -61,6 +64,16 @@ struct options_type< quadratic_throwing<MaxElements, MinElements> >
     > type;
 };
 
+template <size_t MaxElements, size_t MinElements>
+struct options_type< kmeans_throwing<MaxElements, MinElements> >
+{
+    typedef options<
+        kmeans_throwing<MaxElements, MinElements>,
+        insert_default_tag, choose_by_content_diff_tag, split_default_tag, kmeans_tag,
+        node_throwing_static_tag
+    > type;
+};
+
 template <size_t MaxElements, size_t MinElements, size_t OverlapCostThreshold, size_t ReinsertedElements>
 struct options_type< rstar_throwing<MaxElements, MinElements, OverlapCostThreshold, ReinsertedElements> >
 {
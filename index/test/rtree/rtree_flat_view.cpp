@@ -0,0 +1,306 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/geometry/index/flat_rtree_view.hpp>
+
+// Buffer aligned as if the data was mapped into memory
+class aligned_buffer
+{
+    struct alignas(16) block { char data[16]; };
+
+public:
+    explicit aligned_buffer(std::string const& str)
+        : m_blocks(str.size() / sizeof(block) + 1)
+        , m_size(str.size())
+    {
+        std::memcpy(m_blocks.data(), str.data(), str.size());
+    }
+
+    void * data() { return m_blocks.data(); }
+    std::size_t size() const { return m_size; }
+
+private:
+    std::vector<block> m_blocks;
+    std::size_t m_size;
+};
+
+template <typename T, typename C>
+void make_indexable(bg::model::point<T, 2, C> & p, int x, int y, int)
+{
+    bg::assign_values(p, x, y);
+}
+
+template <typename T, typename C>
+void make_indexable(bg::model::point<T, 3, C> & p, int x, int y, int z)
+{
+    bg::assign_values(p, x, y, z);
+}
+
+template <typename P>
+void make_indexable(bg::model::box<P> & b, int x, int y, int z)
+{
+    bg::assign_values(b, x, y, x + z % 3, y + z % 5);
+}
+
+template <typename Value>
+bool values_less(Value const& v1, Value const& v2)
+{
+    return v1.second < v2.second;
+}
+
+template <typename Values>
+void check_equal(Values r1, Values r2)
+{
+    std::sort(r1.begin(), r1.end(), values_less<typename Values::value_type>);
+    std::sort(r2.begin(), r2.end(), values_less<typename Values::value_type>);
+    BOOST_CHECK_EQUAL(r1.size(), r2.size());
+    BOOST_CHECK(std::equal(r1.begin(), r1.end(), r2.begin(),
+                           [](typename Values::value_type const& v1,
+                              typename Values::value_type const& v2)
+                           {
+                               return v1.second == v2.second;
+                           }));
+}
+
+template <typename Point, typename Values>
+std::vector<double> distances(Point const& pt, Values const& values)
+{
+    std::vector<double> result;
+    for (auto const& v : values)
+    {
+        result.push_back(bg::comparable_distance(pt, v.first));
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+template <typename Rtree, typename View, typename Predicates>
+void check_query(Rtree const& rt, View const& view, Predicates const& pred)
+{
+    typedef typename Rtree::value_type value_t;
+
+    std::vector<value_t> expected, result, result_it;
+    rt.query(pred, std::back_inserter(expected));
+    BOOST_CHECK_EQUAL(view.query(pred, std::back_inserter(result)), expected.size());
+    std::copy(view.qbegin(pred), view.qend(), std::back_inserter(result_it));
+
+    check_equal(expected, result);
+    check_equal(expected, result_it);
+}
+
+// The k nearest values may be chosen differently among the values with the
+// same distance so only the distances are compared
+template <typename Rtree, typename View, typename Point, typename Predicates>
+void check_nearest(Rtree const& rt, View const& view, Point const& pt, Predicates const& pred)
+{
+    typedef typename Rtree::value_type value_t;
+
+    std::vector<value_t> expected, result, result_it;
+    rt.query(pred, std::back_inserter(expected));
+    BOOST_CHECK_EQUAL(view.query(pred, std::back_inserter(result)), expected.size());
+    std::copy(view.qbegin(pred), view.qend(), std::back_inserter(result_it));
+
+    BOOST_CHECK(distances(pt, expected) == distances(pt, result));
+    BOOST_CHECK(distances(pt, expected) == distances(pt, result_it));
+}
+
+template <typename Indexable, typename Params>
+void test_view(std::size_t count, std::uint32_t quantization_bits)
+{
+    typedef std::pair<Indexable, int> value_t;
+    typedef typename bg::point_type<Indexable>::type point_t;
+    typedef bg::model::box<point_t> box_t;
+
+    std::vector<value_t> values;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        Indexable ind;
+        make_indexable(ind, int(i % 29), int((i * 7) % 31), int((i * 11) % 37));
+        values.push_back(std::make_pair(ind, int(i)));
+    }
+
+    bgi::rtree<value_t, Params> rt(values);
+
+    std::ostringstream oss;
+    std::uint64_t size = bgi::write_flat(oss, rt, quantization_bits);
+    BOOST_CHECK_EQUAL(size, oss.str().size());
+
+    // the quantized boxes take less space
+    if (quantization_bits > 0 && count >= 1000)
+    {
+        std::ostringstream oss_exact;
+        BOOST_CHECK_LT(size, bgi::write_flat(oss_exact, rt));
+    }
+
+    aligned_buffer buffer(oss.str());
+    bgi::flat_rtree_view<value_t> view(buffer.data(), buffer.size());
+
+    BOOST_CHECK_EQUAL(view.size(), rt.size());
+    BOOST_CHECK_EQUAL(view.empty(), rt.empty());
+    if (! rt.empty())
+    {
+        BOOST_CHECK(bg::equals(view.bounds(), rt.bounds()));
+    }
+
+    box_t qbox;
+    make_indexable(qbox.min_corner(), 5, 5, 5);
+    make_indexable(qbox.max_corner(), 15, 15, 15);
+    point_t qpt;
+    make_indexable(qpt, 10, 10, 10);
+
+    check_query(rt, view, bgi::intersects(qbox));
+    check_query(rt, view, bgi::within(qbox));
+    check_query(rt, view, !bgi::intersects(qbox));
+    check_query(rt, view, !bgi::within(qbox));
+    check_query(rt, view, bgi::intersects(qbox) && bgi::satisfies([](value_t const& v) { return v.second % 2 == 0; }));
+    check_nearest(rt, view, qpt, bgi::nearest(qpt, 1));
+    check_nearest(rt, view, qpt, bgi::nearest(qpt, 10));
+    check_nearest(rt, view, qpt, bgi::nearest(qpt, 1000000));
+    check_nearest(rt, view, qpt, bgi::nearest(qpt, 5) && !bgi::intersects(qbox));
+    check_nearest(rt, view, qpt, bgi::nearest(qpt, 5) && !bgi::within(qbox));
+
+    // the values are returned in the order of distance
+    std::vector<value_t> nearest;
+    std::copy(view.qbegin(bgi::nearest(qpt, 20)), view.qend(), std::back_inserter(nearest));
+    for (std::size_t i = 1 ; i < nearest.size() ; ++i)
+    {
+        BOOST_CHECK(bg::comparable_distance(qpt, nearest[i - 1].first)
+                 <= bg::comparable_distance(qpt, nearest[i].first));
+    }
+}
+
+void test_invalid()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef std::pair<point_t, int> value_t;
+
+    std::vector<value_t> values;
+    for (int i = 0 ; i < 100 ; ++i)
+    {
+        values.push_back(std::make_pair(point_t(i, i), i));
+    }
+    bgi::rtree<value_t, bgi::rstar<8> > rt(values);
+    std::ostringstream oss;
+    bgi::write_flat(oss, rt);
+
+    {
+        aligned_buffer buffer(oss.str());
+        BOOST_CHECK_THROW((bgi::flat_rtree_view<value_t>(buffer.data(), buffer.size() - 1)),
+                          std::invalid_argument);
+        BOOST_CHECK_THROW((bgi::flat_rtree_view<value_t>(buffer.data(), 10)),
+                          std::invalid_argument);
+        BOOST_CHECK_THROW((bgi::flat_rtree_view<value_t>(static_cast<char*>(buffer.data()) + 1, buffer.size() - 1)),
+                          std::invalid_argument);
+
+        typedef bg::model::point<float, 2, bg::cs::cartesian> pointf_t;
+        BOOST_CHECK_THROW((bgi::flat_rtree_view<pointf_t>(buffer.data(), buffer.size())),
+                          std::invalid_argument);
+    }
+
+    {
+        std::string str = oss.str();
+        std::swap(str[0], str[3]);
+        aligned_buffer buffer(str);
+        BOOST_CHECK_THROW((bgi::flat_rtree_view<value_t>(buffer.data(), buffer.size())),
+                          std::invalid_argument);
+    }
+
+    {
+        std::ostringstream oss_invalid;
+        BOOST_CHECK_THROW(bgi::write_flat(oss_invalid, rt, 12), std::invalid_argument);
+    }
+
+    // the header of the data with quantized boxes has different offsets
+    {
+        typedef bgi::detail::rtree::flat::header header_t;
+        std::ostringstream oss_quantized;
+        bgi::write_flat(oss_quantized, rt, 8);
+        std::string str = oss_quantized.str();
+        header_t h;
+        std::memcpy(&h, str.data(), sizeof(header_t));
+        h.quantization_bits = 16;
+        std::memcpy(&str[0], &h, sizeof(header_t));
+        aligned_buffer buffer(str);
+        BOOST_CHECK_THROW((bgi::flat_rtree_view<value_t>(buffer.data(), buffer.size())),
+                          std::invalid_argument);
+    }
+
+    // the ranges of children and values of the nodes are out of bounds
+    {
+        typedef bgi::detail::rtree::flat::header header_t;
+        typedef bgi::detail::rtree::flat::node node_t;
+        std::string const str = oss.str();
+        header_t h;
+        std::memcpy(&h, str.data(), sizeof(header_t));
+
+        // the root, an internal node, the last node, a leaf
+        std::size_t const indexes[] = { 0, 1, std::size_t(h.nodes_count - 1) };
+        for (std::size_t i : indexes)
+        {
+            std::size_t const offset = std::size_t(h.nodes_offset) + i * sizeof(node_t);
+            node_t n;
+            std::memcpy(&n, str.data() + offset, sizeof(node_t));
+
+            node_t const corrupted[] = { { n.first, n.count + 1000 },
+                                         { n.first + 1000, n.count },
+                                         { n.first + 1, n.count },
+                                         { n.first, 0 } };
+            for (node_t const& c : corrupted)
+            {
+                std::string s = str;
+                std::memcpy(&s[offset], &c, sizeof(node_t));
+                aligned_buffer buffer(s);
+                BOOST_CHECK_THROW((bgi::flat_rtree_view<value_t>(buffer.data(), buffer.size())),
+                                  std::invalid_argument);
+            }
+        }
+
+        header_t hl = h;
+        hl.leafs_level += 1;
+        std::string s = str;
+        std::memcpy(&s[0], &hl, sizeof(header_t));
+        aligned_buffer buffer(s);
+        BOOST_CHECK_THROW((bgi::flat_rtree_view<value_t>(buffer.data(), buffer.size())),
+                          std::invalid_argument);
+    }
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::point<float, 3, bg::cs::cartesian> point3_t;
+    typedef bg::model::box<point_t> box_t;
+
+    std::size_t const counts[] = { 0, 1, 10, 1000 };
+    std::uint32_t const quantizations[] = { 0, 8, 16 };
+    for (std::size_t count : counts)
+    {
+        for (std::uint32_t bits : quantizations)
+        {
+            test_view<point_t, bgi::linear<4> >(count, bits);
+            test_view<point_t, bgi::rstar<16> >(count, bits);
+            test_view<point3_t, bgi::quadratic<8> >(count, bits);
+            test_view<box_t, bgi::rstar<8> >(count, bits);
+            // nodes with enough children to be scanned in blocks
+            test_view<point_t, bgi::linear<32> >(count, bits);
+            test_view<point3_t, bgi::rstar<32> >(count, bits);
+        }
+    }
+
+    test_invalid();
+
+    return 0;
+}
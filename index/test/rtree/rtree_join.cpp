@@ -0,0 +1,122 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+typedef std::vector<std::pair<std::size_t, std::size_t> > ids_t;
+
+template <typename Rtree1, typename Rtree2, typename JoinPredicate, typename Check>
+void check_join(Rtree1 const& rt1, Rtree2 const& rt2, JoinPredicate const& predicate,
+                Check const& check)
+{
+    typedef typename Rtree1::value_type value1_t;
+    typedef typename Rtree2::value_type value2_t;
+
+    ids_t expected;
+    for (value1_t const& v1 : rt1)
+    {
+        for (value2_t const& v2 : rt2)
+        {
+            if (check(v1.first, v2.first))
+            {
+                expected.push_back(std::make_pair(v1.second, v2.second));
+            }
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+
+    ids_t first_result;
+    for (std::size_t threads = 0 ; threads <= 4 ; ++threads)
+    {
+        std::vector<std::pair<value1_t, value2_t> > result;
+        BOOST_CHECK_EQUAL(bgi::join(rt1, rt2, predicate, std::back_inserter(result), threads),
+                          expected.size());
+
+        ids_t ids;
+        for (auto const& p : result)
+        {
+            ids.push_back(std::make_pair(p.first.second, p.second.second));
+        }
+
+        // the same order regardless of the number of threads
+        if (threads == 0)
+        {
+            first_result = ids;
+        }
+        else
+        {
+            BOOST_CHECK(ids == first_result);
+        }
+
+        std::sort(ids.begin(), ids.end());
+        BOOST_CHECK(ids == expected);
+    }
+}
+
+template <typename Point, typename Params>
+void test_join(std::size_t count1, std::size_t count2)
+{
+    typedef bg::model::box<Point> box_t;
+    typedef std::pair<box_t, std::size_t> box_value_t;
+    typedef std::pair<Point, std::size_t> point_value_t;
+
+    std::vector<box_value_t> boxes;
+    for (std::size_t i = 0 ; i < count1 ; ++i)
+    {
+        double const x = double((i * 7919) % 1000);
+        double const y = double((i * 104729) % 997);
+        box_t b;
+        bg::assign_values(b, x, y, x + double(i % 20), y + double(i % 15));
+        boxes.push_back(std::make_pair(b, i));
+    }
+
+    std::vector<point_value_t> points;
+    for (std::size_t i = 0 ; i < count2 ; ++i)
+    {
+        Point p;
+        bg::assign_values(p, (i * 31) % 1013, (i * 17) % 1009);
+        points.push_back(std::make_pair(p, i));
+    }
+
+    // packed and incrementally built trees of different heights
+    bgi::rtree<box_value_t, Params> const rt1(boxes);
+    bgi::rtree<point_value_t, Params> rt2;
+    rt2.insert(points);
+
+    check_join(rt1, rt2, bgi::join_intersects(),
+               [](box_t const& b, Point const& p) { return bg::intersects(b, p); });
+    check_join(rt2, rt1, bgi::join_intersects(),
+               [](Point const& p, box_t const& b) { return bg::intersects(p, b); });
+    check_join(rt1, rt1, bgi::join_intersects(),
+               [](box_t const& b1, box_t const& b2) { return bg::intersects(b1, b2); });
+
+    check_join(rt1, rt2, bgi::join_within_distance(5.0),
+               [](box_t const& b, Point const& p) { return bg::distance(b, p) <= 5.0; });
+    check_join(rt2, rt2, bgi::join_within_distance(3.0),
+               [](Point const& p1, Point const& p2) { return bg::distance(p1, p2) <= 3.0; });
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::point<float, 2, bg::cs::cartesian> pointf_t;
+
+    test_join<point_t, bgi::linear<16> >(0, 100);
+    test_join<point_t, bgi::linear<16> >(100, 0);
+    test_join<point_t, bgi::linear<16> >(1, 1);
+    test_join<point_t, bgi::quadratic<4> >(50, 3000);
+    test_join<point_t, bgi::rstar<8> >(3000, 50);
+    test_join<pointf_t, bgi::linear<8> >(2000, 2000);
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <vector>
+
+// Inserted values form two distant clusters
+template <typename Params>
+void test_clusters(Params const& params = Params())
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+    typedef std::pair<point_t, int> value_t;
+
+    bgi::rtree<value_t, Params> rt(params);
+    for (int i = 0 ; i < 1000 ; ++i)
+    {
+        double const offset = i % 2 == 0 ? 0 : 1000;
+        rt.insert(std::make_pair(point_t(offset + (i * 7) % 100, (i * 13) % 100), i));
+    }
+
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(rt));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(rt));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(rt));
+
+    std::vector<value_t> result;
+    BOOST_CHECK_EQUAL(rt.query(bgi::intersects(box_t(point_t(0, 0), point_t(100, 100))),
+                               std::back_inserter(result)), 500u);
+    result.clear();
+    BOOST_CHECK_EQUAL(rt.query(bgi::intersects(box_t(point_t(200, 0), point_t(800, 100))),
+                               std::back_inserter(result)), 0u);
+
+    for (int i = 0 ; i < 1000 ; i += 3)
+    {
+        double const offset = i % 2 == 0 ? 0 : 1000;
+        BOOST_CHECK_EQUAL(rt.remove(std::make_pair(point_t(offset + (i * 7) % 100, (i * 13) % 100), i)), 1u);
+    }
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(rt));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(rt));
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::point<double, 3, bg::cs::cartesian> point3_t;
+    typedef bg::model::box<point_t> box_t;
+    typedef bg::model::segment<point_t> segment_t;
+
+    testset::modifiers<point_t>(bgi::kmeans<5, 2>(), std::allocator<int>());
+    testset::queries<point_t>(bgi::kmeans<5, 2>(), std::allocator<int>());
+    testset::queries<box_t>(bgi::kmeans<4, 2>(), std::allocator<int>());
+    testset::queries<point3_t>(bgi::dynamic_kmeans(5, 2), std::allocator<int>());
+    testset::queries<segment_t>(bgi::dynamic_kmeans(8), std::allocator<int>());
+    testset::additional<point_t>(bgi::kmeans<5, 2>(), std::allocator<int>());
+
+    test_clusters< bgi::kmeans<8> >();
+    test_clusters(bgi::dynamic_kmeans(16, 4));
+
+    BOOST_CHECK_THROW(bgi::dynamic_kmeans(4, 3), std::invalid_argument);
+
+    return 0;
+}
@@ -0,0 +1,187 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <algorithm>
+#include <vector>
+
+template <typename Value>
+bool values_less(Value const& v1, Value const& v2)
+{
+    return v1.second < v2.second;
+}
+
+template <typename Rtree>
+void check_valid(Rtree const& rt, std::size_t count)
+{
+    BOOST_CHECK_EQUAL(rt.size(), count);
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(rt));
+    if (!rt.empty())
+    {
+        BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(rt));
+        BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(rt));
+    }
+}
+
+template <typename Rtree>
+void check_same(Rtree const& expected, Rtree const& rt)
+{
+    BOOST_CHECK_EQUAL(expected.size(), rt.size());
+    typedef bgi::detail::rtree::utilities::view<Rtree> view_t;
+    BOOST_CHECK_EQUAL(view_t(expected).depth(), view_t(rt).depth());
+
+    // The structure is the same so the values are visited in the same order
+    BOOST_CHECK(std::equal(expected.begin(), expected.end(), rt.begin(),
+                           [](typename Rtree::value_type const& v1,
+                              typename Rtree::value_type const& v2)
+                           {
+                               return bg::equals(v1.first, v2.first)
+                                   && v1.second == v2.second;
+                           }));
+}
+
+template <typename Rtree, typename Predicates>
+void check_query(Rtree const& expected, Rtree const& rt, Predicates const& pred)
+{
+    typedef typename Rtree::value_type value_t;
+
+    std::vector<value_t> r1, r2;
+    expected.query(pred, std::back_inserter(r1));
+    rt.query(pred, std::back_inserter(r2));
+    std::sort(r1.begin(), r1.end(), values_less<value_t>);
+    std::sort(r2.begin(), r2.end(), values_less<value_t>);
+    BOOST_CHECK_EQUAL(r1.size(), r2.size());
+    BOOST_CHECK(std::equal(r1.begin(), r1.end(), r2.begin(),
+                           [](value_t const& v1, value_t const& v2)
+                           {
+                               return v1.second == v2.second;
+                           }));
+}
+
+template <typename Indexable, typename Params>
+void test_rtree(std::size_t count, Params const& params = Params())
+{
+    typedef std::pair<Indexable, std::size_t> value_t;
+    typedef bgi::rtree<value_t, Params> rtree_t;
+    typedef typename bg::coordinate_type<Indexable>::type coord_t;
+    typedef typename bg::point_type<Indexable>::type point_t;
+    typedef bg::model::box<point_t> box_t;
+
+    std::vector<value_t> values;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        // some clustered and duplicated values
+        coord_t x = coord_t((i * 7919) % 1000) / 10;
+        coord_t y = coord_t((i * 104729) % 997) / 10;
+        values.push_back(std::make_pair(generate::outside_point<Indexable>::apply(), i));
+        bg::set<0>(values.back().first, x);
+        bg::set<1>(values.back().first, y);
+    }
+
+    rtree_t expected(values, params);
+
+    // the other coordinates are the same as the coordinates of the values
+    point_t lo = generate::outside_point<point_t>::apply();
+    point_t hi = lo;
+    bg::set<0>(lo, 20);
+    bg::set<1>(lo, 30);
+    bg::set<0>(hi, 45);
+    bg::set<1>(hi, 50);
+    box_t qbox(lo, hi);
+
+    bgi::packing_algorithm const algorithms[] = { bgi::packing_default, bgi::packing_str, bgi::packing_hilbert };
+    for (bgi::packing_algorithm algorithm : algorithms)
+    {
+        rtree_t rt(values, bgi::packing_parameters(algorithm), params);
+        check_valid(rt, count);
+        check_query(expected, rt, bgi::intersects(qbox));
+        check_query(expected, rt, !bgi::intersects(qbox));
+
+        if (algorithm == bgi::packing_default)
+        {
+            check_same(expected, rt);
+        }
+
+        // The tree created in parallel is the same
+        for (std::size_t threads = 2 ; threads <= 5 ; threads += 3)
+        {
+            rtree_t rt2(values.begin(), values.end(), bgi::packing_parameters(threads, algorithm), params);
+            check_same(rt, rt2);
+        }
+    }
+}
+
+template <typename Params>
+void test_rtree_counts(Params const& params = Params())
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::point<float, 3, bg::cs::cartesian> point3_t;
+
+    std::size_t const counts[] = { 0, 1, 4, 17, 177, 1000, 12345 };
+    for (std::size_t count : counts)
+    {
+        test_rtree<point_t>(count, params);
+        test_rtree<point3_t>(count, params);
+    }
+}
+
+template <typename Point, typename Box>
+std::uint64_t hilbert_index(Point const& pt, Box const& box)
+{
+    return bg::detail::hilbert::point_index(pt, box,
+        bg::detail::hilbert::max_order<bg::dimension<Point>::value>::value);
+}
+
+void test_hilbert_index()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+    typedef bg::model::point<double, 3, bg::cs::cartesian> point3_t;
+    typedef bg::model::box<point3_t> box3_t;
+
+    // The first order curve visits the quadrants in U shape
+    box_t box(point_t(0, 0), point_t(1, 1));
+    std::uint64_t const h00 = hilbert_index(point_t(0.25, 0.25), box);
+    std::uint64_t const h01 = hilbert_index(point_t(0.25, 0.75), box);
+    std::uint64_t const h11 = hilbert_index(point_t(0.75, 0.75), box);
+    std::uint64_t const h10 = hilbert_index(point_t(0.75, 0.25), box);
+    BOOST_CHECK(h00 < h01 && h01 < h11 && h11 < h10);
+
+    BOOST_CHECK_EQUAL(hilbert_index(point_t(0, 0), box), std::uint64_t(0));
+    BOOST_CHECK_EQUAL(hilbert_index(point_t(-1, -1), box), std::uint64_t(0));
+
+    // In 3d the consecutive octants of the first order curve are adjacent
+    box3_t box3(point3_t(0, 0, 0), point3_t(1, 1, 1));
+    std::uint64_t cells[8] = {};
+    for (int i = 0 ; i < 8 ; ++i)
+    {
+        point3_t const pt((i & 1) ? 0.75 : 0.25, (i & 2) ? 0.75 : 0.25, (i & 4) ? 0.75 : 0.25);
+        cells[bg::detail::hilbert::point_index(pt, box3, 1)] = i;
+    }
+    for (int i = 1 ; i < 8 ; ++i)
+    {
+        std::uint64_t const diff = cells[i] ^ cells[i - 1];
+        BOOST_CHECK(diff == 1 || diff == 2 || diff == 4);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_hilbert_index();
+
+    test_rtree_counts< bgi::linear<4> >();
+    test_rtree_counts< bgi::quadratic<5, 2> >();
+    test_rtree_counts< bgi::rstar<16> >();
+
+    test_rtree_counts(bgi::dynamic_linear(4));
+    test_rtree_counts(bgi::dynamic_rstar(16));
+
+    return 0;
+}
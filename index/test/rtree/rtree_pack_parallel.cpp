@@ -0,0 +1,98 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <vector>
+
+template <typename Rtree>
+void check_same(Rtree const& expected, Rtree const& rt)
+{
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(rt));
+    if (!rt.empty())
+    {
+        BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(rt));
+        BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(rt));
+    }
+
+    BOOST_CHECK_EQUAL(expected.size(), rt.size());
+    typedef bgi::detail::rtree::utilities::view<Rtree> view_t;
+    BOOST_CHECK_EQUAL(view_t(expected).depth(), view_t(rt).depth());
+
+    // The structure is the same so the values are visited in the same order
+    BOOST_CHECK(std::equal(expected.begin(), expected.end(), rt.begin(),
+                           [](typename Rtree::value_type const& v1,
+                              typename Rtree::value_type const& v2)
+                           {
+                               return bg::equals(v1.first, v2.first)
+                                   && v1.second == v2.second;
+                           }));
+}
+
+template <typename Indexable, typename Params>
+void test_rtree(std::size_t count, Params const& params = Params())
+{
+    typedef std::pair<Indexable, std::size_t> value_t;
+    typedef bgi::rtree<value_t, Params> rtree_t;
+    typedef typename bg::coordinate_type<Indexable>::type coord_t;
+
+    std::vector<value_t> values;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        // some clustered and duplicated values
+        coord_t x = coord_t((i * 7919) % 1000) / 10;
+        coord_t y = coord_t((i * 104729) % 997) / 10;
+        values.push_back(std::make_pair(generate::outside_point<Indexable>::apply(), i));
+        bg::set<0>(values.back().first, x);
+        bg::set<1>(values.back().first, y);
+    }
+
+    rtree_t expected(values, params);
+
+    for (std::size_t threads = 0 ; threads <= 5 ; ++threads)
+    {
+        rtree_t rt(values.begin(), values.end(), bgi::packing_parameters(threads), params);
+        check_same(expected, rt);
+
+        rtree_t rt2(values, bgi::packing_parameters(threads), params);
+        check_same(expected, rt2);
+    }
+}
+
+template <typename Params>
+void test_rtree_counts(Params const& params = Params())
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::point<float, 3, bg::cs::cartesian> point3_t;
+
+    std::size_t const counts[] = { 0, 1, 4, 17, 177, 1000, 12345 };
+    for (std::size_t count : counts)
+    {
+        test_rtree<point_t>(count, params);
+        test_rtree<point3_t>(count, params);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_rtree_counts< bgi::linear<4> >();
+    test_rtree_counts< bgi::quadratic<5, 2> >();
+    test_rtree_counts< bgi::rstar<16> >();
+
+    test_rtree_counts(bgi::dynamic_linear(4));
+    test_rtree_counts(bgi::dynamic_rstar(16));
+
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef std::pair<point_t, std::size_t> value_t;
+    std::vector<value_t> empty;
+    bgi::rtree<value_t, bgi::linear<4> > rt(empty, bgi::packing_parameters(4));
+    BOOST_CHECK(rt.empty());
+
+    return 0;
+}
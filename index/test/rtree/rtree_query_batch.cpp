@@ -0,0 +1,157 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+template <typename Value>
+bool values_less(Value const& v1, Value const& v2)
+{
+    return v1.second < v2.second;
+}
+
+template <typename Rtree, typename Predicates>
+void check_batch(Rtree const& rt, std::vector<Predicates> const& predicates, bool sort_results)
+{
+    typedef typename Rtree::value_type value_t;
+
+    std::vector<std::vector<value_t> > expected(predicates.size());
+    std::size_t expected_count = 0;
+    for (std::size_t i = 0 ; i < predicates.size() ; ++i)
+    {
+        expected_count += rt.query(predicates[i], std::back_inserter(expected[i]));
+    }
+
+    for (std::size_t threads = 0 ; threads <= 4 ; ++threads)
+    {
+        std::vector<std::vector<value_t> > results(predicates.size());
+        BOOST_CHECK_EQUAL(rt.query_batch(predicates, results, threads), expected_count);
+
+        for (std::size_t i = 0 ; i < predicates.size() ; ++i)
+        {
+            std::vector<value_t> e = expected[i];
+            std::vector<value_t> r = results[i];
+            if (sort_results)
+            {
+                std::sort(e.begin(), e.end(), values_less<value_t>);
+                std::sort(r.begin(), r.end(), values_less<value_t>);
+            }
+            BOOST_CHECK(e.size() == r.size()
+                     && std::equal(e.begin(), e.end(), r.begin(),
+                                   [](value_t const& v1, value_t const& v2)
+                                   {
+                                       return v1.second == v2.second;
+                                   }));
+        }
+    }
+}
+
+template <typename Point, typename Params>
+void test_batch(std::size_t count)
+{
+    typedef std::pair<Point, std::size_t> value_t;
+    typedef bg::model::box<Point> box_t;
+    typedef bgi::rtree<value_t, Params> rtree_t;
+
+    std::vector<value_t> values;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        Point p;
+        bg::assign_values(p, (i * 7919) % 1000, (i * 104729) % 997);
+        values.push_back(std::make_pair(p, i));
+    }
+    rtree_t rt(values);
+
+    std::vector<box_t> boxes;
+    std::vector<Point> points;
+    for (std::size_t i = 0 ; i < 500 ; ++i)
+    {
+        double const x = double((i * 31) % 1100) - 50;
+        double const y = double((i * 17) % 1050) - 50;
+        box_t b;
+        bg::assign_values(b, x, y, x + 30, y + 40);
+        boxes.push_back(b);
+        Point p;
+        bg::assign_values(p, x, y);
+        points.push_back(p);
+    }
+
+    {
+        std::vector<decltype(bgi::intersects(box_t()))> predicates;
+        for (box_t const& b : boxes)
+            predicates.push_back(bgi::intersects(b));
+        check_batch(rt, predicates, true);
+    }
+    {
+        std::vector<decltype(!bgi::within(box_t()))> predicates;
+        for (box_t const& b : boxes)
+            predicates.push_back(!bgi::within(b));
+        check_batch(rt, predicates, true);
+    }
+    {
+        typedef bool (*fun_t)(value_t const&);
+        fun_t fun = [](value_t const& v) { return v.second % 3 == 0; };
+
+        std::vector<decltype(bgi::intersects(box_t()) && bgi::satisfies(fun))> predicates;
+        for (box_t const& b : boxes)
+            predicates.push_back(bgi::intersects(b) && bgi::satisfies(fun));
+        check_batch(rt, predicates, true);
+
+        // the order of predicates without geometries is preserved
+        std::vector<decltype(bgi::satisfies(fun))> predicates2(10, bgi::satisfies(fun));
+        check_batch(rt, predicates2, true);
+    }
+    {
+        std::vector<decltype(bgi::nearest(Point(), 5))> predicates;
+        for (Point const& p : points)
+            predicates.push_back(bgi::nearest(p, 1 + p.template get<0>() / 100));
+        // the nearest values are returned in the same order
+        check_batch(rt, predicates, false);
+    }
+    {
+        std::vector<decltype(bgi::nearest(Point(), 5) && bgi::intersects(box_t()))> predicates;
+        for (std::size_t i = 0 ; i < points.size() ; ++i)
+            predicates.push_back(bgi::nearest(points[i], 3) && bgi::intersects(boxes[i]));
+        check_batch(rt, predicates, false);
+    }
+}
+
+void test_invalid()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef std::pair<point_t, int> value_t;
+    typedef bg::model::box<point_t> box_t;
+
+    bgi::rtree<value_t, bgi::linear<4> > rt;
+    std::vector<decltype(bgi::intersects(box_t()))> predicates(3, bgi::intersects(box_t()));
+    std::vector<std::vector<value_t> > results(2);
+    BOOST_CHECK_THROW(rt.query_batch(predicates, results), std::invalid_argument);
+    results.resize(3);
+    BOOST_CHECK_EQUAL(rt.query_batch(predicates, results), 0u);
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::point<float, 2, bg::cs::cartesian> pointf_t;
+
+    std::size_t const counts[] = { 0, 1, 100, 10000 };
+    for (std::size_t count : counts)
+    {
+        test_batch<point_t, bgi::linear<16> >(count);
+        test_batch<point_t, bgi::rstar<8> >(count);
+        test_batch<pointf_t, bgi::quadratic<4> >(count);
+    }
+
+    test_invalid();
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <sstream>
+#include <vector>
+
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/serialization/split_free.hpp>
+
+#define BOOST_GEOMETRY_INDEX_DETAIL_EXPERIMENTAL_SERIALIZATION
+
+#include <rtree/test_rtree.hpp>
+
+// The tree is saved and loaded with the parameters, the loaded tree
+// has to contain the same values
+template <typename Params>
+void test_round_trip(Params const& params, Params const& other_params)
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::box<point_t> box_t;
+    typedef bgi::rtree<point_t, Params> rtree_t;
+
+    rtree_t rt(params);
+    for (int i = 0 ; i < 1000 ; ++i)
+    {
+        rt.insert(point_t((i * 7) % 100, (i * 13) % 100 + i / 100 * 0.1));
+    }
+
+    std::stringstream ss;
+    {
+        boost::archive::text_oarchive oa(ss);
+        oa << rt;
+    }
+
+    rtree_t loaded(other_params);
+    {
+        boost::archive::text_iarchive ia(ss);
+        ia >> loaded;
+    }
+
+    BOOST_CHECK_EQUAL(loaded.size(), rt.size());
+    BOOST_CHECK_EQUAL(loaded.parameters().get_max_elements(), params.get_max_elements());
+    BOOST_CHECK_EQUAL(loaded.parameters().get_min_elements(), params.get_min_elements());
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(loaded));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(loaded));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(loaded));
+
+    box_t const query(point_t(10, 20), point_t(40, 50));
+    std::vector<point_t> expected, result;
+    rt.query(bgi::intersects(query), std::back_inserter(expected));
+    loaded.query(bgi::intersects(query), std::back_inserter(result));
+    BOOST_CHECK(! expected.empty());
+    basictest::exactly_the_same_outputs(rt, result, expected);
+}
+
+int test_main(int, char* [])
+{
+    test_round_trip(bgi::kmeans<8, 3>(), bgi::kmeans<8, 3>());
+    test_round_trip(bgi::dynamic_kmeans(16, 4), bgi::dynamic_kmeans(8));
+
+    return 0;
+}
@@ -0,0 +1,264 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <boost/geometry/index/snapshot_rtree.hpp>
+
+template <typename Snapshot>
+void check_snapshot(Snapshot const& snapshot, std::vector<std::size_t> ids)
+{
+    typedef typename Snapshot::element_type rtree_t;
+    typedef typename rtree_t::value_type value_t;
+
+    rtree_t const& rt = *snapshot;
+
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(rt));
+    if (! rt.empty())
+    {
+        BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(rt));
+        BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(rt));
+    }
+
+    BOOST_CHECK_EQUAL(rt.size(), ids.size());
+
+    std::vector<value_t> result;
+    rt.query(bgi::satisfies([](value_t const&) { return true; }), std::back_inserter(result));
+
+    std::vector<std::size_t> result_ids;
+    for (value_t const& v : result)
+    {
+        result_ids.push_back(v.second);
+    }
+    std::sort(result_ids.begin(), result_ids.end());
+    std::sort(ids.begin(), ids.end());
+    BOOST_CHECK(result_ids == ids);
+}
+
+template <typename Point, typename Params>
+void test_snapshot(std::size_t count, Params const& params = Params())
+{
+    typedef std::pair<Point, std::size_t> value_t;
+    typedef bgi::snapshot_rtree<value_t, Params> rtree_t;
+    typedef typename rtree_t::snapshot_type snapshot_t;
+    typedef typename bg::coordinate_type<Point>::type coord_t;
+
+    std::vector<value_t> values;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        coord_t x = coord_t((i * 7919) % 1000) / 10;
+        coord_t y = coord_t((i * 104729) % 997) / 10;
+        values.push_back(std::make_pair(generate::outside_point<Point>::apply(), i));
+        bg::set<0>(values.back().first, x);
+        bg::set<1>(values.back().first, y);
+    }
+
+    rtree_t rt(params);
+    BOOST_CHECK(rt.empty());
+
+    std::vector<snapshot_t> snapshots;
+    std::vector<std::vector<std::size_t> > expected;
+    std::vector<std::size_t> ids;
+
+    snapshots.push_back(rt.snapshot());
+    expected.push_back(ids);
+
+    // insert values one by one
+    for (std::size_t i = 0 ; i < count / 2 ; ++i)
+    {
+        rt.insert(values[i]);
+        ids.push_back(i);
+        if (i % 97 == 0)
+        {
+            snapshots.push_back(rt.snapshot());
+            expected.push_back(ids);
+        }
+    }
+
+    // insert a range of values at once
+    rt.insert(values.begin() + count / 2, values.end());
+    for (std::size_t i = count / 2 ; i < count ; ++i)
+    {
+        ids.push_back(i);
+    }
+    snapshots.push_back(rt.snapshot());
+    expected.push_back(ids);
+    BOOST_CHECK_EQUAL(rt.size(), count);
+
+    // a value which is not stored doesn't create a new version
+    {
+        snapshot_t const before = rt.snapshot();
+        value_t missing = values.empty()
+                        ? std::make_pair(generate::outside_point<Point>::apply(), count)
+                        : std::make_pair(values.front().first, count);
+        BOOST_CHECK_EQUAL(rt.remove(missing), 0u);
+        BOOST_CHECK(rt.snapshot() == before);
+    }
+
+    // remove values one by one
+    std::vector<std::size_t> remaining;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        if (i % 3 == 0)
+        {
+            BOOST_CHECK_EQUAL(rt.remove(values[i]), 1u);
+        }
+        else
+        {
+            remaining.push_back(i);
+        }
+
+        if (i % 113 == 0)
+        {
+            snapshots.push_back(rt.snapshot());
+            std::vector<std::size_t> e = remaining;
+            e.insert(e.end(), ids.begin() + i + 1, ids.end());
+            expected.push_back(e);
+        }
+    }
+    ids = remaining;
+    snapshots.push_back(rt.snapshot());
+    expected.push_back(ids);
+
+    // remove a range of values at once
+    std::vector<value_t> to_remove;
+    remaining.clear();
+    for (std::size_t id : ids)
+    {
+        if (id % 2 == 0)
+        {
+            to_remove.push_back(values[id]);
+        }
+        else
+        {
+            remaining.push_back(id);
+        }
+    }
+    BOOST_CHECK_EQUAL(rt.remove(to_remove.begin(), to_remove.end()), to_remove.size());
+    ids = remaining;
+    snapshots.push_back(rt.snapshot());
+    expected.push_back(ids);
+
+    // the old snapshots are not affected by later modifications
+    for (std::size_t i = 0 ; i < snapshots.size() ; ++i)
+    {
+        check_snapshot(snapshots[i], expected[i]);
+    }
+
+    // release some of the snapshots and check the rest
+    for (std::size_t i = 0 ; i < snapshots.size() ; i += 2)
+    {
+        snapshots[i].reset();
+    }
+    for (std::size_t i = 1 ; i < snapshots.size() ; i += 2)
+    {
+        check_snapshot(snapshots[i], expected[i]);
+    }
+
+    snapshot_t const before_clear = rt.snapshot();
+    rt.clear();
+    BOOST_CHECK(rt.empty());
+    check_snapshot(rt.snapshot(), std::vector<std::size_t>());
+    check_snapshot(before_clear, ids);
+
+    // remove all values
+    rt.insert(values.begin(), values.end());
+    BOOST_CHECK_EQUAL(rt.remove(values.begin(), values.end()), count);
+    check_snapshot(rt.snapshot(), std::vector<std::size_t>());
+    check_snapshot(before_clear, ids);
+}
+
+template <typename Point, typename Params>
+void test_concurrent(std::size_t count, std::size_t readers)
+{
+    typedef std::pair<Point, std::size_t> value_t;
+    typedef bgi::snapshot_rtree<value_t, Params> rtree_t;
+    typedef typename rtree_t::snapshot_type snapshot_t;
+    typedef typename bg::coordinate_type<Point>::type coord_t;
+
+    std::vector<value_t> values;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        values.push_back(std::make_pair(Point(coord_t(i % 100), coord_t(i / 100)), i));
+    }
+
+    rtree_t rt;
+    std::atomic<bool> done(false);
+    std::atomic<std::size_t> failures(0);
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0 ; t < readers ; ++t)
+    {
+        threads.emplace_back([&]()
+        {
+            do
+            {
+                snapshot_t const snapshot = rt.snapshot();
+                std::vector<value_t> result;
+                snapshot->query(bgi::satisfies([](value_t const&) { return true; }),
+                                std::back_inserter(result));
+                // the values are inserted and removed in order of ids
+                std::size_t first = count;
+                for (value_t const& v : result)
+                {
+                    first = (std::min)(first, v.second);
+                }
+                bool ok = result.size() == snapshot->size();
+                for (value_t const& v : result)
+                {
+                    ok = ok && v.second < first + result.size();
+                }
+                if (! ok)
+                {
+                    ++failures;
+                }
+            }
+            while (! done);
+        });
+    }
+
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        rt.insert(values[i]);
+    }
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        rt.remove(values[i]);
+    }
+    done = true;
+
+    for (std::thread & t : threads)
+    {
+        t.join();
+    }
+
+    BOOST_CHECK_EQUAL(failures, 0u);
+    BOOST_CHECK(rt.empty());
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::point<float, 2, bg::cs::cartesian> pointf_t;
+
+    test_snapshot<point_t, bgi::linear<4> >(0);
+    test_snapshot<point_t, bgi::linear<4> >(1);
+    test_snapshot<point_t, bgi::linear<4> >(1000);
+    test_snapshot<pointf_t, bgi::quadratic<8> >(2000);
+    test_snapshot<point_t, bgi::rstar<6, 2> >(2000);
+    test_snapshot<point_t, bgi::dynamic_rstar>(1500, bgi::dynamic_rstar(8));
+
+    test_concurrent<point_t, bgi::rstar<8> >(2000, 3);
+
+    return 0;
+}
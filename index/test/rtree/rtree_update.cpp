@@ -0,0 +1,149 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <map>
+#include <vector>
+
+template <typename Rtree, typename Value>
+void check_rtree(Rtree const& rt, std::vector<Value> const& expected)
+{
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(rt));
+    if (! rt.empty())
+    {
+        BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(rt));
+        BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(rt));
+    }
+
+    BOOST_CHECK_EQUAL(rt.size(), expected.size());
+
+    std::map<std::size_t, std::size_t> counts;
+    for (Value const& v : expected)
+    {
+        ++counts[v.second];
+    }
+
+    // every expected value can be found at its position
+    for (Value const& v : expected)
+    {
+        std::vector<Value> result;
+        rt.query(bgi::intersects(v.first), std::back_inserter(result));
+        std::size_t const found = std::count_if(result.begin(), result.end(),
+            [&](Value const& r) { return r.second == v.second && bg::equals(r.first, v.first); });
+        BOOST_CHECK_EQUAL(found, counts[v.second]);
+    }
+}
+
+template <typename Point, typename Params>
+void test_update(std::size_t count, Params const& params = Params())
+{
+    typedef std::pair<Point, std::size_t> value_t;
+    typedef std::pair<value_t, value_t> item_t;
+    typedef bgi::rtree<value_t, Params> rtree_t;
+    typedef typename bg::coordinate_type<Point>::type coord_t;
+
+    std::vector<value_t> values;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        coord_t x = coord_t((i * 7919) % 1000) / 10;
+        coord_t y = coord_t((i * 104729) % 997) / 10;
+        values.push_back(std::make_pair(generate::outside_point<Point>::apply(), i));
+        bg::set<0>(values.back().first, x);
+        bg::set<1>(values.back().first, y);
+    }
+
+    rtree_t rt(params);
+    rt.insert(values.begin(), values.end());
+
+    std::vector<item_t> items;
+    BOOST_CHECK_EQUAL(rt.update(items.begin(), items.end()), 0u);
+    check_rtree(rt, values);
+
+    // small moves, mostly in place
+    for (std::size_t i = 0 ; i < count ; i += 2)
+    {
+        value_t moved = values[i];
+        bg::set<0>(moved.first, bg::get<0>(moved.first) + coord_t(i % 3) / 100);
+        items.push_back(std::make_pair(values[i], moved));
+        values[i] = moved;
+    }
+    // a value which is not stored isn't inserted
+    items.push_back(std::make_pair(std::make_pair(generate::outside_point<Point>::apply(), count),
+                                   std::make_pair(generate::outside_point<Point>::apply(), count)));
+    BOOST_CHECK_EQUAL(rt.update(items.begin(), items.end()), (count + 1) / 2);
+    check_rtree(rt, values);
+
+    // large moves
+    items.clear();
+    for (std::size_t i = 0 ; i < count ; i += 3)
+    {
+        value_t moved = values[i];
+        bg::set<0>(moved.first, coord_t(100) - bg::get<0>(moved.first));
+        bg::set<1>(moved.first, bg::get<1>(moved.first) / 2);
+        items.push_back(std::make_pair(values[i], moved));
+        values[i] = moved;
+    }
+    BOOST_CHECK_EQUAL(bgi::update(rt, items.begin(), items.end()), (count + 2) / 3);
+    check_rtree(rt, values);
+
+    // move all values far away, the structure has to be rebuilt
+    items.clear();
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        value_t moved = values[i];
+        bg::set<0>(moved.first, bg::get<0>(moved.first) + coord_t(1000));
+        items.push_back(std::make_pair(values[i], moved));
+        values[i] = moved;
+    }
+    BOOST_CHECK_EQUAL(rt.update(items.begin(), items.end()), count);
+    check_rtree(rt, values);
+
+    // duplicated values, only one value is replaced for each pair
+    if (count > 0)
+    {
+        rt.insert(values[0]);
+        values.push_back(values[0]);
+
+        items.clear();
+        value_t moved = values[0];
+        bg::set<1>(moved.first, bg::get<1>(moved.first) + coord_t(50));
+        items.push_back(std::make_pair(values[0], moved));
+        items.push_back(std::make_pair(values[0], moved));
+        items.push_back(std::make_pair(values[0], moved));
+        values[0] = moved;
+        values.back() = moved;
+        BOOST_CHECK_EQUAL(rt.update(items.begin(), items.end()), 2u);
+        check_rtree(rt, values);
+    }
+}
+
+template <typename Params>
+void test_update_params(Params const& params = Params())
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+    typedef bg::model::point<float, 2, bg::cs::cartesian> pointf_t;
+
+    std::size_t const counts[] = { 0, 1, 17, 300, 3000 };
+    for (std::size_t count : counts)
+    {
+        test_update<point_t>(count, params);
+        test_update<pointf_t>(count, params);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_update_params<bgi::linear<4> >();
+    test_update_params<bgi::quadratic<8> >();
+    test_update_params<bgi::rstar<6, 2> >();
+    test_update_params<bgi::dynamic_rstar>(bgi::dynamic_rstar(16));
+
+    return 0;
+}
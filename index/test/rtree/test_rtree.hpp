@@ -1132,6 +1132,7 @@ struct within_impl
     static void apply(Rtree const& tree, std::vector<Value> const& input, Box const& qbox)
     {
         std::vector<Value> expected_output;
+        std::vector<Value> expected_not_within;
 
         for (Value const& v : input)
         {
@@ -1139,9 +1140,14 @@ struct within_impl
             {
                 expected_output.push_back(v);
             }
+            else
+            {
+                expected_not_within.push_back(v);
+            }
         }
 
         spatial_query(tree, bgi::within(qbox), expected_output);
+        spatial_query(tree, !bgi::within(qbox), expected_not_within);
 
         /*typedef bg::traits::point_type<Box>::type P;
         bg::model::ring<P> qring;
@@ -0,0 +1,133 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/buffer.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/buffer/cartesian.hpp>
+#include <boost/geometry/strategies/parallel.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+#include "aimes_cases.hpp"
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::multi_linestring<linestring_type> multi_linestring_type;
+typedef bg::model::multi_point<point_type> multi_point_type;
+
+template <typename Geometry>
+std::string to_wkt(Geometry const& geometry)
+{
+    std::ostringstream out;
+    out << std::setprecision(17) << bg::wkt(geometry);
+    return out.str();
+}
+
+// Star-shaped polygons with holes placed in a grid
+multi_polygon_type make_stars(int n, int vertices)
+{
+    double const pi = bg::math::pi<double>();
+
+    multi_polygon_type result;
+    for (int i = 0 ; i < n ; ++i)
+    {
+        for (int j = 0 ; j < n ; ++j)
+        {
+            polygon_type poly;
+            poly.inners().resize(1);
+            for (int k = 0 ; k < vertices ; ++k)
+            {
+                double const a = 2 * pi * k / vertices;
+                double const r = k % 2 == 0 ? 1.4 : 0.8;
+                double const x = i * 3;
+                double const y = j * 3;
+                bg::append(poly.outer(), point_type(x + r * std::cos(a), y + r * std::sin(a)));
+                bg::append(poly.inners()[0], point_type(x + 0.3 * std::cos(a), y + 0.3 * std::sin(a)));
+            }
+            bg::append(poly.outer(), poly.outer().front());
+            bg::append(poly.inners()[0], poly.inners()[0].front());
+            result.push_back(poly);
+        }
+    }
+    bg::correct(result);
+    return result;
+}
+
+template <typename Geometry>
+void test_one(std::string const& caseid, Geometry const& geometry,
+              double distance, std::size_t threads)
+{
+    bg::strategy::buffer::distance_symmetric<double> distance_strategy(distance);
+    bg::strategy::buffer::side_straight side_strategy;
+    bg::strategy::buffer::join_round join_strategy(12);
+    bg::strategy::buffer::end_round end_strategy(12);
+    bg::strategy::buffer::point_circle point_strategy(12);
+
+    typedef bg::strategies::buffer::cartesian<> strategies_type;
+
+    multi_polygon_type expected;
+    bg::buffer(geometry, expected, distance_strategy, side_strategy,
+               join_strategy, end_strategy, point_strategy,
+               strategies_type());
+
+    multi_polygon_type result;
+    bg::buffer(geometry, result, distance_strategy, side_strategy,
+               join_strategy, end_strategy, point_strategy,
+               bg::strategies::parallel<strategies_type>(threads));
+
+    BOOST_CHECK_MESSAGE(! expected.empty(), caseid << " empty");
+    BOOST_CHECK_MESSAGE(to_wkt(expected) == to_wkt(result),
+                        caseid << " threads: " << threads
+                        << " areas: " << bg::area(expected) << " " << bg::area(result));
+}
+
+void test_all(std::size_t threads)
+{
+    multi_linestring_type roads;
+    for (std::string const& wkt : testcases_aimes)
+    {
+        linestring_type ls;
+        bg::read_wkt(wkt, ls);
+        roads.push_back(ls);
+    }
+    test_one("aimes_roads", roads, 0.0005, threads);
+    test_one("aimes_roads_wide", roads, 0.005, threads);
+
+    multi_polygon_type const stars = make_stars(8, 24);
+    test_one("stars_inflate", stars, 0.4, threads);
+    test_one("stars_deflate", stars, -0.1, threads);
+
+    multi_point_type points;
+    for (int i = 0 ; i < 200 ; ++i)
+    {
+        points.push_back(point_type(std::sin(i * 0.7) * 10, std::cos(i * 1.3) * 10));
+    }
+    test_one("points", points, 1.0, threads);
+}
+
+int test_main(int, char* [])
+{
+    test_all(1);
+    test_all(2);
+    test_all(4);
+
+    return 0;
+}
@@ -16,8 +16,11 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <cmath>
 #include <cstddef>
 #include <iterator>
+#include <random>
+#include <sstream>
 #include <string>
 
 #include "test_convex_hull.hpp"
@@ -34,6 +37,10 @@
 #include <boost/geometry/geometries/multi_linestring.hpp>
 #include <boost/geometry/geometries/multi_polygon.hpp>
 
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/strategies/parallel.hpp>
+
 
 
 
@@ -79,11 +86,65 @@ void test_all()
 }
 
 
+// Many points in the interior filtered out before sorting and points
+// on the boundary of the hull which are not its vertices
+template <typename P>
+void test_large()
+{
+    typedef bg::model::multi_point<P> mp;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::strategies::convex_hull::cartesian<> strategy;
+
+    bg::strategies::parallel<strategy> const parallel(4);
+
+    std::mt19937 gen(12345);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    mp disk;
+    for (int i = 0 ; i < 50000 ; i++)
+    {
+        double const a = dist(gen) * bg::math::pi<double>();
+        double const r = std::sqrt(std::fabs(dist(gen)));
+        bg::append(disk, P(r * std::cos(a), r * std::sin(a)));
+    }
+
+    polygon hull, parallel_hull;
+    bg::convex_hull(disk, hull);
+    bg::convex_hull(disk, parallel_hull, parallel);
+
+    std::ostringstream out, parallel_out;
+    out << bg::wkt(hull);
+    parallel_out << bg::wkt(parallel_hull);
+    BOOST_CHECK_EQUAL(out.str(), parallel_out.str());
+    BOOST_CHECK(bg::covered_by(disk, hull));
+
+    // The hull of the vertices of the hull is the same
+    mp vertices(hull.outer().begin(), hull.outer().end() - 1);
+    polygon vertices_hull;
+    bg::convex_hull(vertices, vertices_hull);
+    BOOST_CHECK_EQUAL(bg::num_points(vertices_hull), bg::num_points(hull));
+
+    mp grid;
+    for (int x = 0 ; x <= 100 ; x++)
+    {
+        for (int y = 0 ; y <= 100 ; y++)
+        {
+            bg::append(grid, P(x, y));
+        }
+    }
+    bg::clear(hull);
+    bg::convex_hull(grid, hull, parallel);
+    BOOST_CHECK_EQUAL(bg::num_points(hull), 5u);
+    BOOST_CHECK_CLOSE(bg::area(hull), 10000.0, 0.0001);
+}
+
 int test_main(int, char* [])
 {
     //test_all<bg::model::d2::point_xy<int> >();
     //test_all<bg::model::d2::point_xy<float> >();
     test_all<bg::model::d2::point_xy<double> >();
 
+    test_large<bg::model::d2::point_xy<double> >();
+
     return 0;
 }
@@ -27,6 +27,7 @@
 #include <boost/geometry/algorithms/validity_failure_type.hpp>
 #include <boost/geometry/io/wkt/wkt.hpp>
 
+#include <boost/geometry/strategies/parallel.hpp>
 #include <boost/geometry/strategies/strategies.hpp>
 
 #include <from_wkt.hpp>
@@ -114,6 +115,22 @@ struct test_failure
 
         BOOST_CHECK(detected_msg_short == expected_msg);
 
+        // the same results are expected in parallel mode
+        bg::strategies::parallel<bg::strategies::relate::cartesian<> > const
+            parallel_strategy(4);
+        failure_type detected_parallel;
+        bg::is_valid(geometry, detected_parallel, parallel_strategy);
+        std::string detected_msg_parallel;
+        bg::is_valid(geometry, detected_msg_parallel, parallel_strategy);
+
+        BOOST_CHECK_MESSAGE(detected == detected_parallel,
+            "case id: " << case_id
+            << ", detected: " << to_string(detected)
+            << ", detected in parallel: " << to_string(detected_parallel));
+        BOOST_CHECK_EQUAL(detected_msg, detected_msg_parallel);
+        BOOST_CHECK_EQUAL(bg::is_valid(geometry),
+                          bg::is_valid(geometry, parallel_strategy));
+
 #ifdef BOOST_GEOMETRY_TEST_DEBUG
         std::cout << "----------------------" << std::endl;
         std::cout << std::endl << std::endl;
@@ -938,9 +955,117 @@ void test_open_multipolygons()
     }
 }
 
+// Many polygons so the parts are checked in parallel, failures are placed
+// in several of them to check that the first one is reported
+template <typename Point>
+void test_large_multipolygons()
+{
+    typedef bg::model::polygon<Point> polygon_type;
+    typedef bg::model::multi_polygon<polygon_type> G;
+
+    typedef test_failure<G> test;
+
+    int const n = 40;
+    G mpg;
+    for (int i = 0; i < n; ++i)
+    {
+        for (int j = 0; j < n; ++j)
+        {
+            double const x = 3 * i, y = 3 * j;
+            polygon_type pg;
+            bg::append(pg.outer(), Point(x, y));
+            bg::append(pg.outer(), Point(x, y + 2));
+            bg::append(pg.outer(), Point(x + 2, y + 2));
+            bg::append(pg.outer(), Point(x + 2, y));
+            bg::append(pg.outer(), Point(x, y));
+            pg.inners().resize(1);
+            bg::append(pg.inners()[0], Point(x + 0.5, y + 0.5));
+            bg::append(pg.inners()[0], Point(x + 1.5, y + 0.5));
+            bg::append(pg.inners()[0], Point(x + 1.5, y + 1.5));
+            bg::append(pg.inners()[0], Point(x + 0.5, y + 1.5));
+            bg::append(pg.inners()[0], Point(x + 0.5, y + 0.5));
+            mpg.push_back(pg);
+        }
+    }
+
+    test::apply("mpg_large_valid", mpg, bg::no_failure);
+
+    {
+        // hole crossing the exterior ring in two polygons
+        G invalid = mpg;
+        bg::set<0>(invalid[1000].inners()[0][1], 3 * 25 + 2.5);
+        bg::set<0>(invalid[1000].inners()[0][2], 3 * 25 + 2.5);
+        bg::set<0>(invalid[200].inners()[0][1], 3 * 5 + 2.5);
+        bg::set<0>(invalid[200].inners()[0][2], 3 * 5 + 2.5);
+        test::apply("mpg_large_self_intersections", invalid,
+                    bg::failure_self_intersections);
+    }
+    {
+        // hole outside of the exterior ring in two polygons
+        G invalid = mpg;
+        for (std::size_t i : { std::size_t(1200), std::size_t(300) })
+        {
+            for (Point& p : invalid[i].inners()[0])
+            {
+                bg::set<0>(p, bg::get<0>(p) + 1000);
+            }
+        }
+        test::apply("mpg_large_interior_rings_outside", invalid,
+                    bg::failure_interior_rings_outside);
+    }
+    {
+        // hole touching the exterior ring twice in two polygons
+        G invalid = mpg;
+        for (std::size_t i : { std::size_t(1300), std::size_t(500) })
+        {
+            polygon_type& pg = invalid[i];
+            double const x = bg::get<0>(pg.outer()[0]);
+            double const y = bg::get<1>(pg.outer()[0]);
+            pg.inners()[0].clear();
+            bg::append(pg.inners()[0], Point(x, y + 1));
+            bg::append(pg.inners()[0], Point(x + 1, y + 1));
+            bg::append(pg.inners()[0], Point(x + 1, y + 2));
+            bg::append(pg.inners()[0], Point(x, y + 1));
+        }
+        test::apply("mpg_large_disconnected_interior", invalid,
+                    bg::failure_disconnected_interior);
+    }
+    {
+        // polygon inside the hole of another one
+        G invalid = mpg;
+        polygon_type pg;
+        bg::append(pg.outer(), Point(3 * 30 + 0.75, 3 * 30 + 0.75));
+        bg::append(pg.outer(), Point(3 * 30 + 0.75, 3 * 30 + 1));
+        bg::append(pg.outer(), Point(3 * 30 + 1, 3 * 30 + 1));
+        bg::append(pg.outer(), Point(3 * 30 + 1, 3 * 30 + 0.75));
+        bg::append(pg.outer(), Point(3 * 30 + 0.75, 3 * 30 + 0.75));
+        invalid.push_back(pg);
+        test::apply("mpg_large_valid_inside_hole", invalid, bg::no_failure);
+
+        // polygon overlapping another one
+        bg::set<0>(invalid.back().outer()[2], 3 * 30 + 2.5);
+        bg::set<0>(invalid.back().outer()[3], 3 * 30 + 2.5);
+        test::apply("mpg_large_intersecting_interiors", invalid,
+                    bg::failure_self_intersections);
+
+        bg::set<0>(invalid.back().outer()[2], 3 * 30 + 1);
+        bg::set<0>(invalid.back().outer()[3], 3 * 30 + 1);
+        bg::set<1>(invalid.back().outer()[1], 3 * 30 + 1.2);
+        bg::set<1>(invalid.back().outer()[2], 3 * 30 + 1.2);
+        invalid.back().outer()[0] = Point(3 * 30 + 0.25, 3 * 30 + 0.25);
+        invalid.back().outer()[1] = Point(3 * 30 + 0.25, 3 * 30 + 0.4);
+        invalid.back().outer()[2] = Point(3 * 30 + 0.4, 3 * 30 + 0.4);
+        invalid.back().outer()[3] = Point(3 * 30 + 0.4, 3 * 30 + 0.25);
+        invalid.back().outer()[4] = Point(3 * 30 + 0.25, 3 * 30 + 0.25);
+        test::apply("mpg_large_polygon_inside", invalid,
+                    bg::failure_intersecting_interiors);
+    }
+}
+
 BOOST_AUTO_TEST_CASE( test_failure_multipolygon )
 {
     test_open_multipolygons<point_type>();
+    test_large_multipolygons<point_type>();
 }
 
 BOOST_AUTO_TEST_CASE( test_failure_variant )
@@ -0,0 +1,113 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <vector>
+
+#include <geometry_test_common.hpp>
+#include <star_polygons.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/strategies/parallel.hpp>
+#include <boost/geometry/strategies/relate/cartesian.hpp>
+
+
+template <typename Turns>
+void check_equal_turns(Turns const& expected, Turns const& turns)
+{
+    BOOST_CHECK_EQUAL(expected.size(), turns.size());
+    for (std::size_t i = 0 ; i < expected.size() && i < turns.size() ; ++i)
+    {
+        BOOST_CHECK(bg::get<0>(expected[i].point) == bg::get<0>(turns[i].point));
+        BOOST_CHECK(bg::get<1>(expected[i].point) == bg::get<1>(turns[i].point));
+        BOOST_CHECK(expected[i].method == turns[i].method);
+        for (int j = 0 ; j < 2 ; ++j)
+        {
+            BOOST_CHECK(expected[i].operations[j].seg_id == turns[i].operations[j].seg_id);
+            BOOST_CHECK(expected[i].operations[j].operation == turns[i].operations[j].operation);
+        }
+    }
+}
+
+template <typename Geometry1, typename Geometry2>
+void test_turns(Geometry1 const& g1, Geometry2 const& g2, std::size_t threads)
+{
+    typedef bg::detail::no_rescale_policy rescale_policy_type;
+    typedef typename bg::point_type<Geometry1>::type point_type;
+    typedef typename bg::detail::segment_ratio_type
+        <
+            point_type, rescale_policy_type
+        >::type segment_ratio_type;
+    typedef bg::detail::overlay::turn_info
+        <
+            point_type, segment_ratio_type
+        > turn_info;
+
+    bg::strategies::relate::cartesian<> strategy;
+    bg::strategies::parallel<bg::strategies::relate::cartesian<> > parallel(strategy, threads);
+    bg::detail::get_turns::no_interrupt_policy policy;
+
+    std::vector<turn_info> expected, turns;
+    bg::get_turns
+        <
+            false, false, bg::detail::overlay::assign_null_policy
+        >(g1, g2, strategy, rescale_policy_type(), expected, policy);
+    bg::get_turns
+        <
+            false, false, bg::detail::overlay::assign_null_policy
+        >(g1, g2, parallel, rescale_policy_type(), turns, policy);
+
+    BOOST_CHECK(! expected.empty());
+    check_equal_turns(expected, turns);
+}
+
+template <typename Point>
+void test_all()
+{
+    typedef bg::model::polygon<Point> polygon_type;
+    typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+    typedef bg::model::linestring<Point> linestring_type;
+
+    multi_polygon_type const mp1 = make_star_polygons<multi_polygon_type>(12, 200, 2.0, 0.0);
+    multi_polygon_type const mp2 = make_star_polygons<multi_polygon_type>(12, 150, 2.0, 0.9);
+
+    linestring_type ls1, ls2;
+    for (int i = 0 ; i < 2000 ; ++i)
+    {
+        bg::append(ls1, Point(i * 0.01, i % 2));
+        bg::append(ls2, Point(i * 0.01 + 0.005, (i + 1) % 2));
+    }
+
+    std::size_t const threads[] = { 1, 2, 3, 8 };
+    for (std::size_t t : threads)
+    {
+        test_turns(mp1, mp2, t);
+        test_turns(ls1, ls2, t);
+        test_turns(ls1, mp1, t);
+    }
+
+    // The wrapper may be passed to the algorithms using get_turns
+    multi_polygon_type const small1 = make_star_polygons<multi_polygon_type>(3, 200, 2.0, 0.0);
+    multi_polygon_type const small2 = make_star_polygons<multi_polygon_type>(3, 150, 2.0, 0.9);
+    multi_polygon_type expected, result;
+    bg::intersection(small1, small2, expected);
+    bg::intersection(small1, small2, result,
+        bg::strategies::parallel<bg::strategies::relate::cartesian<> >(4));
+    BOOST_CHECK_EQUAL(expected.size(), result.size());
+    BOOST_CHECK_CLOSE(bg::area(expected), bg::area(result), 0.0001);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
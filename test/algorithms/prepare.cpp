@@ -0,0 +1,154 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+#include <star_polygons.hpp>
+
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/prepare.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/iterators/point_iterator.hpp>
+
+
+// Points in a grid, vertices of the geometry and centers of its edges
+template <typename Point, typename Geometry>
+std::vector<Point> make_points(Geometry const& geometry, double min, double max, int n)
+{
+    std::vector<Point> result;
+    for (int i = 0 ; i <= n ; ++i)
+    {
+        for (int j = 0 ; j <= n ; ++j)
+        {
+            result.push_back(Point(min + (max - min) * i / n,
+                                   min + (max - min) * j / n));
+        }
+    }
+
+    Point const* previous = nullptr;
+    for (auto it = bg::points_begin(geometry) ; it != bg::points_end(geometry) ; ++it)
+    {
+        result.push_back(*it);
+        if (previous != nullptr)
+        {
+            result.push_back(Point((bg::get<0>(*previous) + bg::get<0>(*it)) / 2,
+                                   (bg::get<1>(*previous) + bg::get<1>(*it)) / 2));
+        }
+        previous = &*it;
+    }
+    return result;
+}
+
+template <typename Geometry, typename Point>
+void test_points(Geometry const& geometry, std::vector<Point> const& points)
+{
+    auto const prepared = bg::prepare(geometry);
+
+    for (Point const& p : points)
+    {
+        BOOST_CHECK_EQUAL(bg::within(p, geometry), bg::within(p, prepared));
+        BOOST_CHECK_EQUAL(bg::covered_by(p, geometry), bg::covered_by(p, prepared));
+        BOOST_CHECK_EQUAL(bg::intersects(p, geometry), bg::intersects(p, prepared));
+        BOOST_CHECK_EQUAL(bg::disjoint(prepared, p), bg::disjoint(geometry, p));
+        BOOST_CHECK_EQUAL(bg::relation(p, geometry).str(), bg::relation(p, prepared).str());
+    }
+}
+
+template <typename Geometry, typename Point>
+void test_segments(Geometry const& geometry, std::vector<Point> const& points)
+{
+    typedef bg::model::segment<Point> segment_type;
+    typedef bg::model::linestring<Point> linestring_type;
+
+    auto const prepared = bg::prepare(geometry);
+
+    std::size_t const count = points.size();
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        // neighbouring points and distant ones
+        std::size_t const others[] = { (i + 1) % count, (i + 2) % count,
+                                       (i * 7 + 13) % count };
+        for (std::size_t j : others)
+        {
+            segment_type const s(points[i], points[j]);
+            BOOST_CHECK_EQUAL(bg::intersects(s, geometry), bg::intersects(s, prepared));
+            BOOST_CHECK_EQUAL(bg::disjoint(prepared, s), bg::disjoint(geometry, s));
+        }
+
+        linestring_type ls;
+        ls.push_back(points[i]);
+        ls.push_back(points[(i + 1) % count]);
+        ls.push_back(points[(i * 3 + 5) % count]);
+        BOOST_CHECK_EQUAL(bg::intersects(ls, geometry), bg::intersects(ls, prepared));
+        BOOST_CHECK_EQUAL(bg::disjoint(prepared, ls), bg::disjoint(geometry, ls));
+    }
+}
+
+template <typename Geometry, typename = void>
+struct is_preparable
+    : std::false_type
+{};
+
+template <typename Geometry>
+struct is_preparable<Geometry, decltype(void(bg::prepare(std::declval<Geometry>())))>
+    : std::true_type
+{};
+
+template <typename Polygon>
+void test_polygon()
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+    typedef bg::model::multi_polygon<Polygon> multi_polygon_type;
+
+    // Temporaries can't be prepared
+    BOOST_GEOMETRY_STATIC_ASSERT((is_preparable<Polygon const&>::value),
+        "Expected an lvalue to be preparable", Polygon);
+    BOOST_GEOMETRY_STATIC_ASSERT((! is_preparable<Polygon>::value),
+        "Expected an rvalue not to be preparable", Polygon);
+    BOOST_GEOMETRY_STATIC_ASSERT((! is_preparable<Polygon const>::value),
+        "Expected a const rvalue not to be preparable", Polygon);
+
+    multi_polygon_type const mp = make_star_polygons<multi_polygon_type>(4, 40, 2.0, 0.0, 0.25);
+    std::vector<point_type> const points = make_points<point_type>(mp, -1.5, 8.5, 60);
+
+    test_points(mp, points);
+    test_points(mp.front(), points);
+
+    // Segments are slower, use a part of the points
+    std::vector<point_type> const mp_points = make_points<point_type>(mp, -1.5, 8.5, 15);
+    test_segments(mp, mp_points);
+    test_segments(mp.back(), make_points<point_type>(mp.back(), 4.5, 7.5, 10));
+
+    // Vertical and horizontal edges, segments along the edges
+    Polygon poly;
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 4,2 2),(5 5,8 5,8 8,5 8,5 5))", poly);
+    bg::correct(poly);
+    std::vector<point_type> const poly_points = make_points<point_type>(poly, -1, 11, 24);
+    test_points(poly, poly_points);
+    test_segments(poly, poly_points);
+
+    Polygon empty;
+    test_points(empty, poly_points);
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::d2::point_xy<double> point_type;
+
+    test_polygon<bg::model::polygon<point_type> >();
+    test_polygon<bg::model::polygon<point_type, false> >();
+    test_polygon<bg::model::polygon<point_type, true, false> >();
+
+    return 0;
+}
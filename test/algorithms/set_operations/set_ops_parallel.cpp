@@ -0,0 +1,198 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <iomanip>
+#include <iterator>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+#include <star_polygons.hpp>
+
+#include <boost/geometry/algorithms/difference.hpp>
+#include <boost/geometry/algorithms/detail/overlay/overlay.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/sym_difference.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/parallel.hpp>
+#include <boost/geometry/strategies/relate/cartesian.hpp>
+
+
+template <typename Geometry>
+std::string to_wkt(Geometry const& geometry)
+{
+    std::ostringstream out;
+    out << std::setprecision(20) << bg::wkt(geometry);
+    return out.str();
+}
+
+// The parallel output is identical to the sequential one, including the
+// order of polygons and the starting points of rings
+template <typename MultiPolygon>
+void check_equal(MultiPolygon const& expected, MultiPolygon const& result)
+{
+    BOOST_CHECK_EQUAL(expected.size(), result.size());
+    BOOST_CHECK_EQUAL(to_wkt(expected), to_wkt(result));
+}
+
+template <typename Geometry1, typename Geometry2, typename MultiPolygon>
+void test_operations(Geometry1 const& g1, Geometry2 const& g2, MultiPolygon const&)
+{
+    typedef bg::strategies::relate::cartesian<> strategy_type;
+    typedef bg::strategies::parallel<strategy_type> parallel_type;
+
+    std::size_t const threads[] = { 1, 2, 4 };
+    for (std::size_t t : threads)
+    {
+        MultiPolygon expected, result, result1;
+
+        bg::intersection(g1, g2, expected, strategy_type());
+        bg::intersection(g1, g2, result, parallel_type(t));
+        bg::intersection(g1, g2, result1, parallel_type(1));
+        BOOST_CHECK(! expected.empty());
+        check_equal(expected, result);
+        check_equal(expected, result1);
+
+        expected.clear(); result.clear();
+        bg::union_(g1, g2, expected, strategy_type());
+        bg::union_(g1, g2, result, parallel_type(t));
+        check_equal(expected, result);
+
+        expected.clear(); result.clear();
+        bg::difference(g1, g2, expected, strategy_type());
+        bg::difference(g1, g2, result, parallel_type(t));
+        check_equal(expected, result);
+
+        expected.clear(); result.clear();
+        bg::difference(g2, g1, expected, strategy_type());
+        bg::difference(g2, g1, result, parallel_type(t));
+        check_equal(expected, result);
+
+        expected.clear(); result.clear();
+        bg::sym_difference(g1, g2, expected, strategy_type());
+        bg::sym_difference(g1, g2, result, parallel_type(t));
+        check_equal(expected, result);
+    }
+}
+
+// Records the visited turns and clusters without the cluster ids
+struct recording_visitor
+    : bg::detail::overlay::overlay_null_visitor
+{
+    template <typename Turns>
+    void visit_turns(int phase, Turns const& turns)
+    {
+        std::ostringstream out;
+        out << "turns " << phase << ":";
+        for (auto const& turn : turns)
+        {
+            out << " " << turn.is_clustered();
+            for (auto const& op : turn.operations)
+            {
+                out << "," << op.enriched.travels_to_ip_index
+                    << "," << op.enriched.next_ip_index;
+            }
+        }
+        log.push_back(out.str());
+    }
+
+    template <typename Clusters, typename Turns>
+    void visit_clusters(Clusters const& clusters, Turns const& )
+    {
+        std::vector<std::set<bg::signed_size_type> > indices;
+        for (auto const& item : clusters)
+        {
+            indices.push_back(item.second.turn_indices);
+        }
+        std::sort(indices.begin(), indices.end());
+
+        std::ostringstream out;
+        out << "clusters:";
+        for (auto const& cluster : indices)
+        {
+            out << " (";
+            std::copy(cluster.begin(), cluster.end(),
+                      std::ostream_iterator<bg::signed_size_type>(out, " "));
+            out << ")";
+        }
+        log.push_back(out.str());
+    }
+
+    std::vector<std::string> log;
+};
+
+// The visitor sees the same turns and clusters after the traversal
+template <bg::overlay_type OverlayType, typename Geometry1, typename Geometry2, typename MultiPolygon>
+void test_visitor(Geometry1 const& g1, Geometry2 const& g2, MultiPolygon const&)
+{
+    typedef bg::strategies::relate::cartesian<> strategy_type;
+    typedef bg::strategies::parallel<strategy_type> parallel_type;
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    typedef bg::detail::overlay::overlay
+        <
+            Geometry1, Geometry2, false, OverlayType == bg::overlay_difference, false,
+            polygon_type, OverlayType
+        > overlay_type;
+
+    typedef typename bg::rescale_overlay_policy_type<Geometry1, Geometry2>::type rescale_policy_type;
+    rescale_policy_type const robust_policy
+        = bg::get_rescale_policy<rescale_policy_type>(g1, g2);
+
+    MultiPolygon expected, result;
+    recording_visitor expected_visitor, visitor;
+    overlay_type::apply(g1, g2, robust_policy, std::back_inserter(expected),
+                        strategy_type(), expected_visitor);
+    overlay_type::apply(g1, g2, robust_policy, std::back_inserter(result),
+                        parallel_type(2), visitor);
+
+    check_equal(expected, result);
+
+    // The components are traversed in parallel before the turns are visited
+    // so the visit states are not recorded
+    BOOST_CHECK_EQUAL(visitor.log.size(), expected_visitor.log.size());
+    BOOST_CHECK(visitor.log == expected_visitor.log);
+}
+
+template <typename Point>
+void test_all()
+{
+    typedef bg::model::polygon<Point> polygon_type;
+    typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+    multi_polygon_type const mp1 = make_star_polygons<multi_polygon_type>(6, 40, 3.0, 0.0, 0.2, 7);
+    multi_polygon_type const mp2 = make_star_polygons<multi_polygon_type>(6, 30, 3.0, 0.5, 0.2, 7);
+
+    test_operations(mp1, mp2, multi_polygon_type());
+    test_visitor<bg::overlay_intersection>(mp1, mp2, multi_polygon_type());
+    test_visitor<bg::overlay_union>(mp1, mp2, multi_polygon_type());
+    test_visitor<bg::overlay_difference>(mp1, mp2, multi_polygon_type());
+
+    // A polygon overlapping several members of the multipolygon
+    polygon_type poly;
+    bg::read_wkt("POLYGON((-1 -1,-1 7,7 7,7 -1,-1 -1),(2 2,4 2,4 4,2 4,2 2))", poly);
+    test_operations(poly, mp1, multi_polygon_type());
+    test_operations(mp2, poly, multi_polygon_type());
+
+    // A single component, traversed at once
+    multi_polygon_type big;
+    bg::read_wkt("MULTIPOLYGON(((-1 -1,-1 20,20 20,20 -1,-1 -1)))", big);
+    test_operations(big, mp1, multi_polygon_type());
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
@@ -0,0 +1,163 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/cascaded_union.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/num_geometries.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/parallel.hpp>
+
+
+template <typename Polygon>
+Polygon square(double x, double y, double size)
+{
+    Polygon result;
+    bg::exterior_ring(result) = {{x, y}, {x, y + size}, {x + size, y + size},
+                                 {x + size, y}, {x, y}};
+    return result;
+}
+
+template <typename MultiPolygon, typename Range>
+MultiPolygon iterative_union(Range const& range)
+{
+    MultiPolygon result;
+    for (auto const& g : range)
+    {
+        MultiPolygon temp;
+        bg::union_(result, g, temp);
+        result = std::move(temp);
+    }
+    return result;
+}
+
+template <typename MultiPolygon, typename Range>
+void check(Range const& range, std::string const& name)
+{
+    MultiPolygon const expected = iterative_union<MultiPolygon>(range);
+
+    MultiPolygon result;
+    bg::cascaded_union(range, result);
+
+    BOOST_CHECK_MESSAGE(bg::is_valid(result), name << " is not valid");
+    BOOST_CHECK_EQUAL(bg::num_geometries(result), bg::num_geometries(expected));
+    BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected), 0.0001);
+
+    using strategy_t = bg::strategies::relate::cartesian<>;
+    std::size_t const threads[] = { 1, 3, 0 };
+    for (std::size_t t : threads)
+    {
+        MultiPolygon result_p;
+        bg::cascaded_union(range, result_p, bg::strategies::parallel<strategy_t>(t));
+        // The polygons may be in different order
+        BOOST_CHECK_EQUAL(bg::num_geometries(result_p), bg::num_geometries(result));
+        BOOST_CHECK_MESSAGE(bg::equals(result_p, result),
+            name << " threads: " << t << " " << bg::wkt(result_p));
+    }
+}
+
+template <typename P>
+void test_all()
+{
+    using polygon = bg::model::polygon<P>;
+    using multi_polygon = bg::model::multi_polygon<polygon>;
+
+    // Overlapping squares forming one polygon with holes
+    {
+        std::vector<polygon> polygons;
+        for (int i = 0; i < 12; ++i)
+        {
+            for (int j = 0; j < 12; ++j)
+            {
+                if ((i + j) % 5 != 0)
+                {
+                    polygons.push_back(square<polygon>(i, j, 1.5));
+                }
+            }
+        }
+        check<multi_polygon>(polygons, "overlapping");
+    }
+
+    // Clusters far from each other, unions of their envelopes are skipped
+    {
+        std::vector<polygon> polygons;
+        for (int c = 0; c < 7; ++c)
+        {
+            for (int i = 0; i < 5; ++i)
+            {
+                polygons.push_back(square<polygon>(c * 100 + i, c * 50, 1.5));
+            }
+        }
+        check<multi_polygon>(polygons, "clusters");
+
+        multi_polygon result;
+        bg::cascaded_union(polygons, result);
+        BOOST_CHECK_EQUAL(bg::num_geometries(result), 7u);
+        BOOST_CHECK_CLOSE(bg::area(result), 7 * 5.5 * 1.5, 0.0001);
+    }
+
+    // Multi polygons and empty geometries
+    {
+        std::vector<multi_polygon> multi_polygons(5);
+        for (int i = 0; i < 4; ++i)
+        {
+            multi_polygons[i].push_back(square<polygon>(i, 0, 1.5));
+            multi_polygons[i].push_back(square<polygon>(i, 10, 1.5));
+        }
+        check<multi_polygon>(multi_polygons, "multi");
+
+        multi_polygon result;
+        bg::cascaded_union(multi_polygons, result);
+        BOOST_CHECK_EQUAL(bg::num_geometries(result), 2u);
+    }
+
+    // Touching squares are merged
+    {
+        std::vector<polygon> polygons;
+        for (int i = 0; i < 9; ++i)
+        {
+            polygons.push_back(square<polygon>(i, 0, 1));
+        }
+        check<multi_polygon>(polygons, "touching");
+
+        multi_polygon result;
+        bg::cascaded_union(polygons, result);
+        BOOST_CHECK_EQUAL(bg::num_geometries(result), 1u);
+    }
+
+    // Empty input, the output is cleared
+    {
+        std::vector<polygon> polygons;
+        multi_polygon result;
+        result.push_back(square<polygon>(0, 0, 1));
+        bg::cascaded_union(polygons, result);
+        BOOST_CHECK(result.empty());
+
+        polygons.push_back(square<polygon>(0, 0, 1));
+        bg::cascaded_union(polygons, result);
+        BOOST_CHECK_EQUAL(bg::num_geometries(result), 1u);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
@@ -8,12 +8,16 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <cmath>
 #include <vector>
 
+#include <boost/geometry/algorithms/distance.hpp>
 #include <boost/geometry/geometries/linestring.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/geometries/polygon.hpp>
 
+#include <boost/geometry/strategies/parallel.hpp>
+
 #include "test_frechet_distance.hpp"
 
     template <typename P>
@@ -80,6 +84,100 @@ void test_all_spherical_equ()
 
 }
 
+// The coupling measure calculated with the full matrix
+template <typename Linestring>
+double frechet_reference(Linestring const& ls1, Linestring const& ls2)
+{
+    std::size_t const a = ls1.size();
+    std::size_t const b = ls2.size();
+    std::vector<double> m(a * b);
+    for (std::size_t i = 0 ; i < a ; i++)
+    {
+        for (std::size_t j = 0 ; j < b ; j++)
+        {
+            double const d = bg::distance(ls1[i], ls2[j]);
+            double& v = m[i * b + j];
+            if (i == 0 && j == 0)
+                v = d;
+            else if (i == 0)
+                v = (std::max)(m[j - 1], d);
+            else if (j == 0)
+                v = (std::max)(m[(i - 1) * b], d);
+            else
+                v = (std::max)((std::min)((std::min)(m[i * b + j - 1], m[(i - 1) * b + j]),
+                                          m[(i - 1) * b + j - 1]), d);
+        }
+    }
+    return m[a * b - 1];
+}
+
+template <typename Linestring>
+Linestring wavy_linestring(std::size_t count, double phase)
+{
+    Linestring result;
+    for (std::size_t i = 0 ; i < count ; i++)
+    {
+        double const x = 100.0 * i / count;
+        bg::append(result, typename bg::point_type<Linestring>::type(
+                               x, std::sin(x * 0.7 + phase) + 0.3 * std::cos(x * 3.1)));
+    }
+    return result;
+}
+
+template <typename P>
+void test_long_linestrings()
+{
+    typedef bg::model::linestring<P> linestring_2d;
+    typedef bg::strategies::discrete_distance::cartesian<> strategy_type;
+
+    bg::strategies::parallel<strategy_type> const parallel(4);
+
+    std::size_t const sizes[][2] = { {1000, 1000}, {1300, 700}, {600, 1500}, {2000, 513} };
+    for (auto const& size : sizes)
+    {
+        linestring_2d const ls1 = wavy_linestring<linestring_2d>(size[0], 0.0);
+        linestring_2d const ls2 = wavy_linestring<linestring_2d>(size[1], 0.5);
+
+        double const expected = frechet_reference(ls1, ls2);
+        BOOST_CHECK_EQUAL(bg::discrete_frechet_distance(ls1, ls2), expected);
+        BOOST_CHECK_EQUAL(bg::discrete_frechet_distance(ls1, ls2, parallel), expected);
+        BOOST_CHECK_EQUAL(bg::discrete_frechet_distance(ls2, ls1, parallel), expected);
+
+        BOOST_CHECK(bg::discrete_frechet_distance_within(ls1, ls2, expected));
+        BOOST_CHECK(bg::discrete_frechet_distance_within(ls2, ls1, expected * 1.001));
+        BOOST_CHECK(! bg::discrete_frechet_distance_within(ls1, ls2, expected * 0.999));
+        BOOST_CHECK(! bg::discrete_frechet_distance_within(ls2, ls1, expected * 0.999,
+                                                           strategy_type()));
+    }
+}
+
+template <typename P>
+void test_within()
+{
+    typedef bg::model::linestring<P> linestring_2d;
+
+    linestring_2d const ls1 = bg::from_wkt<linestring_2d>("LINESTRING(3 0,2 1,3 2)");
+    linestring_2d const ls2 = bg::from_wkt<linestring_2d>("LINESTRING(0 0,3 4,4 3)");
+    BOOST_CHECK(bg::discrete_frechet_distance_within(ls1, ls2, 3));
+    BOOST_CHECK(bg::discrete_frechet_distance_within(ls1, ls2, 3.5));
+    BOOST_CHECK(! bg::discrete_frechet_distance_within(ls1, ls2, 2.9));
+    BOOST_CHECK(bg::discrete_frechet_distance_within(ls1, ls1, 0));
+    BOOST_CHECK(bg::discrete_frechet_distance_within(ls1, ls2, 3,
+                    bg::strategy::distance::pythagoras<>()));
+
+    // The endpoints are too far
+    BOOST_CHECK(! bg::discrete_frechet_distance_within(
+                    bg::from_wkt<linestring_2d>("LINESTRING(0 0,1 0,2 0)"),
+                    bg::from_wkt<linestring_2d>("LINESTRING(0 0,1 0,5 0)"), 2.5));
+    // One point
+    BOOST_CHECK(bg::discrete_frechet_distance_within(
+                    bg::from_wkt<linestring_2d>("LINESTRING(0 0)"),
+                    bg::from_wkt<linestring_2d>("LINESTRING(0 1,1 1,0 2)"), 2));
+    BOOST_CHECK(! bg::discrete_frechet_distance_within(
+                    bg::from_wkt<linestring_2d>("LINESTRING(0 0)"),
+                    bg::from_wkt<linestring_2d>("LINESTRING(0 1,1 1,0 2)"), 1.9));
+}
+
 int test_main(int, char* [])
 {
     //Cartesian Coordinate System
@@ -91,5 +189,8 @@ int test_main(int, char* [])
     //Spherical_Equatorial Coordinate System
     test_all_spherical_equ<bg::model::d2::point_xy<double,bg::cs::spherical_equatorial<bg::degree> > >();
 
+    test_long_linestrings<bg::model::d2::point_xy<double> >();
+    test_within<bg::model::d2::point_xy<double> >();
+
     return 0;
 }
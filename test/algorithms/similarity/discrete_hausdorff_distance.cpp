@@ -13,14 +13,20 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <cmath>
+#include <utility>
 #include <vector>
 
+#include <boost/geometry/algorithms/distance.hpp>
 #include <boost/geometry/geometries/linestring.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/geometries/polygon.hpp>
 #include <boost/geometry/geometries/multi_linestring.hpp>
 #include <boost/geometry/geometries/multi_point.hpp>
 
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/strategies/parallel.hpp>
+
 #include "test_hausdorff_distance.hpp"
 
     template <typename P>
@@ -99,6 +105,88 @@ void test_all_spherical_equ()
     test_geometry<linestring_2d,linestring_2d >("LINESTRING(0 0,3 4,4 3)","LINESTRING(4 3,3 4,0 0)",0);
 }
 
+// The distance calculated with all pairs of points
+template <typename Linestring1, typename Linestring2>
+double hausdorff_reference(Linestring1 const& ls1, Linestring2 const& ls2)
+{
+    double result = 0;
+    for (auto const& p1 : ls1)
+    {
+        double dis_min = bg::distance(p1, ls2.front());
+        for (auto const& p2 : ls2)
+        {
+            dis_min = (std::min)(dis_min, double(bg::distance(p1, p2)));
+        }
+        result = (std::max)(result, dis_min);
+    }
+    return result;
+}
+
+template <typename Linestring>
+Linestring wavy_linestring(std::size_t count, double phase, double amplitude)
+{
+    Linestring result;
+    for (std::size_t i = 0 ; i < count ; i++)
+    {
+        double const x = 100.0 * i / count;
+        bg::append(result, typename bg::point_type<Linestring>::type(
+                               x, amplitude * std::sin(x * 0.7 + phase)));
+    }
+    return result;
+}
+
+template <typename P>
+void test_long_linestrings()
+{
+    typedef bg::model::linestring<P> linestring_2d;
+    typedef bg::model::multi_linestring<linestring_2d> mlinestring_t;
+    typedef bg::strategies::discrete_distance::cartesian<> strategy_type;
+
+    namespace bgi = bg::index;
+    typedef bgi::rtree<P, bgi::quadratic<16> > rtree_type;
+    typedef bgi::rtree<std::pair<P, int>, bgi::linear<4> > pair_rtree_type;
+
+    bg::strategies::parallel<strategy_type> const parallel(4);
+
+    linestring_2d const reference = wavy_linestring<linestring_2d>(3000, 0.0, 1.0);
+    rtree_type const rtree(reference);
+    pair_rtree_type pair_rtree;
+    for (std::size_t i = 0 ; i < reference.size() ; i++)
+    {
+        pair_rtree.insert(std::make_pair(reference[i], int(i)));
+    }
+
+    mlinestring_t candidates;
+    for (int i = 0 ; i < 4 ; i++)
+    {
+        linestring_2d const candidate = wavy_linestring<linestring_2d>(1000 + 500 * i, 0.1 * i, 1.0 + 0.2 * i);
+        candidates.push_back(candidate);
+
+        double const expected = hausdorff_reference(candidate, reference);
+        BOOST_CHECK_EQUAL(bg::discrete_hausdorff_distance(candidate, reference), expected);
+        BOOST_CHECK_EQUAL(bg::discrete_hausdorff_distance(candidate, reference, parallel), expected);
+        BOOST_CHECK_EQUAL(bg::discrete_hausdorff_distance(candidate, rtree), expected);
+        BOOST_CHECK_EQUAL(bg::discrete_hausdorff_distance(candidate, rtree, parallel), expected);
+        BOOST_CHECK_EQUAL(bg::discrete_hausdorff_distance(candidate, pair_rtree, strategy_type()), expected);
+        BOOST_CHECK_EQUAL(bg::discrete_hausdorff_distance(candidate.front(), rtree),
+                          hausdorff_reference(linestring_2d{candidate.front()}, reference));
+    }
+
+    double expected = 0;
+    for (linestring_2d const& candidate : candidates)
+    {
+        expected = (std::max)(expected, hausdorff_reference(candidate, reference));
+    }
+    BOOST_CHECK_EQUAL(bg::discrete_hausdorff_distance(candidates, rtree), expected);
+    BOOST_CHECK_EQUAL(bg::discrete_hausdorff_distance(candidates, rtree, parallel), expected);
+
+    mlinestring_t references;
+    references.push_back(reference);
+    BOOST_CHECK_EQUAL(bg::discrete_hausdorff_distance(candidates, references, parallel), expected);
+
+    test_empty_input(candidates.front(), rtree_type());
+}
+
 int test_main(int, char* [])
 {
     //Cartesian Coordinate System
@@ -114,5 +202,7 @@ int test_main(int, char* [])
     test_all_spherical_equ<bg::model::d2::point_xy<float,bg::cs::spherical_equatorial<bg::degree> > >();
     test_all_spherical_equ<bg::model::d2::point_xy<double,bg::cs::spherical_equatorial<bg::degree> > >();
 
+    test_long_linestrings<bg::model::d2::point_xy<double> >();
+
     return 0;
 }
@@ -0,0 +1,204 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/simplify.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+typedef bg::strategies::simplify::cartesian<> cartesian_type;
+typedef bg::strategies::simplify::visvalingam_whyatt<cartesian_type> vw_type;
+
+template <typename Geometry>
+std::string to_wkt(Geometry const& geometry)
+{
+    std::ostringstream out;
+    out << bg::wkt(geometry);
+    return out.str();
+}
+
+template <typename Geometry>
+void test_geometry(std::string const& wkt, std::string const& expected,
+                   double max_area, bool preserve_topology = false)
+{
+    Geometry geometry, simplified;
+    bg::read_wkt(wkt, geometry);
+    bg::simplify(geometry, simplified, max_area, vw_type(preserve_topology));
+
+    BOOST_CHECK_MESSAGE(to_wkt(simplified) == expected,
+                        wkt << " " << max_area << " " << preserve_topology
+                        << " expected: " << expected
+                        << " detected: " << to_wkt(simplified));
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::polygon<P, false, false> polygon_ccw_open;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    test_geometry<linestring>("LINESTRING(0 0,1 0.1,2 0,3 3,4 0)",
+                              "LINESTRING(0 0,2 0,3 3,4 0)", 0.5);
+    test_geometry<linestring>("LINESTRING(0 0,1 0.1,2 0,3 3,4 0)",
+                              "LINESTRING(0 0,3 3,4 0)", 5.0);
+    test_geometry<linestring>("LINESTRING(0 0,1 0.1,2 0,3 3,4 0)",
+                              "LINESTRING(0 0,1 0.1,2 0,3 3,4 0)", 0.0);
+    test_geometry<linestring>("LINESTRING(0 0,1 0.1,2 0,3 3,4 0)",
+                              "LINESTRING(0 0,1 0.1,2 0,3 3,4 0)", -1.0);
+
+    // The effective area of 1 1 is increased after removing 0.5 0.5
+    test_geometry<linestring>("LINESTRING(0 0,0.5 0.5,1 1,2 0,3 0.5)",
+                              "LINESTRING(0 0,1 1,2 0,3 0.5)", 0.5);
+
+    // Rings are rotated as with douglas_peucker
+    test_geometry<polygon>("POLYGON((0 0,0 10,5 10.1,10 10,10 0,5 0.1,0 0))",
+                           "POLYGON((10 10,10 0,0 0,0 10,10 10))", 1.0);
+    test_geometry<polygon_ccw_open>("POLYGON((0 0,5 0.1,10 0,10 10,5 10.1,0 10))",
+                                    "POLYGON((10 10,0 10,0 0,10 0,10 10))", 1.0);
+    test_geometry<polygon>("POLYGON((0 0,0 10,5 10.1,10 10,10 0,5 0.1,0 0))",
+                           "POLYGON((0 0,0 10,10 10,10 0,0 0))", 1.0, true);
+
+    // The hole is removed
+    test_geometry<polygon>("POLYGON((0 0,0 10,10 10,10 0,0 0),(4 4,5 4,5 5,4 4))",
+                           "POLYGON((10 10,10 0,0 0,0 10,10 10))", 1.0);
+    // The ring is not collapsed if topology is preserved
+    test_geometry<polygon>("POLYGON((0 0,0 10,10 10,10 0,0 0),(4 4,5 4,5 5,4 4))",
+                           "POLYGON((0 0,0 10,10 10,10 0,0 0),(4 4,5 4,5 5,4 4))",
+                           1.0, true);
+
+    // The vertex 5 10.02 would be removed creating an intersection with the hole
+    std::string const hole_case
+        = "POLYGON((0 0,0 10,5 10.02,10 10,10 0,0 0),"
+          "(3 9.9,7 9.9,7 10.005,3 10.005,3 9.9))";
+    test_geometry<polygon>(hole_case,
+                           "POLYGON((10 10,10 0,0 0,0 10,10 10),"
+                           "(7 10.005,3 10.005,3 9.9,7 9.9,7 10.005))",
+                           0.15);
+    test_geometry<polygon>(hole_case, to_wkt(bg::from_wkt<polygon>(hole_case)),
+                           0.15, true);
+
+    // The same for separate polygons
+    std::string const multi_case
+        = "MULTIPOLYGON(((0 0,0 10,5 10.02,10 10,10 0,0 0)),"
+          "((3 10.01,3 12,7 12,7 10.01,3 10.01)))";
+    test_geometry<multi_polygon>(multi_case,
+                                 "MULTIPOLYGON(((10 10,10 0,0 0,0 10,10 10)),"
+                                 "((7 12,7 10.01,3 10.01,3 12,7 12)))",
+                                 0.15);
+    test_geometry<multi_polygon>(multi_case, to_wkt(bg::from_wkt<multi_polygon>(multi_case)),
+                                 0.15, true);
+
+    // The endpoint would be at the other side of the linestring
+    std::string const self_case = "LINESTRING(0 0,5 0.02,10 0,10 -2,5 -2,5 0.01,4 0.01)";
+    test_geometry<linestring>(self_case, "LINESTRING(0 0,10 0,10 -2,5 -2,5 0.01,4 0.01)", 0.15);
+    test_geometry<linestring>(self_case, self_case, 0.15, true);
+}
+
+// Wavy star-shaped polygons with wavy holes, close to each other
+template <typename MultiPolygon>
+MultiPolygon make_stars(int n, int vertices)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    typedef typename bg::point_type<MultiPolygon>::type point_type;
+
+    double const pi = bg::math::pi<double>();
+
+    MultiPolygon result;
+    for (int i = 0 ; i < n ; ++i)
+    {
+        for (int j = 0 ; j < n ; ++j)
+        {
+            polygon_type poly;
+            poly.inners().resize(1);
+            for (int k = 0 ; k < vertices ; ++k)
+            {
+                double const a = 2 * pi * k / vertices;
+                double const r = 1.3 + 0.08 * std::sin(k * 1.7 + i) + 0.05 * std::cos(k * 5.3 + j);
+                double const h = 1.0 + 0.15 * std::sin(k * 2.3 + j);
+                double const x = i * 3;
+                double const y = j * 3;
+                bg::append(poly.outer(), point_type(x + r * std::cos(a), y + r * std::sin(a)));
+                bg::append(poly.inners()[0], point_type(x + h * std::cos(a), y + h * std::sin(a)));
+            }
+            bg::append(poly.outer(), poly.outer().front());
+            bg::append(poly.inners()[0], poly.inners()[0].front());
+            result.push_back(poly);
+        }
+    }
+    bg::correct(result);
+    return result;
+}
+
+template <typename P>
+void test_stars()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    multi_polygon const stars = make_stars<multi_polygon>(5, 400);
+    BOOST_CHECK(bg::is_valid(stars));
+
+    std::size_t previous_count = bg::num_points(stars);
+    for (double max_area : {0.0001, 0.001, 0.01, 0.1, 1.0})
+    {
+        multi_polygon preserved;
+        bg::simplify(stars, preserved, max_area, vw_type(true));
+
+        std::size_t const count = bg::num_points(preserved);
+        BOOST_CHECK_MESSAGE(bg::is_valid(preserved), "stars " << max_area);
+        BOOST_CHECK_MESSAGE(count < previous_count, "stars " << max_area);
+        BOOST_CHECK_EQUAL(preserved.size(), stars.size());
+        BOOST_CHECK_EQUAL(bg::num_interior_rings(preserved), stars.size());
+        previous_count = count;
+    }
+}
+
+void test_geographic()
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_type;
+    typedef bg::model::polygon<point_type> polygon;
+
+    polygon const geometry = bg::from_wkt<polygon>(
+        "POLYGON((0 0,0 1,0.5 1.001,1 1,1 0,0.5 0.001,0 0),(0.2 0.2,0.8 0.2,0.8 0.8,0.2 0.2))");
+
+    bg::strategies::simplify::visvalingam_whyatt
+        <
+            bg::strategies::simplify::geographic<>
+        > const strategy(true);
+
+    // Areas in square meters
+    polygon simplified;
+    bg::simplify(geometry, simplified, 1.0e7, strategy);
+    BOOST_CHECK_EQUAL(bg::num_points(simplified), 9u);
+    BOOST_CHECK(bg::is_valid(simplified));
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_stars<bg::model::d2::point_xy<double> >();
+    test_geographic();
+
+    return 0;
+}
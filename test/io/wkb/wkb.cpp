@@ -0,0 +1,271 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/perimeter.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkb/wkb.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+
+typedef std::vector<boost::uint8_t> byte_vector;
+
+template <typename Geometry>
+byte_vector to_wkb(Geometry const& geometry)
+{
+    byte_vector wkb;
+    BOOST_CHECK(bg::write_wkb(geometry, std::back_inserter(wkb)));
+    return wkb;
+}
+
+// Writes big endian WKB if the platform is little endian and vice versa
+struct swapped_writer
+{
+    byte_vector bytes;
+
+    template <typename T>
+    void write(T value)
+    {
+        unsigned char raw[sizeof(T)];
+        std::memcpy(raw, &value, sizeof(T));
+        for (std::size_t i = sizeof(T); i > 0; --i)
+        {
+            bytes.push_back(raw[i - 1]);
+        }
+    }
+
+    template <typename Range>
+    void write_points(Range const& range)
+    {
+        write(boost::uint32_t(boost::size(range)));
+        for (auto it = boost::begin(range); it != boost::end(range); ++it)
+        {
+            write(double(bg::get<0>(*it)));
+            write(double(bg::get<1>(*it)));
+        }
+    }
+
+    void write_header(boost::uint32_t type)
+    {
+        bytes.push_back(bg::detail::wkb::native_byte_order()
+                        == bg::detail::wkb::byte_order_type::ndr ? 0 : 1);
+        write(type);
+    }
+
+    template <typename Linestring>
+    void write_linestring(Linestring const& ls)
+    {
+        write_header(2);
+        write_points(ls);
+    }
+
+    template <typename Polygon>
+    void write_polygon(Polygon const& poly)
+    {
+        write_header(3);
+        write(boost::uint32_t(1 + poly.inners().size()));
+        write_points(poly.outer());
+        for (auto const& inner : poly.inners())
+        {
+            write_points(inner);
+        }
+    }
+};
+
+template <typename Geometry>
+void test_roundtrip(std::string const& wkt)
+{
+    Geometry const expected = bg::from_wkt<Geometry>(wkt);
+    byte_vector const wkb = to_wkb(expected);
+
+    // Iterators of vector and string, pointers and other iterators
+    Geometry g1, g2, g3, g4;
+    BOOST_CHECK(bg::read_wkb(wkb.begin(), wkb.end(), g1));
+    BOOST_CHECK(bg::read_wkb(wkb.data(), wkb.size(), g2));
+    std::deque<boost::uint8_t> const deq(wkb.begin(), wkb.end());
+    BOOST_CHECK(bg::read_wkb(deq.begin(), deq.end(), g3));
+    std::string const str(wkb.begin(), wkb.end());
+    BOOST_CHECK(bg::read_wkb(str.begin(), str.end(), g4));
+
+    BOOST_CHECK_EQUAL(bg::to_wkt(g1), bg::to_wkt(expected));
+    BOOST_CHECK_EQUAL(bg::to_wkt(g2), bg::to_wkt(expected));
+    BOOST_CHECK_EQUAL(bg::to_wkt(g3), bg::to_wkt(expected));
+    BOOST_CHECK_EQUAL(bg::to_wkt(g4), bg::to_wkt(expected));
+
+    // The geometry is cleared before reading
+    BOOST_CHECK(bg::read_wkb(wkb.data(), wkb.size(), g1));
+    BOOST_CHECK_EQUAL(bg::to_wkt(g1), bg::to_wkt(expected));
+
+    // Written the same way as the geometry
+    BOOST_CHECK(to_wkb(g2) == wkb);
+}
+
+template <typename P>
+void test_io()
+{
+    typedef bg::model::linestring<P> linestring_type;
+    typedef bg::model::polygon<P> polygon_type;
+
+    test_roundtrip<linestring_type>("LINESTRING(0 0,1 1,2.5 3,-4 5)");
+    test_roundtrip<linestring_type>("LINESTRING()");
+    test_roundtrip<polygon_type>("POLYGON((0 0,0 9,9 9,9 0,0 0),(1 1,2 1,2 2,1 1))");
+    test_roundtrip<bg::model::multi_point<P> >("MULTIPOINT((1 2),(3 4))");
+    test_roundtrip<bg::model::multi_linestring<linestring_type> >(
+        "MULTILINESTRING((0 0,1 1),(2 2,3 3,4 4))");
+    test_roundtrip<bg::model::multi_polygon<polygon_type> >(
+        "MULTIPOLYGON(((0 0,0 1,1 1,1 0,0 0)),((2 2,2 3,3 3,3 2,2 2),(2.2 2.2,2.8 2.2,2.8 2.8,2.2 2.2)))");
+
+    // Not contiguous container
+    test_roundtrip<bg::model::linestring<P, std::deque> >("LINESTRING(0 0,1 1,2.5 3)");
+
+    // Big endian on little endian platform or the other way around
+    {
+        linestring_type const ls = bg::from_wkt<linestring_type>("LINESTRING(0 0,1 1,2.5 3)");
+        polygon_type const poly = bg::from_wkt<polygon_type>(
+            "POLYGON((0 0,0 9,9 9,9 0,0 0),(1 1,2 1,2 2,1 1))");
+        swapped_writer w1, w2;
+        w1.write_linestring(ls);
+        w2.write_polygon(poly);
+
+        linestring_type ls_read;
+        polygon_type poly_read;
+        BOOST_CHECK(bg::read_wkb(w1.bytes.data(), w1.bytes.size(), ls_read));
+        BOOST_CHECK(bg::read_wkb(w2.bytes.begin(), w2.bytes.end(), poly_read));
+        BOOST_CHECK_EQUAL(bg::to_wkt(ls_read), bg::to_wkt(ls));
+        BOOST_CHECK_EQUAL(bg::to_wkt(poly_read), bg::to_wkt(poly));
+    }
+
+    // Too short
+    {
+        byte_vector wkb = to_wkb(bg::from_wkt<linestring_type>("LINESTRING(0 0,1 1)"));
+        wkb.pop_back();
+        linestring_type ls;
+        BOOST_CHECK(! bg::read_wkb(wkb.data(), wkb.size(), ls));
+    }
+}
+
+template <typename View, typename Geometry>
+void check_view(View const& view, Geometry const& geometry)
+{
+    BOOST_CHECK_EQUAL(bg::num_points(view), bg::num_points(geometry));
+    BOOST_CHECK_EQUAL(bg::to_wkt(view), bg::to_wkt(geometry));
+
+    typedef typename bg::point_type<Geometry>::type point_type;
+    bg::model::box<point_type> b1, b2;
+    bg::envelope(view, b1);
+    bg::envelope(geometry, b2);
+    BOOST_CHECK_EQUAL(bg::to_wkt(b1), bg::to_wkt(b2));
+}
+
+template <typename P>
+void test_views()
+{
+    typedef bg::model::linestring<P> linestring_type;
+    typedef bg::model::polygon<P> polygon_type;
+    typedef bg::wkb_linestring_view<P> linestring_view;
+    typedef bg::wkb_ring_view<P> ring_view;
+    typedef bg::wkb_polygon_view<P> polygon_view;
+
+    linestring_type const ls = bg::from_wkt<linestring_type>("LINESTRING(0 0,3 4,3 10,-1.5 2)");
+    polygon_type const poly = bg::from_wkt<polygon_type>(
+        "POLYGON((0 0,0 9,9 9,9 0,0 0),(1 1,2 1,2 2,1 1),(4 4,6 4,6 6,4 4))");
+
+    swapped_writer w1, w2;
+    w1.write_linestring(ls);
+    w2.write_polygon(poly);
+    byte_vector const ls_wkbs[] = { to_wkb(ls), w1.bytes };
+    byte_vector const poly_wkbs[] = { to_wkb(poly), w2.bytes };
+
+    for (byte_vector const& wkb : ls_wkbs)
+    {
+        linestring_view const view(wkb.data(), wkb.size());
+        BOOST_CHECK_EQUAL(view.size(), 4u);
+        check_view(view, ls);
+        BOOST_CHECK_CLOSE(bg::length(view), bg::length(ls), 0.0001);
+    }
+
+    for (byte_vector const& wkb : poly_wkbs)
+    {
+        polygon_view const view(wkb.data(), wkb.size());
+        BOOST_CHECK_EQUAL(view.inners().size(), 2u);
+        check_view(view, poly);
+        BOOST_CHECK_CLOSE(bg::area(view), bg::area(poly), 0.0001);
+        BOOST_CHECK_CLOSE(bg::perimeter(view), bg::perimeter(poly), 0.0001);
+
+        ring_view const exterior(wkb.data(), wkb.size());
+        ring_view const hole(wkb.data(), wkb.size(), 2);
+        check_view(exterior, poly.outer());
+        check_view(hole, poly.inners()[1]);
+
+        P const points[] = { P(0.5, 0.5), P(1.8, 1.2), P(5.5, 4.8), P(0, 5), P(10, 1) };
+        for (P const& p : points)
+        {
+            BOOST_CHECK_EQUAL(bg::within(p, view), bg::within(p, poly));
+            BOOST_CHECK_EQUAL(bg::within(p, exterior), bg::within(p, poly.outer()));
+            BOOST_CHECK_EQUAL(bg::covered_by(p, hole), bg::covered_by(p, poly.inners()[1]));
+        }
+    }
+
+    // Wrong type, wrong ring and too short WKB
+    {
+        byte_vector const wkb = to_wkb(poly);
+        BOOST_CHECK_THROW(linestring_view(wkb.data(), wkb.size()), bg::read_wkb_exception);
+        BOOST_CHECK_THROW(ring_view(wkb.data(), wkb.size(), 3), bg::read_wkb_exception);
+        BOOST_CHECK_THROW(polygon_view(wkb.data(), wkb.size() - 1), bg::read_wkb_exception);
+
+        // The number of rings can't exceed the size of the WKB
+        byte_vector corrupted = wkb;
+        std::fill(corrupted.begin() + 5, corrupted.begin() + 9, boost::uint8_t(0xff));
+        BOOST_CHECK_THROW(polygon_view(corrupted.data(), corrupted.size()), bg::read_wkb_exception);
+    }
+}
+
+// The iterators of contiguous bytes are replaced with pointers so the
+// coordinates can be copied at once
+void test_contiguous_iterators()
+{
+    using bg::detail::wkb::is_contiguous_iterator;
+
+    BOOST_CHECK((is_contiguous_iterator<byte_vector::iterator>::value));
+    BOOST_CHECK((is_contiguous_iterator<byte_vector::const_iterator>::value));
+    BOOST_CHECK((is_contiguous_iterator<std::vector<char>::const_iterator>::value));
+    BOOST_CHECK((is_contiguous_iterator<std::string::iterator>::value));
+    BOOST_CHECK((is_contiguous_iterator<std::string::const_iterator>::value));
+
+    BOOST_CHECK((! is_contiguous_iterator<std::deque<boost::uint8_t>::const_iterator>::value));
+    BOOST_CHECK((! is_contiguous_iterator<std::istreambuf_iterator<char> >::value));
+}
+
+int test_main(int, char* [])
+{
+    test_contiguous_iterators();
+
+    test_io<bg::model::d2::point_xy<double> >();
+    test_io<bg::model::point<float, 2, bg::cs::cartesian> >();
+
+    test_views<bg::model::d2::point_xy<double> >();
+    test_views<bg::model::point<float, 2, bg::cs::cartesian> >();
+
+    return 0;
+}
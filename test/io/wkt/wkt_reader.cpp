@@ -0,0 +1,166 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+#include <string_view>
+#endif
+
+
+template <typename Geometry>
+std::vector<std::string> read_all(std::string const& text)
+{
+    std::vector<std::string> result;
+    bg::wkt_reader reader(text);
+    Geometry geometry;
+    while (reader.read(geometry))
+    {
+        result.push_back(bg::to_wkt(geometry));
+    }
+    return result;
+}
+
+template <typename Geometry>
+void test_read_all(std::string const& text, std::vector<std::string> const& expected)
+{
+    std::vector<std::string> const result = read_all<Geometry>(text);
+    BOOST_CHECK_EQUAL(result.size(), expected.size());
+    for (std::size_t i = 0 ; i < result.size() && i < expected.size() ; ++i)
+    {
+        BOOST_CHECK_EQUAL(result[i], expected[i]);
+        // The same result as read_wkt
+        BOOST_CHECK_EQUAL(result[i], bg::to_wkt(bg::from_wkt<Geometry>(expected[i])));
+    }
+}
+
+template <typename Geometry>
+void test_error(std::string const& text, std::size_t records, std::size_t offset,
+                std::string const& start)
+{
+    bg::wkt_reader reader(text);
+    Geometry geometry;
+    std::size_t count = 0;
+    std::string message;
+    std::size_t error_offset = 0;
+    try
+    {
+        while (reader.read(geometry))
+        {
+            ++count;
+        }
+    }
+    catch (bg::read_wkt_exception const& e)
+    {
+        message = e.what();
+        error_offset = e.offset();
+    }
+    BOOST_CHECK_EQUAL(count, records);
+    BOOST_CHECK_EQUAL(error_offset, offset);
+    BOOST_CHECK_MESSAGE(message.compare(0, start.size(), start) == 0,
+                        "Expected: " << start << " Got: " << message);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring_type;
+    typedef bg::model::polygon<P> polygon_type;
+    typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+    typedef bg::model::multi_point<P> multi_point_type;
+
+    test_read_all<P>("POINT(1 2)\nPOINT(3 4)\r\n\tPOINT(-5.5 +6e2)  ",
+        { "POINT(1 2)", "POINT(3 4)", "POINT(-5.5 600)" });
+    test_read_all<P>("", {});
+    test_read_all<P>(" \n ", {});
+    test_read_all<linestring_type>("LINESTRING(0 0,1 1)LINESTRING EMPTY LINESTRING(2 2,3 3,4 4)",
+        { "LINESTRING(0 0,1 1)", "LINESTRING()", "LINESTRING(2 2,3 3,4 4)" });
+    test_read_all<multi_point_type>("MULTIPOINT((1 2),(3 4))\nMULTIPOINT(5 6)\nMULTIPOINT EMPTY",
+        { "MULTIPOINT((1 2),(3 4))", "MULTIPOINT((5 6))", "MULTIPOINT()" });
+
+    // Interior rings and polygons are removed from the reused geometry
+    test_read_all<polygon_type>(
+        "POLYGON((0 0,0 9,9 9,9 0,0 0),(1 1,2 1,2 2,1 1),(3 3,4 3,4 4,3 3))\n"
+        "POLYGON((0 0,0 5,5 5,5 0,0 0),(1 1,2 1,2 2,1 1))\n"
+        "POLYGON EMPTY\n"
+        "POLYGON((0 0,0 1,1 1,1 0,0 0))",
+        { "POLYGON((0 0,0 9,9 9,9 0,0 0),(1 1,2 1,2 2,1 1),(3 3,4 3,4 4,3 3))",
+          "POLYGON((0 0,0 5,5 5,5 0,0 0),(1 1,2 1,2 2,1 1))",
+          "POLYGON()",
+          "POLYGON((0 0,0 1,1 1,1 0,0 0))" });
+    test_read_all<multi_polygon_type>(
+        "MULTIPOLYGON(((0 0,0 1,1 1,1 0,0 0)),((2 2,2 3,3 3,3 2,2 2),(2.2 2.2,2.8 2.2,2.8 2.8,2.2 2.2)))\n"
+        "MULTIPOLYGON(((5 5,5 6,6 6,6 5,5 5)))",
+        { "MULTIPOLYGON(((0 0,0 1,1 1,1 0,0 0)),((2 2,2 3,3 3,3 2,2 2),(2.2 2.2,2.8 2.2,2.8 2.8,2.2 2.2)))",
+          "MULTIPOLYGON(((5 5,5 6,6 6,6 5,5 5)))" });
+
+    // The storage of the geometry is reused
+    {
+        std::string const text = "LINESTRING(0 0,1 1,2 2,3 3) LINESTRING(4 4,5 5)";
+        bg::wkt_reader reader(text);
+        linestring_type ls;
+        BOOST_CHECK(reader.read(ls));
+        P const* data = ls.data();
+        BOOST_CHECK_EQUAL(reader.offset(), 28u);
+        BOOST_CHECK(reader.read(ls));
+        BOOST_CHECK(ls.data() == data);
+        BOOST_CHECK_EQUAL(ls.size(), 2u);
+        BOOST_CHECK(! reader.read(ls));
+    }
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+    {
+        std::string const text = "POINT(1 2) POINT(3 4) POINT(5 6)";
+        // Only the part of the text is read
+        bg::wkt_reader reader(std::string_view(text).substr(0, 21));
+        P p;
+        std::size_t count = 0;
+        while (reader.read(p))
+        {
+            ++count;
+        }
+        BOOST_CHECK_EQUAL(count, 2u);
+        BOOST_CHECK_CLOSE(bg::get<0>(p), 3.0, 0.0001);
+    }
+#endif
+
+    // Errors contain offsets in the whole text
+    test_error<P>("POINT(1 2)\nPOINT(3 x)", 1, 19, "bad lexical cast");
+    test_error<P>("POINT(1 2)\nPOINT(3 4)\nPOINT(5 6", 2, 31, "Expected ')'");
+    test_error<P>("POINT(1 2)\nLINESTRING(3 4)", 1, 11, "Should start with 'POINT'");
+    test_error<P>("POINT(1 2)\nPOINT(3 4 5)", 1, 21, "Expected ')'");
+    test_error<polygon_type>("POLYGON((0 0,1 1,1 0,0 0)) POLYGON((0 0 , 1 1,1 0,0 0)", 1, 54, "Expected ')'");
+
+    // read_wkt reports the offsets too
+    try
+    {
+        P p;
+        bg::read_wkt("POINT(1 2)  foo", p);
+        BOOST_CHECK(false);
+    }
+    catch (bg::read_wkt_exception const& e)
+    {
+        BOOST_CHECK_EQUAL(e.offset(), 12u);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::point<float, 2, bg::cs::cartesian> >();
+
+    return 0;
+}
@@ -0,0 +1,213 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/projection.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+
+inline bool close(double v1, double v2)
+{
+    if (v1 == HUGE_VAL || v2 == HUGE_VAL)
+    {
+        return v1 == v2;
+    }
+    if (std::isnan(v1) || std::isnan(v2))
+    {
+        return std::isnan(v1) && std::isnan(v2);
+    }
+    return std::fabs(v1 - v2) <= 1e-9 * (std::max)(1.0, std::fabs(v1));
+}
+
+// Grid of points, some of them out of range
+inline std::vector<point_ll> grid()
+{
+    std::vector<point_ll> result;
+    for (int i = 0 ; i < 57 ; ++i)
+    {
+        for (int j = 0 ; j < 31 ; ++j)
+        {
+            result.push_back(point_ll(-20.0 + i * 0.7, -5.0 + j * 2.5));
+        }
+    }
+    result[10] = point_ll(0, 100);
+    result[700] = point_ll(1000, 0);
+    return result;
+}
+
+template <typename Projection>
+void test_projection(Projection const& prj, std::string const& name)
+{
+    std::vector<point_ll> const lls = grid();
+    std::size_t const count = lls.size();
+
+    // Scalar results
+    std::vector<point_xy> xys(count);
+    std::vector<point_ll> lls2(count);
+    bool scalar_fwd = true;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        if (! prj.forward(lls[i], xys[i]))
+        {
+            scalar_fwd = false;
+        }
+        if (bg::get<0>(xys[i]) == HUGE_VAL)
+        {
+            bg::set<0>(lls2[i], HUGE_VAL);
+            bg::set<1>(lls2[i], HUGE_VAL);
+        }
+        else
+        {
+            prj.inverse(xys[i], lls2[i]);
+        }
+    }
+    BOOST_CHECK(! scalar_fwd);
+
+    std::vector<double> lon(count), lat(count);
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        lon[i] = bg::get<0>(lls[i]);
+        lat[i] = bg::get<1>(lls[i]);
+    }
+
+    std::size_t const threads[] = { 1, 3, 0 };
+    for (std::size_t t : threads)
+    {
+        // Arrays of coordinates
+        std::vector<double> x(count), y(count), lon2(count), lat2(count);
+        BOOST_CHECK_EQUAL(prj.forward(lon.data(), lat.data(), x.data(), y.data(), count, t),
+                          scalar_fwd);
+        prj.inverse(x.data(), y.data(), lon2.data(), lat2.data(), count, t);
+
+        // Arrays of points
+        std::vector<point_xy> xys_n(count);
+        std::vector<point_ll> lls_n(count);
+        BOOST_CHECK_EQUAL(prj.forward(lls.data(), xys_n.data(), count, t), scalar_fwd);
+        prj.inverse(xys_n.data(), lls_n.data(), count, t);
+
+        std::size_t differences = 0;
+        for (std::size_t i = 0 ; i < count ; ++i)
+        {
+            if (! close(x[i], bg::get<0>(xys[i])) || ! close(y[i], bg::get<1>(xys[i]))
+             || ! close(lon2[i], bg::get<0>(lls2[i])) || ! close(lat2[i], bg::get<1>(lls2[i]))
+             || ! close(bg::get<0>(xys_n[i]), bg::get<0>(xys[i]))
+             || ! close(bg::get<1>(xys_n[i]), bg::get<1>(xys[i]))
+             || ! close(bg::get<0>(lls_n[i]), bg::get<0>(lls2[i]))
+             || ! close(bg::get<1>(lls_n[i]), bg::get<1>(lls2[i])))
+            {
+                ++differences;
+            }
+        }
+        BOOST_CHECK_MESSAGE(differences == 0,
+            name << " threads: " << t << " differences: " << differences);
+    }
+
+    // Radians
+    {
+        std::vector<double> lon_r(count), lat_r(count), x(count), y(count);
+        for (std::size_t i = 0 ; i < count ; ++i)
+        {
+            lon_r[i] = lon[i] * bg::math::d2r<double>();
+            lat_r[i] = lat[i] * bg::math::d2r<double>();
+        }
+        prj.template forward<bg::radian>(lon_r.data(), lat_r.data(), x.data(), y.data(), count);
+        BOOST_CHECK(close(x[100], bg::get<0>(xys[100])) && close(y[100], bg::get<1>(xys[100])));
+    }
+}
+
+void test_transformation()
+{
+    bg::srs::transformation<> tr((bg::srs::proj4("+proj=tmerc +ellps=WGS84 +units=m")),
+                                 (bg::srs::proj4("+proj=merc +ellps=clrk66 +lat_ts=20")));
+
+    std::vector<point_ll> const lls = grid();
+    bg::model::linestring<point_xy> ls, ls_out;
+    bg::srs::projection<> tmerc((bg::srs::proj4("+proj=tmerc +ellps=WGS84 +units=m")));
+    for (std::size_t i = 0 ; i < lls.size() ; ++i)
+    {
+        point_xy xy;
+        if (tmerc.forward(lls[i], xy))
+        {
+            ls.push_back(xy);
+        }
+    }
+
+    tr.forward(ls, ls_out);
+    BOOST_CHECK_EQUAL(ls_out.size(), ls.size());
+
+    std::size_t differences = 0;
+    for (std::size_t i = 0 ; i < ls.size() ; ++i)
+    {
+        point_xy p;
+        tr.forward(ls[i], p);
+        if (! close(bg::get<0>(p), bg::get<0>(ls_out[i]))
+         || ! close(bg::get<1>(p), bg::get<1>(ls_out[i])))
+        {
+            ++differences;
+        }
+    }
+    BOOST_CHECK_EQUAL(differences, 0u);
+
+    // Invalid points in a range are skipped
+    bg::model::linestring<point_ll> lls_in;
+    lls_in.push_back(point_ll(1, 1));
+    lls_in.push_back(point_ll(1, 100));
+    lls_in.push_back(point_ll(2, 2));
+    bg::srs::transformation<> tr2((bg::srs::proj4("+proj=longlat +ellps=WGS84")),
+                                  (bg::srs::proj4("+proj=tmerc +ellps=WGS84 +units=m")));
+    bg::model::linestring<point_xy> xys_out;
+    BOOST_CHECK(! tr2.forward(lls_in, xys_out));
+    BOOST_CHECK(bg::get<0>(xys_out[0]) != HUGE_VAL);
+    BOOST_CHECK(bg::get<0>(xys_out[1]) == HUGE_VAL);
+    BOOST_CHECK(bg::get<0>(xys_out[2]) != HUGE_VAL);
+}
+
+int test_main(int, char*[])
+{
+    using namespace bg::srs;
+
+    char const* const defs[] = {
+        "+proj=merc +ellps=WGS84 +lat_ts=20",
+        "+proj=merc +R=6370997",
+        "+proj=tmerc +ellps=WGS84 +lon_0=3 +k=0.9996 +units=m",
+        "+proj=tmerc +R=6370997",
+        "+proj=lcc +ellps=WGS84 +lat_1=10 +lat_2=40 +lon_0=5",
+        "+proj=utm +zone=31 +ellps=WGS84",
+        "+proj=utm +zone=31 +ellps=WGS84 +south",
+        "+proj=lcc +ellps=GRS80 +lat_1=10 +lat_2=40 +axis=neu"
+    };
+
+    for (char const* def : defs)
+    {
+        test_projection(projection<>(proj4(def)), def);
+    }
+
+    {
+        typedef spar::parameters<spar::proj_tmerc, spar::ellps_wgs84> tmerc_t;
+        test_projection(projection<tmerc_t>(), "static tmerc");
+
+        typedef spar::parameters<spar::proj_merc, spar::ellps_wgs84> merc_t;
+        test_projection(projection<merc_t>(), "static merc");
+    }
+
+    test_transformation();
+
+    return 0;
+}
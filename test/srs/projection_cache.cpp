@@ -0,0 +1,147 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/epsg.hpp>
+#include <boost/geometry/srs/projection.hpp>
+#include <boost/geometry/srs/projection_cache.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+
+template <typename Proj1, typename Proj2>
+void check_same(Proj1 const& proj1, Proj2 const& proj2, std::string const& case_id)
+{
+    point_ll const ll(4.9, 52.4);
+    point_xy xy1, xy2;
+    BOOST_CHECK(proj1.forward(ll, xy1));
+    BOOST_CHECK(proj2.forward(ll, xy2));
+    BOOST_CHECK_MESSAGE(bg::get<0>(xy1) == bg::get<0>(xy2)
+                     && bg::get<1>(xy1) == bg::get<1>(xy2),
+                        case_id << " " << bg::get<0>(xy1) << "," << bg::get<1>(xy1)
+                        << " != " << bg::get<0>(xy2) << "," << bg::get<1>(xy2));
+}
+
+void test_keys()
+{
+    using namespace bg::srs;
+
+    BOOST_CHECK_EQUAL(detail::projection_cache_key(proj4("+proj=tmerc +ellps=WGS84 +lon_0=3")),
+                      detail::projection_cache_key(proj4("  +lon_0=3  +proj=tmerc +ellps=WGS84 ")));
+    BOOST_CHECK(detail::projection_cache_key(proj4("+proj=tmerc +lon_0=3"))
+             != detail::projection_cache_key(proj4("+proj=tmerc +lon_0=4")));
+    // The first one of the parameters with the same name is used
+    BOOST_CHECK(detail::projection_cache_key(proj4("+proj=tmerc +lon_0=3 +lon_0=4"))
+             != detail::projection_cache_key(proj4("+proj=tmerc +lon_0=4 +lon_0=3")));
+    BOOST_CHECK(detail::projection_cache_key(epsg(2000))
+             != detail::projection_cache_key(esri(2000)));
+}
+
+void test_cache()
+{
+    using namespace bg::srs;
+
+    projection_cache<> cache(2);
+
+    std::string const merc = "+proj=merc +ellps=WGS84 +lat_ts=20";
+    projection<> p1 = cache.get(proj4(merc));
+    projection<> p2 = cache.get(proj4("+lat_ts=20 +ellps=WGS84 +proj=merc"));
+    BOOST_CHECK_EQUAL(cache.size(), 1u);
+    check_same(p1, projection<>(proj4(merc)), "merc");
+    check_same(p1, p2, "merc normalized");
+
+    projection<> p3 = cache.get(epsg(2000));
+    BOOST_CHECK_EQUAL(cache.size(), 2u);
+    check_same(p3, projection<>(epsg(2000)), "epsg 2000");
+
+    // epsg 2000 is the least recently used and is removed
+    cache.get(proj4(merc));
+    cache.get(proj4("+proj=tmerc +ellps=WGS84 +lon_0=3"));
+    BOOST_CHECK_EQUAL(cache.size(), 2u);
+
+    // The projections returned by the cache are valid after removal
+    cache.clear();
+    BOOST_CHECK_EQUAL(cache.size(), 0u);
+    check_same(p3, projection<>(epsg(2000)), "epsg 2000 removed");
+
+    BOOST_CHECK_THROW(cache.get(proj4("+proj=unknown")), bg::projection_exception);
+    BOOST_CHECK_EQUAL(cache.size(), 0u);
+}
+
+void test_concurrent()
+{
+    using namespace bg::srs;
+
+    projection_cache<> cache(4);
+    char const* const defs[] = {
+        "+proj=merc +ellps=WGS84",
+        "+proj=tmerc +ellps=WGS84 +lon_0=3",
+        "+proj=lcc +ellps=WGS84 +lat_1=10 +lat_2=40 +lon_0=5",
+        "+proj=utm +zone=31 +ellps=WGS84",
+        "+proj=utm +zone=32 +ellps=WGS84",
+        "+proj=laea +ellps=WGS84 +lat_0=52 +lon_0=10"
+    };
+    std::size_t const defs_count = sizeof(defs) / sizeof(defs[0]);
+
+    std::vector<point_xy> expected;
+    for (char const* def : defs)
+    {
+        point_xy xy;
+        projection<>(proj4(def)).forward(point_ll(4.9, 52.4), xy);
+        expected.push_back(xy);
+    }
+
+    std::vector<int> failures(4, 0);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < failures.size(); ++t)
+    {
+        threads.emplace_back([&, t]()
+        {
+            for (std::size_t i = 0; i < 200; ++i)
+            {
+                std::size_t const d = (i * 7 + t) % defs_count;
+                point_xy xy;
+                cache.get(proj4(defs[d])).forward(point_ll(4.9, 52.4), xy);
+                if (bg::get<0>(xy) != bg::get<0>(expected[d])
+                 || bg::get<1>(xy) != bg::get<1>(expected[d]))
+                {
+                    ++failures[t];
+                }
+            }
+        });
+    }
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int f : failures)
+    {
+        BOOST_CHECK_EQUAL(f, 0);
+    }
+    BOOST_CHECK(cache.size() <= 4u);
+}
+
+int test_main(int, char*[])
+{
+    test_keys();
+    test_cache();
+    test_concurrent();
+
+    return 0;
+}
@@ -0,0 +1,269 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/mapped_file_policy.hpp>
+#include <boost/geometry/srs/shared_grids_lockfree.hpp>
+#include <boost/geometry/srs/shared_grids_std.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+#include <boost/geometry/util/parallel.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+
+static const char ntv2_name[] = "transformation_grids_test.gsb";
+static const char ctable2_name[] = "transformation_grids_test.ct2";
+
+// NTv2 record of 16 bytes, the label and the value
+template <typename T>
+void write_record(std::ofstream & os, char const* label, T const& value)
+{
+    char record[16] = {0};
+    std::memcpy(record, label, std::strlen(label));
+    std::memcpy(record + 8, &value, sizeof(T));
+    os.write(record, sizeof(record));
+}
+
+void write_record(std::ofstream & os, char const* label, char const* value)
+{
+    char record[16] = {0};
+    std::memcpy(record, label, std::strlen(label));
+    std::memcpy(record + 8, value, std::strlen(value));
+    os.write(record, sizeof(record));
+}
+
+// Grid in seconds, the longitudes are positive west
+void write_ntv2_subfile(std::ofstream & os, char const* name, char const* parent,
+                        double s_lat, double n_lat, double e_long, double w_long,
+                        double inc, float lat_shift, float lon_shift)
+{
+    boost::int32_t const rows = boost::int32_t((n_lat - s_lat) / inc + 0.5) + 1;
+    boost::int32_t const cols = boost::int32_t((w_long - e_long) / inc + 0.5) + 1;
+    boost::int32_t const count = rows * cols;
+
+    write_record(os, "SUB_NAME", name);
+    write_record(os, "PARENT", parent);
+    write_record(os, "CREATED", "");
+    write_record(os, "UPDATED", "");
+    write_record(os, "S_LAT", s_lat);
+    write_record(os, "N_LAT", n_lat);
+    write_record(os, "E_LONG", e_long);
+    write_record(os, "W_LONG", w_long);
+    write_record(os, "LAT_INC", inc);
+    write_record(os, "LONG_INC", inc);
+    write_record(os, "GS_COUNT", count);
+
+    float const node[4] = { lat_shift, lon_shift, 0.0f, 0.0f };
+    for (boost::int32_t i = 0 ; i < count ; ++i)
+    {
+        os.write(reinterpret_cast<char const*>(node), sizeof(node));
+    }
+}
+
+// NTv2 file with a parent grid and a child grid with a different shift
+void write_ntv2()
+{
+    std::ofstream os(ntv2_name, std::ios::binary);
+    write_record(os, "NUM_OREC", boost::int32_t(11));
+    write_record(os, "NUM_SREC", boost::int32_t(11));
+    write_record(os, "NUM_FILE", boost::int32_t(2));
+    write_record(os, "GS_TYPE", "SECONDS");
+    write_record(os, "VERSION", "NTv2.0");
+    write_record(os, "SYSTEM_F", "");
+    write_record(os, "SYSTEM_T", "");
+    write_record(os, "MAJOR_F", 6378137.0);
+    write_record(os, "MINOR_F", 6356752.314);
+    write_record(os, "MAJOR_T", 6378137.0);
+    write_record(os, "MINOR_T", 6356752.314);
+
+    // lon [0, 20], lat [0, 10]
+    write_ntv2_subfile(os, "PARENT", "NONE", 0, 36000, -72000, 0, 3600, 1.0f, 2.0f);
+    // lon [5, 10], lat [2, 6]
+    write_ntv2_subfile(os, "CHILD", "PARENT", 7200, 21600, -36000, -18000, 1800, 3.0f, 4.0f);
+}
+
+// ctable2 file covering lon [-60, -40], lat [-30, -10]
+void write_ctable2()
+{
+    double const d2r = bg::math::d2r<double>();
+    double const s2r = d2r / 3600.0;
+
+    char header[160] = {0};
+    std::memcpy(header, "CTABLE V2", 9);
+    std::memcpy(header + 16, "test", 4);
+    double const ll_del[4] = { -60 * d2r, -30 * d2r, 1 * d2r, 1 * d2r };
+    boost::int32_t const lim[2] = { 21, 21 };
+    std::memcpy(header + 96, ll_del, sizeof(ll_del));
+    std::memcpy(header + 128, lim, sizeof(lim));
+
+    std::ofstream os(ctable2_name, std::ios::binary);
+    os.write(header, sizeof(header));
+    float const node[2] = { float(5 * s2r), float(6 * s2r) };
+    for (int i = 0 ; i < 21 * 21 ; ++i)
+    {
+        os.write(reinterpret_cast<char const*>(node), sizeof(node));
+    }
+}
+
+inline std::vector<point_ll> points()
+{
+    std::vector<point_ll> result;
+    for (int i = 0 ; i < 40 ; ++i)
+    {
+        for (int j = 0 ; j < 12 ; ++j)
+        {
+            result.push_back(point_ll(-70 + i * 2.25, -35 + j * 4.1));
+        }
+    }
+    return result;
+}
+
+typedef bg::srs::transformation<> transformation_type;
+
+inline transformation_type make_transformation(std::string const& nadgrids)
+{
+    return transformation_type(
+        bg::srs::proj4("+proj=longlat +ellps=WGS84 +nadgrids=" + nadgrids),
+        bg::srs::proj4("+proj=longlat +ellps=WGS84 +towgs84=0,0,0"));
+}
+
+template <typename Storage>
+std::vector<point_ll> transform(Storage & storage, std::vector<point_ll> const& pts)
+{
+    transformation_type const tr = make_transformation(std::string("@") + ntv2_name
+                                                       + ",@" + ctable2_name);
+
+    std::vector<point_ll> result(pts.size());
+    bg::srs::transformation_grids<Storage> grids = tr.initialize_grids(storage);
+    for (std::size_t i = 0 ; i < pts.size() ; ++i)
+    {
+        tr.forward(pts[i], result[i], grids);
+    }
+    return result;
+}
+
+inline std::size_t differences(std::vector<point_ll> const& v1, std::vector<point_ll> const& v2)
+{
+    std::size_t result = 0;
+    for (std::size_t i = 0 ; i < v1.size() ; ++i)
+    {
+        if (std::fabs(bg::get<0>(v1[i]) - bg::get<0>(v2[i])) > 1e-12
+         || std::fabs(bg::get<1>(v1[i]) - bg::get<1>(v2[i])) > 1e-12)
+        {
+            ++result;
+        }
+    }
+    return result;
+}
+
+// Compare the shift in seconds
+inline bool check_shift(point_ll const& p, point_ll const& q, double lon, double lat)
+{
+    return std::fabs((bg::get<0>(p) - bg::get<0>(q)) * 3600 - lon) < 1e-4
+        && std::fabs((bg::get<1>(p) - bg::get<1>(q)) * 3600 - lat) < 1e-4;
+}
+
+template <typename StreamPolicy, typename Grids>
+void test_storage(std::vector<point_ll> const& pts,
+                  std::vector<point_ll> const& expected,
+                  std::string const& name)
+{
+    bg::srs::grids_storage<StreamPolicy, Grids> storage;
+    std::vector<point_ll> const result = transform(storage, pts);
+    BOOST_CHECK_MESSAGE(differences(result, expected) == 0, name);
+    BOOST_CHECK_EQUAL(storage.hgrids.size(), 2u);
+
+    // The grids are already loaded
+    BOOST_CHECK_MESSAGE(differences(transform(storage, pts), expected) == 0, name);
+    BOOST_CHECK_EQUAL(storage.hgrids.size(), 2u);
+}
+
+template <typename StreamPolicy>
+void test_parallel(std::vector<point_ll> const& pts,
+                   std::vector<point_ll> const& expected)
+{
+    bg::srs::grids_storage<StreamPolicy, bg::srs::shared_grids_lockfree> storage;
+
+    std::size_t const parts = 16;
+    std::vector<std::size_t> diffs(parts, 0);
+    bg::detail::parallel::for_each_index(parts, 4, [&](std::size_t i)
+    {
+        diffs[i] = differences(transform(storage, pts), expected);
+    });
+
+    for (std::size_t i = 0 ; i < parts ; ++i)
+    {
+        BOOST_CHECK_EQUAL(diffs[i], 0u);
+    }
+    BOOST_CHECK_EQUAL(storage.hgrids.size(), 2u);
+}
+
+int test_main(int, char*[])
+{
+    using namespace bg::srs;
+
+    write_ntv2();
+    write_ctable2();
+
+    std::vector<point_ll> const pts = points();
+
+    grids_storage<> storage;
+    std::vector<point_ll> const expected = transform(storage, pts);
+
+    // Shifts of the grids
+    {
+        transformation_type const tr = make_transformation(std::string("@") + ntv2_name
+                                                           + ",@" + ctable2_name);
+        transformation_grids<grids_storage<> > grids = tr.initialize_grids(storage);
+
+        point_ll const in[] = { point_ll(1, 1), point_ll(7, 4), point_ll(-50, -20), point_ll(30, 30) };
+        point_ll out[4];
+        for (int i = 0 ; i < 4 ; ++i)
+        {
+            tr.forward(in[i], out[i], grids);
+        }
+        BOOST_CHECK(check_shift(in[0], out[0], 2, 1));
+        BOOST_CHECK(check_shift(in[1], out[1], 4, 3));
+        BOOST_CHECK(check_shift(in[2], out[2], 5, 6));
+        BOOST_CHECK(check_shift(in[3], out[3], 0, 0));
+    }
+
+    test_storage<ifstream_policy, grids>(pts, expected, "ifstream grids");
+    test_storage<ifstream_policy, shared_grids_std>(pts, expected, "ifstream shared_grids_std");
+    test_storage<ifstream_policy, shared_grids_lockfree>(pts, expected, "ifstream shared_grids_lockfree");
+    test_storage<mapped_file_policy, grids>(pts, expected, "mapped grids");
+    test_storage<mapped_file_policy, shared_grids_lockfree>(pts, expected, "mapped shared_grids_lockfree");
+
+    test_parallel<ifstream_policy>(pts, expected);
+    test_parallel<mapped_file_policy>(pts, expected);
+
+    // Missing files
+    {
+        grids_storage<mapped_file_policy, shared_grids_lockfree> storage_m;
+        BOOST_CHECK_NO_THROW(make_transformation("@missing.gsb").initialize_grids(storage_m));
+        BOOST_CHECK_THROW(make_transformation("missing.gsb").initialize_grids(storage_m),
+                          bg::projection_exception);
+        BOOST_CHECK(storage_m.hgrids.empty());
+    }
+
+    std::remove(ntv2_name);
+    std::remove(ctable2_name);
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+// Boost.Geometry
+// Unit Tests
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_TEST_STAR_POLYGONS_HPP
+#define BOOST_GEOMETRY_TEST_STAR_POLYGONS_HPP
+
+#include <cmath>
+
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/append.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/util/math.hpp>
+
+// Star-shaped polygons with many vertices placed in a n x n grid with the
+// distance between the centers equal to spacing. If hole_radius is not 0
+// the polygons have a regular hole. If skip is not 0 every skip-th polygon
+// is skipped so the grid is not regular.
+template <typename MultiPolygon>
+inline MultiPolygon make_star_polygons(int n, int vertices, double spacing,
+                                       double offset = 0.0,
+                                       double hole_radius = 0.0,
+                                       int skip = 0)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    typedef typename boost::geometry::point_type<MultiPolygon>::type point_type;
+
+    double const pi = boost::geometry::math::pi<double>();
+
+    MultiPolygon result;
+    for (int i = 0 ; i < n ; ++i)
+    {
+        for (int j = 0 ; j < n ; ++j)
+        {
+            if (skip > 0 && (i * n + j) % skip == skip / 2)
+            {
+                continue;
+            }
+
+            double const x = i * spacing + offset;
+            double const y = j * spacing + offset;
+
+            polygon_type poly;
+            for (int k = 0 ; k < vertices ; ++k)
+            {
+                double const a = 2 * pi * k / vertices;
+                double const r = k % 2 == 0 ? 0.9 : 0.6;
+                boost::geometry::append(poly.outer(),
+                    point_type(x + r * std::cos(a), y + r * std::sin(a)));
+            }
+            boost::geometry::append(poly.outer(), poly.outer().front());
+
+            if (hole_radius > 0.0)
+            {
+                poly.inners().resize(1);
+                for (int k = 0 ; k < vertices ; ++k)
+                {
+                    double const a = 2 * pi * k / vertices;
+                    boost::geometry::append(poly.inners()[0],
+                        point_type(x + hole_radius * std::cos(a), y + hole_radius * std::sin(a)));
+                }
+                boost::geometry::append(poly.inners()[0], poly.inners()[0].front());
+            }
+
+            result.push_back(poly);
+        }
+    }
+    boost::geometry::correct(result);
+    return result;
+}
+
+#endif // BOOST_GEOMETRY_TEST_STAR_POLYGONS_HPP